@@ -54,8 +54,55 @@ public: \
   template<typename ... Args> \
   static ObjectWrapper createShared(Args... args){ \
     return ObjectWrapper(std::make_shared<Z__CLASS>(args...), ObjectWrapper::Class::getType()); \
+  } \
+\
+  template<class, v_int32, v_int32> \
+  friend struct oatpp::data::mapping::type::StaticFields; \
+\
+  static std::integral_constant<v_int32, 0> Z__FIELD_COUNTER(oatpp::data::mapping::type::FieldRank<0>); \
+\
+  static constexpr v_int32 Z__FIELD_COUNT() { \
+    return decltype(Z__FIELD_COUNTER(oatpp::data::mapping::type::FieldRank<oatpp::data::mapping::type::DTO_MAX_FIELDS>()))::value; \
+  } \
+\
+  template<class Z__VISITOR> \
+  static void Z__VISIT_FIELDS(Z__VISITOR& visitor, Z__CLASS* object) { \
+    Z__CLASS_EXTENDED::Z__VISIT_FIELDS(visitor, object); \
+    oatpp::data::mapping::type::StaticFields<Z__CLASS, Z__FIELD_COUNT()>::visit(visitor, object); \
+  } \
+\
+  template<class Z__VISITOR> \
+  static void Z__VISIT_FIELD_DESCRIPTORS(Z__VISITOR& visitor) { \
+    Z__CLASS_EXTENDED::Z__VISIT_FIELD_DESCRIPTORS(visitor); \
+    oatpp::data::mapping::type::StaticFields<Z__CLASS, Z__FIELD_COUNT()>::visitDescriptors(visitor); \
   }
 
+// Static fields
+
+/**
+ * Generate compile-time field index and typed accessors used by
+ * &id:oatpp::data::mapping::type::StaticFields; for statically typed (de)serialization.
+ */
+#define OATPP_MACRO_DTO_FIELD_STATIC(NAME) \
+\
+static constexpr v_int32 Z__FIELD_INDEX_##NAME = \
+  decltype(Z__FIELD_COUNTER(oatpp::data::mapping::type::FieldRank<oatpp::data::mapping::type::DTO_MAX_FIELDS>()))::value; \
+\
+static_assert(Z__FIELD_INDEX_##NAME < oatpp::data::mapping::type::DTO_MAX_FIELDS, \
+              "Too many DTO fields. See oatpp::data::mapping::type::DTO_MAX_FIELDS."); \
+\
+static std::integral_constant<v_int32, Z__FIELD_INDEX_##NAME + 1> \
+  Z__FIELD_COUNTER(oatpp::data::mapping::type::FieldRank<Z__FIELD_INDEX_##NAME + 1>); \
+\
+static oatpp::data::mapping::type::Type::Property* Z__FIELD_PROPERTY(std::integral_constant<v_int32, Z__FIELD_INDEX_##NAME>) { \
+  return Z__PROPERTY_SINGLETON_##NAME(); \
+} \
+\
+template<class Z__VISITOR> \
+static void Z__FIELD_VISIT(Z__VISITOR& visitor, Z__CLASS* object, std::integral_constant<v_int32, Z__FIELD_INDEX_##NAME>) { \
+  visitor(Z__PROPERTY_SINGLETON_##NAME(), object->NAME); \
+}
+
 // Fields
 
 #define OATPP_MACRO_DTO_FIELD_1(TYPE, NAME) \
@@ -85,6 +132,8 @@ static TYPE::__Wrapper Z__PROPERTY_INITIALIZER_PROXY_##NAME() { \
   return TYPE::__Wrapper(); \
 } \
 \
+OATPP_MACRO_DTO_FIELD_STATIC(NAME) \
+\
 TYPE::__Wrapper NAME = Z__PROPERTY_INITIALIZER_PROXY_##NAME()
 
 #define OATPP_MACRO_DTO_FIELD_2(TYPE, NAME, QUALIFIER) \
@@ -114,6 +163,8 @@ static TYPE::__Wrapper Z__PROPERTY_INITIALIZER_PROXY_##NAME() { \
   return TYPE::__Wrapper(); \
 } \
 \
+OATPP_MACRO_DTO_FIELD_STATIC(NAME) \
+\
 TYPE::__Wrapper NAME = Z__PROPERTY_INITIALIZER_PROXY_##NAME()
 
 /**
@@ -26,6 +26,10 @@
 
 #undef DTO_INIT
 
+// Static fields
+
+#undef OATPP_MACRO_DTO_FIELD_STATIC
+
 // Fields
 
 #undef OATPP_MACRO_DTO_FIELD_1
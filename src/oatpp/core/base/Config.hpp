@@ -43,6 +43,12 @@
  */
 //#define OATPP_DISABLE_POOL_ALLOCATIONS
 
+/**
+ * Define this to back chunks of hot memory pools (such as IOBuffer pool) by huge pages.
+ * Reduces TLB misses with large number of connections. Linux only.
+ */
+//#define OATPP_POOL_HUGE_PAGES
+
 /**
  * Predefined value for function oatpp::concurrency::Thread::getHardwareConcurrency();
  */
@@ -62,8 +68,12 @@
  */
 //#define OATPP_COMPAT_BUILD_NO_THREAD_LOCAL 1
 
+/**
+ * Default pattern (as for `snprintf`) used to convert floating point numbers to string. <br>
+ * `nullptr` - use the shortest representation which reads back to exactly the same value.
+ */
 #ifndef OATPP_FLOAT_STRING_FORMAT
-  #define OATPP_FLOAT_STRING_FORMAT "%.16g"
+  #define OATPP_FLOAT_STRING_FORMAT nullptr
 #endif
 
 /**
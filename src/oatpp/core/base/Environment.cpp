@@ -45,8 +45,8 @@ namespace oatpp { namespace base {
 std::shared_ptr<Logger> Environment::m_logger;
 std::unordered_map<std::string, std::unordered_map<std::string, void*>> Environment::m_components;
 
-v_atomicCounter Environment::m_objectsCount(0);
-v_atomicCounter Environment::m_objectsCreated(0);
+constexpr v_int32 Environment::COUNTER_SHARDS_COUNT;
+Environment::CounterShard Environment::m_counterShards[COUNTER_SHARDS_COUNT];
 
 #ifndef OATPP_COMPAT_BUILD_NO_THREAD_LOCAL
 thread_local v_counter Environment::m_threadLocalObjectsCount = 0;
@@ -135,8 +135,10 @@ void Environment::init(const std::shared_ptr<Logger>& logger) {
 
   checkTypes();
 
-  m_objectsCount = 0;
-  m_objectsCreated = 0;
+  for(v_int32 i = 0; i < COUNTER_SHARDS_COUNT; i++) {
+    m_counterShards[i].objectsCount = 0;
+    m_counterShards[i].objectsCreated = 0;
+  }
 
 #ifndef OATPP_COMPAT_BUILD_NO_THREAD_LOCAL
   m_threadLocalObjectsCount = 0;
@@ -183,10 +185,21 @@ void Environment::checkTypes(){
 
 }
 
+Environment::CounterShard& Environment::getCounterShard() {
+#ifndef OATPP_COMPAT_BUILD_NO_THREAD_LOCAL
+  static std::atomic<v_int32> shardsCounter(0);
+  static thread_local v_int32 index = (shardsCounter ++) % COUNTER_SHARDS_COUNT;
+  return m_counterShards[index];
+#else
+  return m_counterShards[0];
+#endif
+}
+
 void Environment::incObjects(){
 
-  m_objectsCount ++;
-  m_objectsCreated ++;
+  auto& shard = getCounterShard();
+  shard.objectsCount.fetch_add(1, std::memory_order_relaxed);
+  shard.objectsCreated.fetch_add(1, std::memory_order_relaxed);
 
 #ifndef OATPP_COMPAT_BUILD_NO_THREAD_LOCAL
   m_threadLocalObjectsCount ++;
@@ -197,7 +210,7 @@ void Environment::incObjects(){
 
 void Environment::decObjects(){
 
-  m_objectsCount --;
+  getCounterShard().objectsCount.fetch_sub(1, std::memory_order_relaxed);
 
 #ifndef OATPP_COMPAT_BUILD_NO_THREAD_LOCAL
   m_threadLocalObjectsCount --;
@@ -206,11 +219,19 @@ void Environment::decObjects(){
 }
 
 v_counter Environment::getObjectsCount(){
-  return m_objectsCount;
+  v_counter result = 0;
+  for(v_int32 i = 0; i < COUNTER_SHARDS_COUNT; i++) {
+    result += m_counterShards[i].objectsCount.load(std::memory_order_relaxed);
+  }
+  return result;
 }
 
 v_counter Environment::getObjectsCreated(){
-  return m_objectsCreated;
+  v_counter result = 0;
+  for(v_int32 i = 0; i < COUNTER_SHARDS_COUNT; i++) {
+    result += m_counterShards[i].objectsCreated.load(std::memory_order_relaxed);
+  }
+  return result;
 }
 
 v_counter Environment::getThreadLocalObjectsCount(){
@@ -245,6 +266,10 @@ void Environment::printCompilationConfig() {
   OATPP_LOGD("oatpp/Config", "OATPP_DISABLE_POOL_ALLOCATIONS");
 #endif
 
+#ifdef OATPP_POOL_HUGE_PAGES
+  OATPP_LOGD("oatpp/Config", "OATPP_POOL_HUGE_PAGES");
+#endif
+
 #ifdef OATPP_COMPAT_BUILD_NO_THREAD_LOCAL
   OATPP_LOGD("oatpp/Config", "OATPP_COMPAT_BUILD_NO_THREAD_LOCAL");
 #endif
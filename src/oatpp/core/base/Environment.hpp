@@ -186,8 +186,20 @@ public:
 class Environment{
 private:
 
-  static v_atomicCounter m_objectsCount;
-  static v_atomicCounter m_objectsCreated;
+  /*
+   * Object counters are sharded by thread and padded to the cache line size,
+   * so that concurrent object creation doesn't bounce one cache line between cores.
+   * Shards are summed on read.
+   */
+  static constexpr v_int32 COUNTER_SHARDS_COUNT = 64;
+
+  struct alignas(64) CounterShard {
+    v_atomicCounter objectsCount;
+    v_atomicCounter objectsCreated;
+  };
+
+  static CounterShard m_counterShards[COUNTER_SHARDS_COUNT];
+  static CounterShard& getCounterShard();
 
 #ifndef OATPP_COMPAT_BUILD_NO_THREAD_LOCAL
   static thread_local v_counter m_threadLocalObjectsCount;
@@ -320,6 +332,7 @@ public:
    * Print values for: <br>
    * - `OATPP_DISABLE_ENV_OBJECT_COUNTERS`<br>
    * - `OATPP_DISABLE_POOL_ALLOCATIONS`<br>
+   * - `OATPP_POOL_HUGE_PAGES`<br>
    * - `OATPP_THREAD_HARDWARE_CONCURRENCY`<br>
    * - `OATPP_THREAD_DISTRIBUTED_MEM_POOL_SHARDS_COUNT`
    */
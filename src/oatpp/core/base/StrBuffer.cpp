@@ -46,13 +46,9 @@ void StrBuffer::setAndCopy(const void* data, const void* originData, v_buff_size
 
 std::shared_ptr<StrBuffer> StrBuffer::allocShared(const void* data, v_buff_size size, bool copyAsOwnData) {
   if(copyAsOwnData) {
+    /* control block, StrBuffer and string data in one slab block */
     memory::AllocationExtras extras(size + 1);
-    std::shared_ptr<StrBuffer> ptr;
-    if(size + 1 > getSmStringSize()) {
-      ptr = memory::allocateSharedWithExtras<StrBuffer>(extras);
-    } else {
-      ptr = memory::customPoolAllocateSharedWithExtras<StrBuffer>(extras, getSmallStringPool());
-    }
+    const auto& ptr = memory::slabAllocateSharedWithExtras<StrBuffer>(extras);
     ptr->setAndCopy(extras.extraPtr, data, size);
     return ptr;
   }
@@ -61,7 +57,7 @@ std::shared_ptr<StrBuffer> StrBuffer::allocShared(const void* data, v_buff_size
 
 p_char8 StrBuffer::allocStrBuffer(const void* originData, v_buff_size size, bool copyAsOwnData) {
   if(copyAsOwnData) {
-    p_char8 data = new v_char8[size + 1];
+    p_char8 data = (p_char8) memory::SlabAllocator::allocate(size + 1);
     data[size] = 0;
     if(originData != nullptr) {
       std::memcpy(data, originData, size);
@@ -85,7 +81,7 @@ StrBuffer::StrBuffer(const void* data, v_buff_size size, bool copyAsOwnData)
 
 StrBuffer::~StrBuffer() {
   if(m_hasOwnData) {
-    delete [] m_data;
+    memory::SlabAllocator::deallocate(m_data, m_size + 1);
   }
   m_data = nullptr;
 }
@@ -36,26 +36,6 @@ namespace oatpp { namespace base {
  * String buffer class.
  */
 class StrBuffer : public oatpp::base::Countable {  
-private:
-
-  static constexpr v_buff_size SM_STRING_POOL_ENTRY_SIZE = 256;
-  
-  static oatpp::base::memory::ThreadDistributedMemoryPool& getSmallStringPool() {
-    static oatpp::base::memory::ThreadDistributedMemoryPool pool("Small_String_Pool", SM_STRING_POOL_ENTRY_SIZE, 16);
-    return pool;
-  }
-  
-  static v_buff_size getSmStringBaseSize() {
-    memory::AllocationExtras extras(0);
-    auto ptr = memory::customPoolAllocateSharedWithExtras<StrBuffer>(extras, getSmallStringPool());
-    return extras.baseSize;
-  }
-  
-  static v_buff_size getSmStringSize() {
-    static v_buff_size size = SM_STRING_POOL_ENTRY_SIZE - getSmStringBaseSize();
-    return size;
-  }
-
 private:
   p_char8 m_data;
   v_buff_size m_size;
@@ -31,4 +31,8 @@ AllocatorPoolInfo::AllocatorPoolInfo(const char* pPoolName, v_buff_size pPoolChu
   , poolChunkSize(pPoolChunkSize)
 {}
 
+#ifndef OATPP_COMPAT_BUILD_NO_THREAD_LOCAL
+thread_local v_int32 PooledAllocation::DEPTH = 0;
+#endif
+
 }}}
\ No newline at end of file
@@ -26,6 +26,7 @@
 #define oatpp_base_memory_Allocator_hpp
 
 #include "./MemoryPool.hpp"
+#include "./SlabAllocator.hpp"
 #include <memory>
 
 namespace oatpp { namespace base { namespace memory {
@@ -154,6 +155,131 @@ inline bool operator != (const ThreadLocalPoolSharedObjectAllocator<T>& a, const
   return !(a == b);
 }
 
+/**
+ * STL-compatible allocator for node-based containers (ex.: `std::list`). <br>
+ * Single elements are allocated on &id:oatpp::base::memory::ThreadDistributedMemoryPool; shared by all types of the same size,
+ * so container nodes are packed in pool chunks instead of being scattered over the heap.
+ * Multi-element allocations go to `::operator new`.
+ * @tparam T - type of the object to allocate.
+ */
+template<class T>
+class PoolAllocator {
+public:
+  typedef T value_type;
+private:
+
+  template<std::size_t Size>
+  static oatpp::base::memory::ThreadDistributedMemoryPool& getPool() {
+    /* Never deleted - containers with static storage duration may release their nodes after static pools are destroyed */
+    static oatpp::base::memory::ThreadDistributedMemoryPool* pool =
+      new oatpp::base::memory::ThreadDistributedMemoryPool("PoolAllocator", Size, 1024);
+    return *pool;
+  }
+
+public:
+
+  PoolAllocator() = default;
+
+  template<typename U>
+  PoolAllocator(const PoolAllocator<U>& other) {
+    (void)other;
+  }
+
+  T* allocate(std::size_t n) {
+    if(n == 1) {
+      return static_cast<T*>(getPool<sizeof(T)>().obtain());
+    }
+    return static_cast<T*>(::operator new(n * sizeof(T)));
+  }
+
+  void deallocate(T* ptr, size_t n) {
+    if(n == 1) {
+      oatpp::base::memory::MemoryPool::free(ptr);
+    } else {
+      ::operator delete(ptr);
+    }
+  }
+
+};
+
+template <typename T, typename U>
+inline bool operator == (const PoolAllocator<T>&, const PoolAllocator<U>&) {
+  return true;
+}
+
+template <typename T, typename U>
+inline bool operator != (const PoolAllocator<T>& a, const PoolAllocator<U>& b) {
+  return !(a == b);
+}
+
+/**
+ * Opt-in pooled allocation of shared objects for the current thread. <br>
+ * While at least one &l:PooledAllocation::Scope; is alive on the thread, &l:PooledAllocation::allocateShared (); places
+ * the object together with its shared_ptr control block on a size-class pool of &l:PoolAllocator;.
+ * Otherwise it is the same as `std::make_shared`. <br>
+ * The allocator is stored in the control block, so objects may outlive the scope and may be released on any thread. <br>
+ * *If built with OATPP_COMPAT_BUILD_NO_THREAD_LOCAL flag - scopes have no effect.*
+ */
+class PooledAllocation {
+private:
+#ifndef OATPP_COMPAT_BUILD_NO_THREAD_LOCAL
+  static thread_local v_int32 DEPTH;
+#endif
+public:
+
+  /**
+   * RAII scope enabling pooled allocation on the current thread. Scopes may be nested.
+   */
+  class Scope {
+  public:
+
+    Scope() {
+#ifndef OATPP_COMPAT_BUILD_NO_THREAD_LOCAL
+      ++ DEPTH;
+#endif
+    }
+
+    ~Scope() {
+#ifndef OATPP_COMPAT_BUILD_NO_THREAD_LOCAL
+      -- DEPTH;
+#endif
+    }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+  };
+
+public:
+
+  /**
+   * Check if pooled allocation is enabled on the current thread.
+   * @return - `true` if there is an active &l:PooledAllocation::Scope;.
+   */
+  static bool isEnabled() {
+#ifndef OATPP_COMPAT_BUILD_NO_THREAD_LOCAL
+    return DEPTH > 0;
+#else
+    return false;
+#endif
+  }
+
+  /**
+   * Allocate shared object. Uses &l:PoolAllocator; if pooled allocation is enabled on the current thread.
+   * @tparam T - type of the object to allocate.
+   * @param args - constructor arguments.
+   * @return - `std::shared_ptr<T>`.
+   */
+  template<class T, class ... Args>
+  static std::shared_ptr<T> allocateShared(Args&&... args) {
+    if(isEnabled()) {
+      return std::allocate_shared<T>(PoolAllocator<T>(), std::forward<Args>(args)...);
+    }
+    return std::make_shared<T>(std::forward<Args>(args)...);
+  }
+
+};
+
 /**
  * Extra information for, and about allocation.
  * Used for variable-size objects allocations. (ex.: for strings).
@@ -245,6 +371,56 @@ public:
 
 };
 
+/**
+ * Allocator for shared objects with extras. Allocates object, shared_ptr's control block and extras
+ * in one block of &id:oatpp::base::memory::SlabAllocator;.
+ * @tparam T - type of object to allocate.
+ */
+template<class T>
+class SlabSharedObjectAllocator {
+public:
+  typedef T value_type;
+public:
+  AllocationExtras* m_info;
+  v_buff_size m_extraSize;
+public:
+
+  SlabSharedObjectAllocator(AllocationExtras& info)
+    : m_info(&info)
+    , m_extraSize(info.extraWanted)
+  {};
+
+  template<typename U>
+  SlabSharedObjectAllocator(const SlabSharedObjectAllocator<U>& other)
+    : m_info(other.m_info)
+    , m_extraSize(other.m_extraSize)
+  {}
+
+  T* allocate(std::size_t n) {
+    (void)n;
+    void* mem = SlabAllocator::allocate(sizeof(T) + m_extraSize);
+    m_info->baseSize = sizeof(T);
+    m_info->extraPtr = &((p_char8) mem)[sizeof(T)];
+    return static_cast<T*>(mem);
+  }
+
+  void deallocate(T* ptr, size_t n) {
+    (void)n;
+    SlabAllocator::deallocate(ptr, sizeof(T) + m_extraSize);
+  }
+
+};
+
+template <typename T, typename U>
+inline bool operator == (const SlabSharedObjectAllocator<T>& a, const SlabSharedObjectAllocator<U>& b) {
+  return a.m_extraSize == b.m_extraSize;
+}
+
+template <typename T, typename U>
+inline bool operator != (const SlabSharedObjectAllocator<T>& a, const SlabSharedObjectAllocator<U>& b) {
+  return !(a == b);
+}
+
 template <typename T, typename U>
 inline bool operator == (const SharedObjectAllocator<T>&, const SharedObjectAllocator<U>&) {
   return true;
@@ -262,6 +438,13 @@ static std::shared_ptr<T> allocateSharedWithExtras(AllocationExtras& extras, Arg
   return std::allocate_shared<T, _Allocator>(allocator, args...);
 }
 
+template<typename T, typename ... Args>
+static std::shared_ptr<T> slabAllocateSharedWithExtras(AllocationExtras& extras, Args... args){
+  typedef SlabSharedObjectAllocator<T> _Allocator;
+  _Allocator allocator(extras);
+  return std::allocate_shared<T, _Allocator>(allocator, args...);
+}
+
 template<typename T, typename P, typename ... Args>
 static std::shared_ptr<T> customPoolAllocateSharedWithExtras(AllocationExtras& extras, P& pool, Args... args){
   typedef CustomPoolSharedObjectAllocator<T, P> _Allocator;
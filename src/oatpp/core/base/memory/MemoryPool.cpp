@@ -26,32 +26,121 @@
 #include "oatpp/core/utils/ConversionUtils.hpp"
 #include "oatpp/core/concurrency/Thread.hpp"
 
+#include <algorithm>
+#include <cstdint>
 #include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#if defined(__linux__) && !defined(OATPP_DISABLE_POOL_ALLOCATIONS)
+  #include <sys/mman.h>
+  #define OATPP_POOL_HUGE_PAGES_SUPPORTED
+#endif
 
 namespace oatpp { namespace base { namespace  memory {
 
-MemoryPool::MemoryPool(const std::string& name, v_buff_size entrySize, v_buff_size chunkSize)
-  : m_name(name)
+#ifdef OATPP_POOL_HUGE_PAGES_SUPPORTED
+
+namespace {
+
+  std::atomic<bool> hugeTlbAvailable(true);
+
+  void* mapHugePages(v_buff_size size) {
+
+#ifdef MAP_HUGETLB
+    if(hugeTlbAvailable) {
+      void* mem = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+      if(mem != MAP_FAILED) {
+        return mem;
+      }
+      /* no hugetlb pages reserved in the system - don't try it again */
+      hugeTlbAvailable = false;
+    }
+#endif
+
+    /* map one extra huge page, and unmap unaligned head and tail */
+    const v_buff_size pageSize = MemoryPool::HUGE_PAGE_SIZE;
+    v_buff_size mappedSize = size + pageSize;
+    void* mem = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(mem == MAP_FAILED) {
+      return nullptr;
+    }
+
+    std::uintptr_t start = (std::uintptr_t) mem;
+    std::uintptr_t aligned = (start + pageSize - 1) & ~((std::uintptr_t) pageSize - 1);
+    v_buff_size head = aligned - start;
+    v_buff_size tail = mappedSize - head - size;
+    if(head > 0) {
+      munmap(mem, head);
+    }
+    if(tail > 0) {
+      munmap((void*) (aligned + size), tail);
+    }
+
+#ifdef MADV_HUGEPAGE
+    madvise((void*) aligned, size, MADV_HUGEPAGE);
+#endif
+
+    return (void*) aligned;
+
+  }
+
+}
+
+#endif
+
+MemoryPool::MemoryPool(const std::string& name, v_buff_size entrySize, v_buff_size chunkSize, bool hugePages)
+  : m_owner(nullptr)
+  , m_name(name)
   , m_entrySize(entrySize)
   , m_chunkSize(chunkSize)
+#ifdef OATPP_POOL_HUGE_PAGES_SUPPORTED
+  , m_hugePages(hugePages)
+#else
+  , m_hugePages(false)
+#endif
   , m_id(++poolIdCounter)
   , m_rootEntry(nullptr)
   , m_objectsCount(0)
+  , m_highWaterMark(0)
 {
+  if(m_hugePages) {
+    /* use all space of the huge pages spanned by the chunk */
+    m_chunkSize = (getChunkMemSize() - sizeof(ChunkHeader)) / (sizeof(EntryHeader) + m_entrySize);
+  }
   allocChunk();
   std::lock_guard<oatpp::concurrency::SpinLock> lock(POOLS_SPIN_LOCK);
   POOLS[m_id] = this;
 }
 
 MemoryPool::~MemoryPool() {
+  {
+    std::lock_guard<oatpp::concurrency::SpinLock> lock(POOLS_SPIN_LOCK);
+    POOLS.erase(m_id);
+  }
   auto it = m_chunks.begin();
   while (it != m_chunks.end()) {
-    p_char8 chunk = *it;
-    delete [] chunk;
+    freeChunk(*it);
     it++;
   }
-  std::lock_guard<oatpp::concurrency::SpinLock> lock(POOLS_SPIN_LOCK);
-  POOLS.erase(m_id);
+}
+
+v_buff_size MemoryPool::getChunkMemSize() {
+  v_buff_size size = sizeof(ChunkHeader) + (sizeof(EntryHeader) + m_entrySize) * m_chunkSize;
+  if(m_hugePages) {
+    size = ((size + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE) * HUGE_PAGE_SIZE;
+  }
+  return size;
+}
+
+void MemoryPool::freeChunk(ChunkHeader* chunk) {
+#ifdef OATPP_POOL_HUGE_PAGES_SUPPORTED
+  if(chunk->mapped) {
+    munmap(chunk, getChunkMemSize());
+    return;
+  }
+#endif
+  delete [] (p_char8) chunk;
 }
 
 void MemoryPool::allocChunk() {
@@ -59,11 +148,23 @@ void MemoryPool::allocChunk() {
   // DO NOTHING
 #else
   v_buff_size entryBlockSize = sizeof(EntryHeader) + m_entrySize;
-  v_buff_size chunkMemSize = entryBlockSize * m_chunkSize;
-  p_char8 mem = new v_char8[chunkMemSize];
-  m_chunks.push_back(mem);
+  p_char8 mem = nullptr;
+  bool mapped = false;
+#ifdef OATPP_POOL_HUGE_PAGES_SUPPORTED
+  if(m_hugePages) {
+    mem = (p_char8) mapHugePages(getChunkMemSize());
+    mapped = (mem != nullptr);
+  }
+#endif
+  if(mem == nullptr) {
+    mem = new v_char8[getChunkMemSize()];
+  }
+  ChunkHeader* chunk = new (mem) ChunkHeader(this, m_id);
+  chunk->mapped = mapped;
+  m_chunks.push_back(chunk);
+  mem += sizeof(ChunkHeader);
   for(v_buff_size i = 0; i < m_chunkSize; i++){
-    EntryHeader* entry = new (mem + i * entryBlockSize) EntryHeader(this, m_id, m_rootEntry);
+    EntryHeader* entry = new (mem + i * entryBlockSize) EntryHeader(chunk, m_rootEntry);
     m_rootEntry = entry;
   }
 #endif
@@ -74,43 +175,129 @@ void* MemoryPool::obtain() {
   return new v_char8[m_entrySize];
 #else
   std::lock_guard<oatpp::concurrency::SpinLock> lock(m_lock);
-  if(m_rootEntry != nullptr) {
-    auto entry = m_rootEntry;
-    m_rootEntry = m_rootEntry->next;
-    ++ m_objectsCount;
-    return ((p_char8) entry) + sizeof(EntryHeader);
-  } else {
+  if(m_rootEntry == nullptr) {
     allocChunk();
     if(m_rootEntry == nullptr) {
       throw std::runtime_error("[oatpp::base::memory::MemoryPool:obtain()]: Unable to allocate entry");
     }
-    auto entry = m_rootEntry;
-    m_rootEntry = m_rootEntry->next;
-    ++ m_objectsCount;
-    return ((p_char8) entry) + sizeof(EntryHeader);
   }
+  auto entry = m_rootEntry;
+  m_rootEntry = m_rootEntry->next;
+  ++ entry->chunk->usedCount;
+  if(++ m_objectsCount > m_highWaterMark) {
+    m_highWaterMark = m_objectsCount;
+  }
+  return ((p_char8) entry) + sizeof(EntryHeader);
 #endif
 }
 
 void MemoryPool::freeByEntryHeader(EntryHeader* entry) {
-  if(entry->poolId == m_id) {
+  if(entry->chunk->poolId == m_id) {
     std::lock_guard<oatpp::concurrency::SpinLock> lock(m_lock);
     entry->next = m_rootEntry;
     m_rootEntry = entry;
+    -- entry->chunk->usedCount;
     -- m_objectsCount;
   } else {
     OATPP_LOGD("[oatpp::base::memory::MemoryPool::freeByEntryHeader()]",
-      "Error. Invalid EntryHeader. Expected poolId=%d, entry poolId=%d", m_id, entry->poolId);
+      "Error. Invalid EntryHeader. Expected poolId=%d, entry poolId=%d", m_id, entry->chunk->poolId);
     throw std::runtime_error("[oatpp::base::memory::MemoryPool::freeByEntryHeader()]: Invalid EntryHeader");
   }
 }
 
+v_buff_size MemoryPool::obtainBatch(EntryHeader** entries, v_buff_size count) {
+  std::lock_guard<oatpp::concurrency::SpinLock> lock(m_lock);
+  for(v_buff_size i = 0; i < count; i++) {
+    if(m_rootEntry == nullptr) {
+      allocChunk();
+      if(m_rootEntry == nullptr) {
+        throw std::runtime_error("[oatpp::base::memory::MemoryPool:obtainBatch()]: Unable to allocate entry");
+      }
+    }
+    auto entry = m_rootEntry;
+    m_rootEntry = m_rootEntry->next;
+    ++ entry->chunk->usedCount;
+    entries[i] = entry;
+  }
+  m_objectsCount += count;
+  if(m_objectsCount > m_highWaterMark) {
+    m_highWaterMark = m_objectsCount;
+  }
+  return count;
+}
+
+void MemoryPool::freeBatch(EntryHeader** entries, v_buff_size count) {
+  v_buff_size i = 0;
+  while(i < count) {
+    MemoryPool* pool = entries[i]->chunk->pool;
+    std::lock_guard<oatpp::concurrency::SpinLock> lock(pool->m_lock);
+    while(i < count && entries[i]->chunk->pool == pool) {
+      auto entry = entries[i ++];
+      entry->next = pool->m_rootEntry;
+      pool->m_rootEntry = entry;
+      -- entry->chunk->usedCount;
+      -- pool->m_objectsCount;
+    }
+  }
+}
+
 void MemoryPool::free(void* entry) {
 #ifdef OATPP_DISABLE_POOL_ALLOCATIONS
   delete [] ((p_char8) entry);
 #else
   EntryHeader* header = (EntryHeader*)(((p_char8) entry) - sizeof (EntryHeader));
-  header->pool->freeByEntryHeader(header);
+  MemoryPool* pool = header->chunk->pool;
+  if(pool->m_owner != nullptr) {
+    pool->m_owner->freeToMagazine(header);
+  } else {
+    pool->freeByEntryHeader(header);
+  }
+#endif
+}
+
+v_buff_size MemoryPool::trim() {
+#ifdef OATPP_DISABLE_POOL_ALLOCATIONS
+  return 0;
+#else
+
+  std::lock_guard<oatpp::concurrency::SpinLock> lock(m_lock);
+
+  v_buff_size releaseCount = 0;
+  bool keep = true;
+  for(auto chunk : m_chunks) {
+    if(chunk->usedCount == 0 && !keep) {
+      chunk->released = true;
+      ++ releaseCount;
+    }
+    keep = false;
+  }
+
+  if(releaseCount == 0) {
+    return 0;
+  }
+
+  /* unlink entries of released chunks from the free list */
+  EntryHeader** link = &m_rootEntry;
+  while(*link != nullptr) {
+    if((*link)->chunk->released) {
+      *link = (*link)->next;
+    } else {
+      link = &(*link)->next;
+    }
+  }
+
+  auto it = m_chunks.begin();
+  while (it != m_chunks.end()) {
+    if((*it)->released) {
+      freeChunk(*it);
+      it = m_chunks.erase(it);
+    } else {
+      it++;
+    }
+  }
+
+  return releaseCount * getChunkMemSize();
+
 #endif
 }
 
@@ -123,6 +310,7 @@ v_buff_size MemoryPool::getEntrySize(){
 }
 
 v_buff_size MemoryPool::getSize(){
+  std::lock_guard<oatpp::concurrency::SpinLock> lock(m_lock);
   return m_chunks.size() * m_chunkSize;
 }
 
@@ -130,35 +318,213 @@ v_int64 MemoryPool::getObjectsCount(){
   return m_objectsCount;
 }
 
+MemoryPool::Stats MemoryPool::getStats() {
+  std::lock_guard<oatpp::concurrency::SpinLock> lock(m_lock);
+  Stats stats;
+  stats.name = m_name;
+  stats.entrySize = m_entrySize;
+  stats.chunkSize = m_chunkSize;
+  stats.chunksCount = m_chunks.size();
+  stats.objectsCount = m_objectsCount;
+  stats.highWaterMark = m_highWaterMark;
+  stats.bytesAllocated = stats.chunksCount * getChunkMemSize();
+  stats.hugePageChunksCount = 0;
+  for(auto chunk : m_chunks) {
+    if(chunk->mapped) {
+      ++ stats.hugePageChunksCount;
+    }
+  }
+  return stats;
+}
+
+std::list<MemoryPool::Stats> MemoryPool::getAllPoolsStats() {
+  std::list<Stats> result;
+  std::lock_guard<oatpp::concurrency::SpinLock> lock(POOLS_SPIN_LOCK);
+  for(auto& pair : POOLS) {
+    result.push_back(pair.second->getStats());
+  }
+  return result;
+}
+
+v_buff_size MemoryPool::trimAll() {
+  v_buff_size result = 0;
+  std::lock_guard<oatpp::concurrency::SpinLock> lock(POOLS_SPIN_LOCK);
+  for(auto& pair : POOLS) {
+    result += pair.second->trim();
+  }
+  return result;
+}
+
 oatpp::concurrency::SpinLock MemoryPool::POOLS_SPIN_LOCK;
 std::unordered_map<v_int64, MemoryPool*> MemoryPool::POOLS;
 std::atomic<v_int64> MemoryPool::poolIdCounter(0);
 
+constexpr v_buff_size MemoryPool::HUGE_PAGE_SIZE;
+
+#ifdef OATPP_POOL_HUGE_PAGES
+const bool MemoryPool::HOT_POOLS_HUGE_PAGES = true;
+#else
+const bool MemoryPool::HOT_POOLS_HUGE_PAGES = false;
+#endif
+
 const v_int64 ThreadDistributedMemoryPool::SHARDS_COUNT_DEFAULT = OATPP_THREAD_DISTRIBUTED_MEM_POOL_SHARDS_COUNT;
+constexpr v_buff_size ThreadDistributedMemoryPool::MAGAZINE_MEMORY_SIZE;
+constexpr v_buff_size ThreadDistributedMemoryPool::MAGAZINE_SIZE_MAX;
+
+std::atomic<v_int64> ThreadDistributedMemoryPool::indexCounter(0);
 
 #if defined(OATPP_DISABLE_POOL_ALLOCATIONS) || defined(OATPP_COMPAT_BUILD_NO_THREAD_LOCAL)
-ThreadDistributedMemoryPool::ThreadDistributedMemoryPool(const std::string& name, v_buff_size entrySize, v_buff_size chunkSize, v_int64 shardsCount)
-  : m_shardsCount(1)
+
+ThreadDistributedMemoryPool::ThreadDistributedMemoryPool(const std::string& name, v_buff_size entrySize, v_buff_size chunkSize, v_int64 shardsCount, bool hugePages)
+  : m_index(indexCounter ++)
+  , m_magazineSize(0)
+  , m_shardsCount(1)
   , m_shards(new MemoryPool*[1])
   , m_deleted(false)
 {
   for(v_int64 i = 0; i < m_shardsCount; i++){
-    m_shards[i] = new MemoryPool(name + "_" + oatpp::utils::conversion::int64ToStdStr(i), entrySize, chunkSize);
+    m_shards[i] = new MemoryPool(name + "_" + oatpp::utils::conversion::int64ToStdStr(i), entrySize, chunkSize, hugePages);
+  }
+}
+
+ThreadDistributedMemoryPool::~ThreadDistributedMemoryPool(){
+  m_deleted = true;
+  for(v_int64 i = 0; i < m_shardsCount; i++){
+    delete m_shards[i];
+  }
+  delete [] m_shards;
+}
+
+ThreadDistributedMemoryPool::Magazine* ThreadDistributedMemoryPool::getMagazine() {
+  return nullptr;
+}
+
+void ThreadDistributedMemoryPool::freeToMagazine(MemoryPool::EntryHeader* entry) {
+  entry->chunk->pool->freeByEntryHeader(entry);
+}
+
+void ThreadDistributedMemoryPool::flushMagazine() {
+  // DO NOTHING
+}
+
+void* ThreadDistributedMemoryPool::obtain() {
+  if(m_deleted) {
+    throw std::runtime_error("[oatpp::base::memory::ThreadDistributedMemoryPool::obtain()]. Error. Pool deleted.");
   }
+  return m_shards[0]->obtain();
 }
+
 #else
-ThreadDistributedMemoryPool::ThreadDistributedMemoryPool(const std::string& name, v_buff_size entrySize, v_buff_size chunkSize, v_int64 shardsCount)
-  : m_shardsCount(shardsCount)
+
+namespace {
+
+/*
+ * Indexes of live ThreadDistributedMemoryPools.
+ * Never deleted - threads may exit after static pools are destroyed.
+ */
+oatpp::concurrency::SpinLock& getLivePoolsLock() {
+  static oatpp::concurrency::SpinLock* lock = new oatpp::concurrency::SpinLock();
+  return *lock;
+}
+
+std::unordered_set<v_int64>& getLivePools() {
+  static std::unordered_set<v_int64>* pools = new std::unordered_set<v_int64>();
+  return *pools;
+}
+
+}
+
+class ThreadDistributedMemoryPool::Magazine {
+public:
+
+  Magazine(v_int64 pPoolIndex, v_buff_size size)
+    : poolIndex(pPoolIndex)
+    , entries(new MemoryPool::EntryHeader*[size])
+    , count(0)
+  {}
+
+  ~Magazine() {
+    delete [] entries;
+  }
+
+  const v_int64 poolIndex;
+  MemoryPool::EntryHeader** const entries;
+  v_buff_size count;
+
+};
+
+class ThreadDistributedMemoryPool::ThreadCache {
+private:
+  static thread_local ThreadCache* CURRENT;
+  static thread_local bool DESTROYED;
+public:
+
+  /*
+   * Magazines of this thread indexed by pool index.
+   */
+  std::vector<Magazine*> magazines;
+
+  ~ThreadCache() {
+    CURRENT = nullptr;
+    DESTROYED = true;
+    std::lock_guard<oatpp::concurrency::SpinLock> lock(getLivePoolsLock());
+    const auto& livePools = getLivePools();
+    for(auto magazine : magazines) {
+      if(magazine != nullptr) {
+        if(livePools.find(magazine->poolIndex) != livePools.end()) {
+          MemoryPool::freeBatch(magazine->entries, magazine->count);
+        }
+        delete magazine;
+      }
+    }
+  }
+
+  /*
+   * Get cache of the current thread.
+   * Returns nullptr if called during thread exit after the cache was destroyed.
+   */
+  static ThreadCache* get() {
+    if(CURRENT == nullptr && !DESTROYED) {
+      static thread_local ThreadCache cache;
+      CURRENT = &cache;
+    }
+    return CURRENT;
+  }
+
+};
+
+thread_local ThreadDistributedMemoryPool::ThreadCache* ThreadDistributedMemoryPool::ThreadCache::CURRENT = nullptr;
+thread_local bool ThreadDistributedMemoryPool::ThreadCache::DESTROYED = false;
+
+ThreadDistributedMemoryPool::ThreadDistributedMemoryPool(const std::string& name, v_buff_size entrySize, v_buff_size chunkSize, v_int64 shardsCount, bool hugePages)
+  : m_index(indexCounter ++)
+  , m_magazineSize(std::min<v_buff_size>(MAGAZINE_SIZE_MAX, MAGAZINE_MEMORY_SIZE / entrySize))
+  , m_shardsCount(shardsCount)
   , m_shards(new MemoryPool*[m_shardsCount])
   , m_deleted(false)
 {
+  /* magazine is refilled and flushed by halves - entries too large to keep two of them bypass the magazine */
+  if(m_magazineSize < 2) {
+    m_magazineSize = 0;
+  }
   for(v_int64 i = 0; i < m_shardsCount; i++){
-    m_shards[i] = new MemoryPool(name + "_" + oatpp::utils::conversion::int64ToStdStr(i), entrySize, chunkSize);
+    m_shards[i] = new MemoryPool(name + "_" + oatpp::utils::conversion::int64ToStdStr(i), entrySize, chunkSize, hugePages);
+    m_shards[i]->m_owner = this;
   }
+  std::lock_guard<oatpp::concurrency::SpinLock> lock(getLivePoolsLock());
+  getLivePools().insert(m_index);
 }
-#endif
 
 ThreadDistributedMemoryPool::~ThreadDistributedMemoryPool(){
+  {
+    std::lock_guard<oatpp::concurrency::SpinLock> lock(getLivePoolsLock());
+    getLivePools().erase(m_index);
+  }
+  auto cache = ThreadCache::get();
+  if(cache != nullptr && m_index < (v_int64) cache->magazines.size()) {
+    delete cache->magazines[m_index];
+    cache->magazines[m_index] = nullptr;
+  }
   m_deleted = true;
   for(v_int64 i = 0; i < m_shardsCount; i++){
     delete m_shards[i];
@@ -166,22 +532,74 @@ ThreadDistributedMemoryPool::~ThreadDistributedMemoryPool(){
   delete [] m_shards;
 }
 
-#if defined(OATPP_DISABLE_POOL_ALLOCATIONS) || defined(OATPP_COMPAT_BUILD_NO_THREAD_LOCAL)
-void* ThreadDistributedMemoryPool::obtain() {
-  if(m_deleted) {
-    throw std::runtime_error("[oatpp::base::memory::ThreadDistributedMemoryPool::obtain()]. Error. Pool deleted.");
+ThreadDistributedMemoryPool::Magazine* ThreadDistributedMemoryPool::getMagazine() {
+  if(m_magazineSize == 0) {
+    return nullptr;
   }
-  return m_shards[0]->obtain();
+  auto cache = ThreadCache::get();
+  if(cache == nullptr) {
+    return nullptr;
+  }
+  if(m_index >= (v_int64) cache->magazines.size()) {
+    cache->magazines.resize(m_index + 1, nullptr);
+  }
+  auto& magazine = cache->magazines[m_index];
+  if(magazine == nullptr) {
+    magazine = new Magazine(m_index, m_magazineSize);
+  }
+  return magazine;
 }
-#else
+
+void ThreadDistributedMemoryPool::freeToMagazine(MemoryPool::EntryHeader* entry) {
+  auto magazine = getMagazine();
+  if(magazine == nullptr) {
+    entry->chunk->pool->freeByEntryHeader(entry);
+    return;
+  }
+  if(magazine->count == m_magazineSize) {
+    /* return the older half to the owning shards */
+    v_buff_size half = m_magazineSize / 2;
+    MemoryPool::freeBatch(magazine->entries, half);
+    std::memmove(magazine->entries, magazine->entries + half, (magazine->count - half) * sizeof(MemoryPool::EntryHeader*));
+    magazine->count -= half;
+  }
+  magazine->entries[magazine->count ++] = entry;
+}
+
+void ThreadDistributedMemoryPool::flushMagazine() {
+  auto magazine = getMagazine();
+  if(magazine != nullptr) {
+    MemoryPool::freeBatch(magazine->entries, magazine->count);
+    magazine->count = 0;
+  }
+}
+
 void* ThreadDistributedMemoryPool::obtain() {
   if(m_deleted) {
     throw std::runtime_error("[oatpp::base::memory::ThreadDistributedMemoryPool::obtain()]. Error. Pool deleted.");
   }
   static std::atomic<v_uint16> base(0);
   static thread_local v_int16 index = (++base) % m_shardsCount;
-  return m_shards[index]->obtain();
+  auto magazine = getMagazine();
+  if(magazine == nullptr) {
+    return m_shards[index]->obtain();
+  }
+  if(magazine->count == 0) {
+    magazine->count = m_shards[index]->obtainBatch(magazine->entries, m_magazineSize / 2);
+  }
+  auto entry = magazine->entries[-- magazine->count];
+  return ((p_char8) entry) + sizeof(MemoryPool::EntryHeader);
 }
+
 #endif
+
+v_buff_size ThreadDistributedMemoryPool::trim() {
+  flushMagazine();
+  v_buff_size result = 0;
+  for(v_int64 i = 0; i < m_shardsCount; i++){
+    result += m_shards[i]->trim();
+  }
+  return result;
+}
   
 }}}
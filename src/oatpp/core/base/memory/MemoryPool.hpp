@@ -34,44 +34,136 @@
 
 namespace oatpp { namespace base { namespace  memory {
 
+class ThreadDistributedMemoryPool;
+
 /**
  * Memory Pool allocates memory chunks. Each chunk consists of specified number of fixed-size entries.
  * Entries can be obtained and freed by user. When memory pool runs out of free entries, new chunk is allocated.
+ * Chunks with no entries in use can be returned to the system with &l:MemoryPool::trim ();. <br>
+ * Optionally chunks can be backed by huge pages - see &l:MemoryPool::MemoryPool ();.
  */
 class MemoryPool {
+  friend ThreadDistributedMemoryPool;
+public:
+
+  /**
+   * Memory pool statistics.
+   */
+  struct Stats {
+
+    /**
+     * Name of the memory pool.
+     */
+    std::string name;
+
+    /**
+     * Size of the memory entry in bytes.
+     */
+    v_buff_size entrySize;
+
+    /**
+     * Number of entries in one chunk.
+     */
+    v_buff_size chunkSize;
+
+    /**
+     * Number of chunks currently allocated.
+     */
+    v_buff_size chunksCount;
+
+    /**
+     * Number of entries currently in use.
+     * For shards of &l:ThreadDistributedMemoryPool; includes entries cached by threads.
+     */
+    v_int64 objectsCount;
+
+    /**
+     * Maximum number of entries which were in use at the same time.
+     */
+    v_int64 highWaterMark;
+
+    /**
+     * Total number of bytes allocated by the pool.
+     */
+    v_buff_size bytesAllocated;
+
+    /**
+     * Number of chunks currently allocated which are backed by huge pages.
+     */
+    v_buff_size hugePageChunksCount;
+
+  };
+
+public:
+
+  /**
+   * Size of the huge page. Chunks of pools with huge pages enabled span whole huge pages.
+   */
+  static constexpr v_buff_size HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+  /**
+   * Whether hot oatpp pools (such as IOBuffer pool) are created with huge pages enabled. <br>
+   * `true` if built with `OATPP_POOL_HUGE_PAGES` flag.
+   */
+  static const bool HOT_POOLS_HUGE_PAGES;
+
 public:
   static oatpp::concurrency::SpinLock POOLS_SPIN_LOCK;
   static std::unordered_map<v_int64, MemoryPool*> POOLS;
 private:
   static std::atomic<v_int64> poolIdCounter;
 private:
+
+  class ChunkHeader {
+  public:
+
+    ChunkHeader(MemoryPool* pPool, v_int64 pPoolId)
+      : pool(pPool)
+      , poolId(pPoolId)
+      , usedCount(0)
+      , released(false)
+      , mapped(false)
+    {}
+
+    MemoryPool* pool;
+    v_int64 poolId;
+    v_buff_size usedCount;
+    bool released;
+    bool mapped;
+
+  };
   
   class EntryHeader {
   public:
     
-    EntryHeader(MemoryPool* pPool, v_int64 pPoolId, EntryHeader* pNext)
-      : pool(pPool)
-      , poolId(pPoolId)
+    EntryHeader(ChunkHeader* pChunk, EntryHeader* pNext)
+      : chunk(pChunk)
       , next(pNext)
     {}
     
-    MemoryPool* pool;
-    v_int64 poolId;
+    ChunkHeader* chunk;
     EntryHeader* next;
     
   };
   
 private:
   void allocChunk();
+  void freeChunk(ChunkHeader* chunk);
   void freeByEntryHeader(EntryHeader* entry);
+  v_buff_size getChunkMemSize();
+  v_buff_size obtainBatch(EntryHeader** entries, v_buff_size count);
+  static void freeBatch(EntryHeader** entries, v_buff_size count);
 private:
+  ThreadDistributedMemoryPool* m_owner;
   std::string m_name;
   v_buff_size m_entrySize;
   v_buff_size m_chunkSize;
+  bool m_hugePages;
   v_int64 m_id;
-  std::list<p_char8> m_chunks;
+  std::list<ChunkHeader*> m_chunks;
   EntryHeader* m_rootEntry;
   v_int64 m_objectsCount;
+  v_int64 m_highWaterMark;
   oatpp::concurrency::SpinLock m_lock;
 public:
 
@@ -80,8 +172,11 @@ public:
    * @param name - name of the pool.
    * @param entrySize - size of the entry in bytes returned in call to &l:MemoryPool::obtain ();.
    * @param chunkSize - number of entries in one chunk.
+   * @param hugePages - allocate chunks with `mmap` and back them by huge pages (Linux only). <br>
+   * Chunk size is then extended so that each chunk spans whole huge pages (&l:MemoryPool::HUGE_PAGE_SIZE;). <br>
+   * Explicit hugetlb pages are tried first, then transparent huge pages (`MADV_HUGEPAGE`), then regular heap allocation.
    */
-  MemoryPool(const std::string& name, v_buff_size entrySize, v_buff_size chunkSize);
+  MemoryPool(const std::string& name, v_buff_size entrySize, v_buff_size chunkSize, bool hugePages = false);
 
   /**
    * Deleted copy-constructor.
@@ -107,6 +202,12 @@ public:
    */
   static void free(void* entry);
 
+  /**
+   * Release chunks which have no entries in use. One chunk is always kept.
+   * @return - number of bytes released.
+   */
+  v_buff_size trim();
+
   /**
    * Get name of the memory pool.
    * @return - memory pool name as `std::string`.
@@ -130,14 +231,55 @@ public:
    * @return - number of entries currently in use.
    */
   v_int64 getObjectsCount();
+
+  /**
+   * Get statistics of the memory pool.
+   * @return - &l:MemoryPool::Stats;.
+   */
+  Stats getStats();
+
+public:
+
+  /**
+   * Get statistics of all live memory pools.
+   * @return - `std::list` of &l:MemoryPool::Stats;.
+   */
+  static std::list<Stats> getAllPoolsStats();
+
+  /**
+   * Call &l:MemoryPool::trim (); on all live memory pools.
+   * @return - total number of bytes released.
+   */
+  static v_buff_size trimAll();
   
 };
 
 /**
  * Creates multiple MemoryPools (&l:MemoryPool;) to reduce concurrency blocking in call to &l:ThreadDistributedMemoryPool::obtain ();
+ * <br>
+ * Each thread keeps a small cache (magazine) of free entries in front of the shards.
+ * Entries are taken from the thread's shard and returned to their owning shards in batches,
+ * so most of obtain/free calls don't take any lock. <br>
+ * A magazine holds at most 32KB of entries per pool per thread.
+ * Pools with entries larger than 16KB have no magazines. <br>
+ * *If built with OATPP_COMPAT_BUILD_NO_THREAD_LOCAL flag - thread caches are disabled.*
  */
 class ThreadDistributedMemoryPool {
+  friend MemoryPool;
+private:
+  class Magazine;
+  class ThreadCache;
+private:
+  static constexpr v_buff_size MAGAZINE_MEMORY_SIZE = 32 * 1024;
+  static constexpr v_buff_size MAGAZINE_SIZE_MAX = 64;
+  static std::atomic<v_int64> indexCounter;
+private:
+  Magazine* getMagazine();
+  void freeToMagazine(MemoryPool::EntryHeader* entry);
+  void flushMagazine();
 private:
+  v_int64 m_index;
+  v_buff_size m_magazineSize;
   v_int64 m_shardsCount;
   MemoryPool** m_shards;
   bool m_deleted;
@@ -155,9 +297,10 @@ public:
    * @param entrySize - size of memory pool entry.
    * @param chunkSize - number of entries in chunk.
    * @param shardsCount - number of MemoryPools (&l:MemoryPool;) "shards" to create.
+   * @param hugePages - back chunks of shards by huge pages. See &l:MemoryPool::MemoryPool ();.
    */
   ThreadDistributedMemoryPool(const std::string& name, v_buff_size entrySize, v_buff_size chunkSize,
-                              v_int64 shardsCount = SHARDS_COUNT_DEFAULT);
+                              v_int64 shardsCount = SHARDS_COUNT_DEFAULT, bool hugePages = false);
 
   /**
    * Deleted copy-constructor.
@@ -173,6 +316,12 @@ public:
    */
   void* obtain();
 
+  /**
+   * Return entries cached by the calling thread and call &l:MemoryPool::trim (); on all shards.
+   * @return - number of bytes released.
+   */
+  v_buff_size trim();
+
 };
 
 /**
@@ -0,0 +1,63 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "MemoryPoolTrimmer.hpp"
+
+namespace oatpp { namespace base { namespace memory {
+
+MemoryPoolTrimmer::MemoryPoolTrimmer(const std::chrono::duration<v_int64, std::micro>& interval)
+  : m_interval(interval)
+  , m_running(true)
+  , m_thread(&MemoryPoolTrimmer::run, this)
+{}
+
+MemoryPoolTrimmer::~MemoryPoolTrimmer() {
+  stop();
+}
+
+void MemoryPoolTrimmer::run() {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while(m_running) {
+    m_condition.wait_for(lock, m_interval);
+    if(m_running) {
+      v_buff_size released = MemoryPool::trimAll();
+      if(released > 0) {
+        OATPP_LOGD("[oatpp::base::memory::MemoryPoolTrimmer::run()]", "Released %lld bytes", (long long) released);
+      }
+    }
+  }
+}
+
+void MemoryPoolTrimmer::stop() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_running = false;
+  }
+  m_condition.notify_one();
+  if(m_thread.joinable()) {
+    m_thread.join();
+  }
+}
+
+}}}
@@ -0,0 +1,78 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_base_memory_MemoryPoolTrimmer_hpp
+#define oatpp_base_memory_MemoryPoolTrimmer_hpp
+
+#include "./MemoryPool.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace oatpp { namespace base { namespace memory {
+
+/**
+ * Background policy which periodically returns unused chunks of all live memory pools to the system.
+ * See &id:oatpp::base::memory::MemoryPool::trimAll;. <br>
+ * Background thread is started in constructor and stopped in destructor.
+ */
+class MemoryPoolTrimmer {
+private:
+  std::chrono::duration<v_int64, std::micro> m_interval;
+  bool m_running;
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+  std::thread m_thread;
+private:
+  void run();
+public:
+
+  /**
+   * Constructor.
+   * @param interval - interval between trims.
+   */
+  MemoryPoolTrimmer(const std::chrono::duration<v_int64, std::micro>& interval = std::chrono::seconds(10));
+
+  /**
+   * Deleted copy-constructor.
+   */
+  MemoryPoolTrimmer(const MemoryPoolTrimmer&) = delete;
+
+  /**
+   * Non-virtual destructor. Calls &l:MemoryPoolTrimmer::stop ();.
+   */
+  ~MemoryPoolTrimmer();
+
+  /**
+   * Stop background thread and wait for it to finish.
+   */
+  void stop();
+
+};
+
+}}}
+
+#endif /* oatpp_base_memory_MemoryPoolTrimmer_hpp */
@@ -0,0 +1,109 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "SlabAllocator.hpp"
+
+#include "oatpp/core/utils/ConversionUtils.hpp"
+
+#include <mutex>
+
+namespace oatpp { namespace base { namespace memory {
+
+constexpr v_buff_size SlabAllocator::MIN_CLASS_SIZE;
+constexpr v_buff_size SlabAllocator::MAX_CLASS_SIZE;
+constexpr v_int32 SlabAllocator::CLASSES_COUNT;
+
+v_int32 SlabAllocator::getClassIndex(v_buff_size size) {
+
+  if(size <= MIN_CLASS_SIZE) {
+    return 0;
+  }
+
+  /* power - the highest power of two less than size */
+  v_buff_size power = MIN_CLASS_SIZE;
+  v_int32 index = 0;
+  while((power << 1) < size) {
+    power <<= 1;
+    index += 2;
+  }
+
+  if(size <= power + (power >> 1)) {
+    return index + 1;
+  }
+  return index + 2;
+
+}
+
+v_buff_size SlabAllocator::getClassSize(v_int32 classIndex) {
+  v_buff_size power = MIN_CLASS_SIZE << (classIndex >> 1);
+  if(classIndex & 1) {
+    return power + (power >> 1);
+  }
+  return power;
+}
+
+ThreadDistributedMemoryPool& SlabAllocator::getPool(v_int32 classIndex) {
+
+  /* Never deleted - blocks may be freed during static destruction */
+  static std::atomic<ThreadDistributedMemoryPool*>* pools = new std::atomic<ThreadDistributedMemoryPool*>[CLASSES_COUNT]();
+  static std::mutex* mutex = new std::mutex();
+
+  auto pool = pools[classIndex].load(std::memory_order_acquire);
+  if(pool == nullptr) {
+    std::lock_guard<std::mutex> lock(*mutex);
+    pool = pools[classIndex].load(std::memory_order_relaxed);
+    if(pool == nullptr) {
+      v_buff_size classSize = getClassSize(classIndex);
+      v_buff_size chunkSize = MAX_CLASS_SIZE / classSize;
+      pool = new ThreadDistributedMemoryPool("Slab_" + oatpp::utils::conversion::int64ToStdStr(classSize), classSize, chunkSize);
+      pools[classIndex].store(pool, std::memory_order_release);
+    }
+  }
+  return *pool;
+
+}
+
+v_buff_size SlabAllocator::getCapacity(v_buff_size size) {
+  if(size > MAX_CLASS_SIZE) {
+    return size;
+  }
+  return getClassSize(getClassIndex(size));
+}
+
+void* SlabAllocator::allocate(v_buff_size size) {
+  if(size > MAX_CLASS_SIZE) {
+    return ::operator new(size);
+  }
+  return getPool(getClassIndex(size)).obtain();
+}
+
+void SlabAllocator::deallocate(void* ptr, v_buff_size size) {
+  if(size > MAX_CLASS_SIZE) {
+    ::operator delete(ptr);
+  } else {
+    MemoryPool::free(ptr);
+  }
+}
+
+}}}
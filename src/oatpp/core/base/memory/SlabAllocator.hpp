@@ -0,0 +1,89 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_base_memory_SlabAllocator_hpp
+#define oatpp_base_memory_SlabAllocator_hpp
+
+#include "./MemoryPool.hpp"
+
+namespace oatpp { namespace base { namespace memory {
+
+/**
+ * Allocator of variable-size memory blocks. <br>
+ * Requested sizes are rounded up to size classes - powers of two and midpoints between them
+ * (64, 96, 128, 192, 256, 384, ... 48K, 64K). <br>
+ * Each size class is a &id:oatpp::base::memory::ThreadDistributedMemoryPool; whose per-thread magazines
+ * serve as thread caches and whose shards serve as the central depot.
+ * Blocks larger than &l:SlabAllocator::MAX_CLASS_SIZE; are allocated with `::operator new`.
+ */
+class SlabAllocator {
+public:
+
+  /**
+   * Size of the smallest size class.
+   */
+  static constexpr v_buff_size MIN_CLASS_SIZE = 64;
+
+  /**
+   * Size of the largest size class.
+   */
+  static constexpr v_buff_size MAX_CLASS_SIZE = 64 * 1024;
+
+  /**
+   * Number of size classes.
+   */
+  static constexpr v_int32 CLASSES_COUNT = 21;
+
+private:
+  static v_int32 getClassIndex(v_buff_size size);
+  static v_buff_size getClassSize(v_int32 classIndex);
+  static ThreadDistributedMemoryPool& getPool(v_int32 classIndex);
+public:
+
+  /**
+   * Get size of the block which will be actually allocated for the requested size.
+   * @param size - requested size.
+   * @return - size of the size class or `size` if it is greater than &l:SlabAllocator::MAX_CLASS_SIZE;.
+   */
+  static v_buff_size getCapacity(v_buff_size size);
+
+  /**
+   * Allocate memory block.
+   * @param size - size of the block.
+   * @return - pointer to the block.
+   */
+  static void* allocate(v_buff_size size);
+
+  /**
+   * Free memory block.
+   * @param ptr - pointer obtained by call to &l:SlabAllocator::allocate ();.
+   * @param size - size passed to &l:SlabAllocator::allocate (); or any other size within the same size class.
+   */
+  static void deallocate(void* ptr, v_buff_size size);
+
+};
+
+}}}
+
+#endif /* oatpp_base_memory_SlabAllocator_hpp */
@@ -0,0 +1,299 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "BufferChain.hpp"
+
+#include <cstring>
+
+namespace oatpp { namespace data { namespace buffer {
+
+constexpr v_buff_size BufferChain::COALESCE_SLICE_MAX_SIZE;
+
+BufferChain::BufferChain()
+  : m_size(0)
+{}
+
+std::shared_ptr<BufferChain> BufferChain::createShared() {
+  return std::make_shared<BufferChain>();
+}
+
+void BufferChain::append(const std::shared_ptr<void>& owner, const void* data, v_buff_size size) {
+  if(size > 0) {
+    m_slices.push_back({owner, (p_char8) data, size});
+    m_size += size;
+  }
+}
+
+void BufferChain::append(const oatpp::String& string) {
+  if(string) {
+    append(string.getPtr(), string->getData(), string->getSize());
+  }
+}
+
+void BufferChain::append(const data::share::MemoryLabel& label) {
+  append(label.getMemoryHandle(), label.getData(), label.getSize());
+}
+
+void BufferChain::append(const std::shared_ptr<IOBuffer>& buffer, v_buff_size size) {
+  if(size > buffer->getSize()) {
+    throw std::runtime_error("[oatpp::data::buffer::BufferChain::append()]: Error. Size exceeds IOBuffer size.");
+  }
+  append(buffer, buffer->getData(), size);
+}
+
+void BufferChain::append(const std::shared_ptr<data::stream::ChunkedBuffer>& buffer) {
+  auto chunks = buffer->getChunks();
+  auto curr = chunks->getFirstNode();
+  while(curr != nullptr) {
+    append(buffer, curr->getData()->data, curr->getData()->size);
+    curr = curr->getNext();
+  }
+}
+
+void BufferChain::append(const BufferChain& chain) {
+  m_slices.insert(m_slices.end(), chain.m_slices.begin(), chain.m_slices.end());
+  m_size += chain.m_size;
+}
+
+void BufferChain::appendStatic(const void* data, v_buff_size size) {
+  append(nullptr, data, size);
+}
+
+void BufferChain::clear() {
+  m_slices.clear();
+  m_size = 0;
+}
+
+v_buff_size BufferChain::getSize() const {
+  return m_size;
+}
+
+const std::vector<BufferChain::Slice>& BufferChain::getSlices() const {
+  return m_slices;
+}
+
+v_buff_size BufferChain::copyTo(v_buff_size offset, void* buffer, v_buff_size count) const {
+
+  v_buff_size copied = 0;
+
+  for(const auto& slice : m_slices) {
+
+    if(copied == count) {
+      break;
+    }
+
+    if(offset >= slice.size) {
+      offset -= slice.size;
+      continue;
+    }
+
+    v_buff_size size = slice.size - offset;
+    if(size > count - copied) {
+      size = count - copied;
+    }
+
+    std::memcpy((p_char8) buffer + copied, slice.data + offset, size);
+    copied += size;
+    offset = 0;
+
+  }
+
+  return copied;
+
+}
+
+oatpp::String BufferChain::toString() const {
+  oatpp::String result(m_size);
+  copyTo(0, result->getData(), m_size);
+  return result;
+}
+
+v_buff_size BufferChain::getCoalescedRunEnd(v_buff_size index, v_buff_size bufferSize, bool skipOwned) const {
+  v_buff_size size = 0;
+  while(index < (v_buff_size) m_slices.size()) {
+    const Slice& slice = m_slices[index];
+    if(slice.size > COALESCE_SLICE_MAX_SIZE || size + slice.size > bufferSize || (skipOwned && slice.owner)) {
+      break;
+    }
+    size += slice.size;
+    ++ index;
+  }
+  return index;
+}
+
+v_buff_size BufferChain::copyRun(v_buff_size begin, v_buff_size end, p_char8 buffer) const {
+  v_buff_size size = 0;
+  for(v_buff_size i = begin; i < end; i ++) {
+    const Slice& slice = m_slices[i];
+    std::memcpy(buffer + size, slice.data, slice.size);
+    size += slice.size;
+  }
+  return size;
+}
+
+v_io_size BufferChain::flushToStream(data::stream::OutputStream* stream) const {
+
+  SliceOutput* sliceOutput = dynamic_cast<SliceOutput*>(stream);
+  if(sliceOutput != nullptr && !sliceOutput->canAdoptSlices()) {
+    sliceOutput = nullptr;
+  }
+
+  std::shared_ptr<IOBuffer> buffer;
+  v_io_size result = 0;
+  v_buff_size index = 0;
+
+  while(index < (v_buff_size) m_slices.size()) {
+
+    const Slice& slice = m_slices[index];
+    v_buff_size size;
+    v_io_size res;
+
+    if(sliceOutput != nullptr && slice.owner) {
+      async::Action action;
+      size = slice.size;
+      res = sliceOutput->writeSlice(slice, action);
+      ++ index;
+    } else {
+      v_buff_size runEnd = getCoalescedRunEnd(index, IOBuffer::BUFFER_SIZE, sliceOutput != nullptr);
+      if(runEnd - index > 1) {
+        if(!buffer) {
+          buffer = IOBuffer::createShared();
+        }
+        size = copyRun(index, runEnd, (p_char8) buffer->getData());
+        res = stream->writeExactSizeDataSimple(buffer->getData(), size);
+        index = runEnd;
+      } else {
+        size = slice.size;
+        res = stream->writeExactSizeDataSimple(slice.data, slice.size);
+        ++ index;
+      }
+    }
+
+    if(res != size) {
+      return result + (res > 0 ? res : 0);
+    }
+    result += res;
+
+  }
+
+  return result;
+
+}
+
+async::CoroutineStarter BufferChain::flushToStreamAsync(const std::shared_ptr<data::stream::OutputStream>& stream) const {
+
+  class FlushCoroutine : public async::Coroutine<FlushCoroutine> {
+  private:
+    const BufferChain* m_chain;
+    std::shared_ptr<data::stream::OutputStream> m_stream;
+    SliceOutput* m_sliceOutput;
+    std::shared_ptr<IOBuffer> m_buffer;
+    v_buff_size m_index;
+  public:
+
+    FlushCoroutine(const BufferChain* chain, const std::shared_ptr<data::stream::OutputStream>& stream, SliceOutput* sliceOutput)
+      : m_chain(chain)
+      , m_stream(stream)
+      , m_sliceOutput(sliceOutput)
+      , m_index(0)
+    {}
+
+    Action act() override {
+
+      if(m_index >= (v_buff_size) m_chain->m_slices.size()) {
+        return finish();
+      }
+
+      const Slice& slice = m_chain->m_slices[m_index];
+
+      if(m_sliceOutput == nullptr || !slice.owner) {
+        v_buff_size runEnd = m_chain->getCoalescedRunEnd(m_index, IOBuffer::BUFFER_SIZE, m_sliceOutput != nullptr);
+        if(runEnd - m_index > 1) {
+          if(!m_buffer) {
+            m_buffer = IOBuffer::createShared();
+          }
+          v_buff_size size = m_chain->copyRun(m_index, runEnd, (p_char8) m_buffer->getData());
+          m_index = runEnd;
+          return m_stream->writeExactSizeDataAsync(m_buffer->getData(), size).next(repeat());
+        }
+        ++ m_index;
+        return m_stream->writeExactSizeDataAsync(slice.data, slice.size).next(repeat());
+      }
+
+      Action action;
+      auto res = m_sliceOutput->writeSlice(slice, action);
+      if(!action.isNone()) {
+        return action;
+      }
+      if(res != slice.size) {
+        return error<async::Error>("[oatpp::data::buffer::BufferChain::flushToStreamAsync()]: Error. Slice handoff failed.");
+      }
+
+      ++ m_index;
+      return repeat();
+
+    }
+
+  };
+
+  SliceOutput* sliceOutput = dynamic_cast<SliceOutput*>(stream.get());
+  if(sliceOutput != nullptr && !sliceOutput->canAdoptSlices()) {
+    sliceOutput = nullptr;
+  }
+
+  return FlushCoroutine::start(this, stream, sliceOutput);
+
+}
+
+#if !defined(WIN32) && !defined(_WIN32)
+
+v_buff_size BufferChain::getIOVec(v_buff_size offset, struct iovec* vec, v_buff_size maxCount) const {
+
+  v_buff_size count = 0;
+
+  for(const auto& slice : m_slices) {
+
+    if(count == maxCount) {
+      break;
+    }
+
+    if(offset >= slice.size) {
+      offset -= slice.size;
+      continue;
+    }
+
+    vec[count].iov_base = slice.data + offset;
+    vec[count].iov_len = (size_t) (slice.size - offset);
+    ++ count;
+    offset = 0;
+
+  }
+
+  return count;
+
+}
+
+#endif
+
+}}}
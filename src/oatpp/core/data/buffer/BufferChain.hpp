@@ -0,0 +1,244 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_data_buffer_BufferChain_hpp
+#define oatpp_data_buffer_BufferChain_hpp
+
+#include "IOBuffer.hpp"
+
+#include "oatpp/core/data/stream/ChunkedBuffer.hpp"
+#include "oatpp/core/data/share/MemoryLabel.hpp"
+
+#include <vector>
+
+#if !defined(WIN32) && !defined(_WIN32)
+  #include <sys/uio.h>
+#endif
+
+namespace oatpp { namespace data { namespace buffer {
+
+/**
+ * Chain of refcounted memory slices. <br>
+ * Slices reference memory of the existing buffers (&id:oatpp::String;, &id:oatpp::data::buffer::IOBuffer;,
+ * &id:oatpp::data::stream::ChunkedBuffer; chunks, static memory, or any memory kept alive by a shared owner) without copying it.
+ * Chain keeps the owners alive while it is alive. <br>
+ * Chain can be written to a stream slice by slice, or exposed as an `iovec` array for `writev`.
+ */
+class BufferChain : public oatpp::base::Countable {
+public:
+
+  /**
+   * Slices of this size or smaller are copied into a write buffer when flushed to a stream,
+   * so that a run of small slices is written with one call. Larger slices are written as is.
+   */
+  static constexpr v_buff_size COALESCE_SLICE_MAX_SIZE = 1024;
+
+  /**
+   * Slice of memory.
+   */
+  struct Slice {
+
+    /**
+     * Object which keeps the slice memory alive. `nullptr` for static memory.
+     */
+    std::shared_ptr<void> owner;
+
+    /**
+     * Pointer to the slice data.
+     */
+    p_char8 data;
+
+    /**
+     * Size of the slice in bytes.
+     */
+    v_buff_size size;
+
+  };
+
+private:
+  std::vector<Slice> m_slices;
+  v_buff_size m_size;
+private:
+  v_buff_size getCoalescedRunEnd(v_buff_size index, v_buff_size bufferSize, bool skipOwned) const;
+  v_buff_size copyRun(v_buff_size begin, v_buff_size end, p_char8 buffer) const;
+public:
+
+  /**
+   * Constructor.
+   */
+  BufferChain();
+
+  /**
+   * Create shared BufferChain.
+   * @return - `std::shared_ptr` to BufferChain.
+   */
+  static std::shared_ptr<BufferChain> createShared();
+
+  /**
+   * Append memory kept alive by the `owner`. Data is not copied.
+   * @param owner - object which keeps memory alive. `nullptr` for static memory.
+   * @param data - pointer to data.
+   * @param size - size of the data.
+   */
+  void append(const std::shared_ptr<void>& owner, const void* data, v_buff_size size);
+
+  /**
+   * Append string. Data is not copied.
+   * @param string - &id:oatpp::String;.
+   */
+  void append(const oatpp::String& string);
+
+  /**
+   * Append memory label. Data is not copied.
+   * @param label - &id:oatpp::data::share::MemoryLabel;.
+   */
+  void append(const data::share::MemoryLabel& label);
+
+  /**
+   * Append first `size` bytes of IOBuffer. Data is not copied.
+   * @param buffer - &id:oatpp::data::buffer::IOBuffer;.
+   * @param size - number of bytes of the buffer to append.
+   */
+  void append(const std::shared_ptr<IOBuffer>& buffer, v_buff_size size);
+
+  /**
+   * Append chunks of ChunkedBuffer. Data is not copied. <br>
+   * *ChunkedBuffer must not be modified while chain is in use.*
+   * @param buffer - &id:oatpp::data::stream::ChunkedBuffer;.
+   */
+  void append(const std::shared_ptr<data::stream::ChunkedBuffer>& buffer);
+
+  /**
+   * Append slices of other chain. Data is not copied.
+   * @param chain - other chain.
+   */
+  void append(const BufferChain& chain);
+
+  /**
+   * Append static memory. Data is not copied. Memory must outlive the chain.
+   * @param data - pointer to data.
+   * @param size - size of the data.
+   */
+  void appendStatic(const void* data, v_buff_size size);
+
+  /**
+   * Remove all slices.
+   */
+  void clear();
+
+  /**
+   * Get total size of the chain in bytes.
+   * @return - size in bytes.
+   */
+  v_buff_size getSize() const;
+
+  /**
+   * Get slices of the chain.
+   * @return - `std::vector` of &l:BufferChain::Slice;.
+   */
+  const std::vector<Slice>& getSlices() const;
+
+  /**
+   * Copy `count` bytes starting from `offset` to the buffer.
+   * @param offset - offset in the chain.
+   * @param buffer - buffer to copy data to.
+   * @param count - size of the buffer.
+   * @return - number of bytes copied.
+   */
+  v_buff_size copyTo(v_buff_size offset, void* buffer, v_buff_size count) const;
+
+  /**
+   * Copy the whole chain to a new &id:oatpp::String;.
+   * @return - &id:oatpp::String;.
+   */
+  oatpp::String toString() const;
+
+  /**
+   * Write chain to the stream. Large slices are written without copy. <br>
+   * Runs of small slices (see &l:BufferChain::COALESCE_SLICE_MAX_SIZE;) are copied into a write buffer and written at once. <br>
+   * If the stream is a &l:SliceOutput; which can adopt slices, slices having an owner are handed over to the stream by reference.
+   * @param stream - &id:oatpp::data::stream::OutputStream;.
+   * @return - number of bytes written.
+   */
+  v_io_size flushToStream(data::stream::OutputStream* stream) const;
+
+  /**
+   * Get coroutine starter which writes chain to the stream. Large slices are written without copy. <br>
+   * Runs of small slices (see &l:BufferChain::COALESCE_SLICE_MAX_SIZE;) are copied into a write buffer and written at once. <br>
+   * If the stream is a &l:SliceOutput; which can adopt slices, slices having an owner are handed over to the stream by reference. <br>
+   * *Chain must stay alive and unmodified until the coroutine is finished.*
+   * @param stream - &id:oatpp::data::stream::OutputStream;.
+   * @return - &id:oatpp::async::CoroutineStarter;.
+   */
+  async::CoroutineStarter flushToStreamAsync(const std::shared_ptr<data::stream::OutputStream>& stream) const;
+
+#if !defined(WIN32) && !defined(_WIN32)
+
+  /**
+   * Fill `iovec` array with slices of the chain starting from `offset`. <br>
+   * Use `offset` to continue after a partial `writev`.
+   * @param offset - offset in the chain.
+   * @param vec - `iovec` array.
+   * @param maxCount - size of the `iovec` array.
+   * @return - number of `iovec` entries filled.
+   */
+  v_buff_size getIOVec(v_buff_size offset, struct iovec* vec, v_buff_size maxCount) const;
+
+#endif
+
+};
+
+/**
+ * Output which can take ownership of refcounted slices instead of copying their data. <br>
+ * Implemented by streams next to &id:oatpp::data::stream::OutputStream; - ex.: &id:oatpp::network::virtual_::Socket;.
+ */
+class SliceOutput {
+public:
+
+  /**
+   * Default virtual destructor.
+   */
+  virtual ~SliceOutput() = default;
+
+  /**
+   * Check if this output currently adopts slices. If not, data should be written the regular way.
+   * @return - `true` if slices are adopted without copy.
+   */
+  virtual bool canAdoptSlices() = 0;
+
+  /**
+   * Hand the slice over to the output. Output keeps a reference to the slice owner, slice data is not copied. <br>
+   * Slice memory must not be modified after the handoff.
+   * @param slice - &l:BufferChain::Slice;. Slice must have an owner.
+   * @param action - async specific action. If action is NOT &id:oatpp::async::Action::TYPE_NONE;, then
+   * caller MUST return this action on coroutine iteration.
+   * @return - slice size on success, or &id:oatpp::IOError;.
+   */
+  virtual v_io_size writeSlice(const BufferChain::Slice& slice, async::Action& action) = 0;
+
+};
+
+}}}
+
+#endif /* oatpp_data_buffer_BufferChain_hpp */
@@ -26,12 +26,67 @@
 
 namespace oatpp { namespace data{ namespace buffer {
 
-IOBuffer::IOBuffer()
-  : m_entry(getBufferPool().obtain())
-{}
+constexpr v_buff_size IOBuffer::BUFFER_SIZE;
+constexpr v_buff_size IOBuffer::MAX_BUFFER_SIZE;
+constexpr v_buff_size IOBuffer::STREAMING_BUFFER_SIZE;
+constexpr v_int32 IOBuffer::SIZE_CLASSES_COUNT;
 
-std::shared_ptr<IOBuffer> IOBuffer::createShared(){
-  return Shared_IOBuffer_Pool::allocateShared();
+v_int32 IOBuffer::getClassIndex(v_buff_size size) {
+  v_int32 index = 0;
+  v_buff_size classSize = BUFFER_SIZE;
+  while(classSize < size && index < SIZE_CLASSES_COUNT - 1) {
+    classSize <<= 2;
+    index ++;
+  }
+  return index;
+}
+
+oatpp::base::memory::ThreadDistributedMemoryPool& IOBuffer::getBufferPool(v_int32 classIndex) {
+
+  typedef oatpp::base::memory::ThreadDistributedMemoryPool Pool;
+  typedef oatpp::base::memory::MemoryPool MemoryPool;
+
+  switch(classIndex) {
+    case 0: {
+      static Pool pool("IOBuffer_Buffer_Pool", BUFFER_SIZE, 16, Pool::SHARDS_COUNT_DEFAULT, MemoryPool::HOT_POOLS_HUGE_PAGES);
+      return pool;
+    }
+    case 1: {
+      static Pool pool("IOBuffer_Buffer_Pool_16K", BUFFER_SIZE << 2, 8, Pool::SHARDS_COUNT_DEFAULT, MemoryPool::HOT_POOLS_HUGE_PAGES);
+      return pool;
+    }
+    case 2: {
+      static Pool pool("IOBuffer_Buffer_Pool_64K", BUFFER_SIZE << 4, 4, Pool::SHARDS_COUNT_DEFAULT, MemoryPool::HOT_POOLS_HUGE_PAGES);
+      return pool;
+    }
+    default: {
+      static Pool pool("IOBuffer_Buffer_Pool_256K", MAX_BUFFER_SIZE, 2, Pool::SHARDS_COUNT_DEFAULT, MemoryPool::HOT_POOLS_HUGE_PAGES);
+      return pool;
+    }
+  }
+
+}
+
+IOBuffer::IOBuffer(v_buff_size size) {
+  auto classIndex = getClassIndex(size);
+  m_entry = getBufferPool(classIndex).obtain();
+  m_size = BUFFER_SIZE << (classIndex * 2);
+}
+
+std::shared_ptr<IOBuffer> IOBuffer::createShared(v_buff_size size){
+  return Shared_IOBuffer_Pool::allocateShared(size);
+}
+
+v_buff_size IOBuffer::selectSize(v_buff_size knownSize, v_buff_size suggestedReadSize) {
+  v_buff_size size = suggestedReadSize;
+  if(knownSize >= 0) {
+    if(knownSize < size) {
+      size = knownSize;
+    }
+  } else if(size > STREAMING_BUFFER_SIZE) {
+    size = STREAMING_BUFFER_SIZE;
+  }
+  return BUFFER_SIZE << (getClassIndex(size) * 2);
 }
 
 IOBuffer::~IOBuffer() {
@@ -43,7 +98,7 @@ void* IOBuffer::getData(){
 }
 
 v_buff_size IOBuffer::getSize(){
-  return BUFFER_SIZE;
+  return m_size;
 }
   
 }}}
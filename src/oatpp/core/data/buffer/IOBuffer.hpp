@@ -32,7 +32,9 @@ namespace oatpp { namespace data{ namespace buffer {
 
 /**
  * Predefined buffer implementation for I/O operations.
- * Allocates buffer bytes using &id:oatpp::base::memory::ThreadDistributedMemoryPool;.
+ * Allocates buffer bytes using &id:oatpp::base::memory::ThreadDistributedMemoryPool;. <br>
+ * Buffers come in size classes - 4KB, 16KB, 64KB, 256KB, each class with its own pool.
+ * Use &l:IOBuffer::selectSize (); to pick the class for a transfer.
  */
 class IOBuffer : public oatpp::base::Countable {
 public:
@@ -40,28 +42,54 @@ public:
   SHARED_OBJECT_POOL(Shared_IOBuffer_Pool, IOBuffer, 32)
 public:
   /**
-   * Buffer size constant.
+   * Buffer size constant. Size of the smallest size class and the default buffer size.
    */
   static constexpr v_buff_size BUFFER_SIZE = 4096;
+
+  /**
+   * Size of the largest size class.
+   */
+  static constexpr v_buff_size MAX_BUFFER_SIZE = 256 * 1024;
+
+  /**
+   * Largest size class selected for a transfer of unknown size (ex.: chunked or streaming body).
+   * Such transfers may live long while moving little data, so they don't get large buffers.
+   */
+  static constexpr v_buff_size STREAMING_BUFFER_SIZE = 16 * 1024;
+
+  /**
+   * Number of size classes.
+   */
+  static constexpr v_int32 SIZE_CLASSES_COUNT = 4;
 private:
-  static oatpp::base::memory::ThreadDistributedMemoryPool& getBufferPool(){
-    static oatpp::base::memory::ThreadDistributedMemoryPool pool("IOBuffer_Buffer_Pool", BUFFER_SIZE, 16);
-    return pool;
-  }
+  static v_int32 getClassIndex(v_buff_size size);
+  static oatpp::base::memory::ThreadDistributedMemoryPool& getBufferPool(v_int32 classIndex);
 private:
   void* m_entry;
+  v_buff_size m_size;
 public:
   /**
    * Constructor.
+   * @param size - desired buffer size. Rounded up to the size class, limited by &l:IOBuffer::MAX_BUFFER_SIZE;.
    */
-  IOBuffer();
+  IOBuffer(v_buff_size size = BUFFER_SIZE);
 public:
 
   /**
    * Create shared IOBuffer.
+   * @param size - desired buffer size. Rounded up to the size class, limited by &l:IOBuffer::MAX_BUFFER_SIZE;.
    * @return
    */
-  static std::shared_ptr<IOBuffer> createShared();
+  static std::shared_ptr<IOBuffer> createShared(v_buff_size size = BUFFER_SIZE);
+
+  /**
+   * Select buffer size for the data transfer.
+   * @param knownSize - size of data to transfer or `-1` if unknown.
+   * @param suggestedReadSize - read size suggested by the processor. &id:oatpp::data::buffer::Processor::suggestInputStreamReadSize ();.
+   * @return - size of the size class big enough for one read of the transfer.
+   * Limited by &l:IOBuffer::STREAMING_BUFFER_SIZE; if `knownSize` is `-1`.
+   */
+  static v_buff_size selectSize(v_buff_size knownSize, v_buff_size suggestedReadSize);
 
   /**
    * Virtual destructor.
@@ -76,7 +104,7 @@ public:
 
   /**
    * Get buffer size.
-   * @return - should always return &l:IOBuffer::BUFFER_SIZE;.
+   * @return - size of the buffer size class.
    */
   v_buff_size getSize();
   
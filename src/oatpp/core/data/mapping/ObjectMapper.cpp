@@ -26,8 +26,113 @@
 
 #include "oatpp/core/data/stream/ChunkedBuffer.hpp"
 
+#include <cstring>
+
 namespace oatpp { namespace data { namespace mapping {
 
+namespace {
+
+/**
+ * Reader buffering all data and deserializing it with &id:oatpp::data::mapping::ObjectMapper::read; on finish.
+ */
+class BufferedReader : public ObjectMapper::Reader {
+private:
+  const ObjectMapper* m_objectMapper;
+  const type::Type* m_type;
+  stream::ChunkedBuffer m_buffer;
+public:
+
+  BufferedReader(const ObjectMapper* objectMapper, const type::Type* const type)
+    : m_objectMapper(objectMapper)
+    , m_type(type)
+  {}
+
+  v_io_size write(const void *data, v_buff_size count, async::Action& action) override {
+    return m_buffer.write(data, count, action);
+  }
+
+  type::Void finish() override {
+    oatpp::parser::Caret caret(m_buffer.toString());
+    auto result = m_objectMapper->read(caret, m_type);
+    if(caret.hasError()) {
+      setError(caret.getErrorMessage(), caret.getErrorCode(), caret.getPosition());
+      return nullptr;
+    }
+    return result;
+  }
+
+};
+
+/**
+ * Writer serializing the whole object with &id:oatpp::data::mapping::ObjectMapper::write; on the first read.
+ */
+class BufferedWriter : public data::stream::ReadCallback {
+private:
+  const ObjectMapper* m_objectMapper;
+  type::Void m_object;
+  oatpp::String m_data;
+  v_buff_size m_position;
+public:
+
+  BufferedWriter(const ObjectMapper* objectMapper, const type::Void& object)
+    : m_objectMapper(objectMapper)
+    , m_object(object)
+    , m_position(0)
+  {}
+
+  v_io_size read(void *buffer, v_buff_size count, async::Action& action) override {
+    (void) action;
+    if(!m_data) {
+      m_data = m_objectMapper->writeToString(m_object);
+      m_object = nullptr;
+    }
+    v_buff_size size = m_data->getSize() - m_position;
+    if(size > count) {
+      size = count;
+    }
+    std::memcpy(buffer, m_data->getData() + m_position, size);
+    m_position += size;
+    return size;
+  }
+
+};
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// ObjectMapper::Reader
+
+ObjectMapper::Reader::Reader()
+  : m_errorMessage(nullptr)
+  , m_errorCode(0)
+  , m_errorPosition(0)
+{}
+
+void ObjectMapper::Reader::setError(const char* message, v_int64 code, v_buff_size position) {
+  m_errorMessage = message;
+  m_errorCode = code;
+  m_errorPosition = position;
+}
+
+bool ObjectMapper::Reader::hasError() const {
+  return m_errorMessage != nullptr;
+}
+
+const char* ObjectMapper::Reader::getErrorMessage() const {
+  return m_errorMessage;
+}
+
+v_int64 ObjectMapper::Reader::getErrorCode() const {
+  return m_errorCode;
+}
+
+v_buff_size ObjectMapper::Reader::getErrorPosition() const {
+  return m_errorPosition;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// ObjectMapper
+
 ObjectMapper::ObjectMapper(const Info& info)
   : m_info(info)
 {}
@@ -36,6 +141,14 @@ const ObjectMapper::Info& ObjectMapper::getInfo() const {
   return m_info;
 }
 
+std::shared_ptr<ObjectMapper::Reader> ObjectMapper::createReader(const mapping::type::Type* const type) const {
+  return std::make_shared<BufferedReader>(this, type);
+}
+
+std::shared_ptr<data::stream::ReadCallback> ObjectMapper::createWriter(const type::Void& variant) const {
+  return std::make_shared<BufferedWriter>(this, variant);
+}
+
 oatpp::String ObjectMapper::writeToString(const type::Void& variant) const {
   stream::ChunkedBuffer stream;
   write(&stream, variant);
@@ -61,6 +61,73 @@ public:
     const char* const http_content_type;
 
   };
+public:
+
+  /**
+   * Incremental reader of serialized data. <br>
+   * Serialized data is pushed to the reader chunk by chunk via &id:oatpp::data::stream::WriteCallback; interface.
+   * Call &l:ObjectMapper::Reader::finish (); once all data is pushed to get the deserialized object.
+   */
+  class Reader : public data::stream::WriteCallback {
+  private:
+    const char* m_errorMessage;
+    v_int64 m_errorCode;
+    v_buff_size m_errorPosition;
+  protected:
+
+    /**
+     * Set error.
+     * @param message - error message. Should be a static string.
+     * @param code - error code.
+     * @param position - position of the error in the serialized data.
+     */
+    void setError(const char* message, v_int64 code, v_buff_size position);
+
+  public:
+
+    /**
+     * Constructor.
+     */
+    Reader();
+
+    /**
+     * Default virtual destructor.
+     */
+    virtual ~Reader() = default;
+
+    /**
+     * Signal that all data has been pushed and get the deserialized object.
+     * If nullptr is returned - check &l:ObjectMapper::Reader::hasError ();.
+     * @return - deserialized object wrapped in &id:oatpp::Void;.
+     */
+    virtual mapping::type::Void finish() = 0;
+
+    /**
+     * Check if reader has an error.
+     * @return - `true` if error is set.
+     */
+    bool hasError() const;
+
+    /**
+     * Get error message.
+     * @return - error message or `nullptr`.
+     */
+    const char* getErrorMessage() const;
+
+    /**
+     * Get error code.
+     * @return - error code.
+     */
+    v_int64 getErrorCode() const;
+
+    /**
+     * Get position of the error in the serialized data.
+     * @return - error position.
+     */
+    v_buff_size getErrorPosition() const;
+
+  };
+
 private:
   Info m_info;
 public:
@@ -92,6 +159,27 @@ public:
    */
   virtual mapping::type::Void read(oatpp::parser::Caret& caret, const mapping::type::Type* const type) const = 0;
 
+  /**
+   * Create incremental reader for object of type. <br>
+   * Default implementation buffers all pushed data and calls &l:ObjectMapper::read (); on
+   * &l:ObjectMapper::Reader::finish ();. Override this method to deserialize data as it arrives. <br>
+   * *Reader must not outlive the ObjectMapper.*
+   * @param type - pointer to object type. See &id:oatpp::data::mapping::type::Type;.
+   * @return - `std::shared_ptr` to &l:ObjectMapper::Reader;.
+   */
+  virtual std::shared_ptr<Reader> createReader(const mapping::type::Type* const type) const;
+
+  /**
+   * Create incremental writer for object. <br>
+   * Serialized data is pulled from the writer chunk by chunk via &id:oatpp::data::stream::ReadCallback; interface.
+   * `read` returns `0` once the whole object is serialized. <br>
+   * Default implementation serializes the whole object with &l:ObjectMapper::write (); on the first read.
+   * Override this method to serialize object on demand.
+   * @param variant - object to serialize.
+   * @return - `std::shared_ptr` to &id:oatpp::data::stream::ReadCallback;.
+   */
+  virtual std::shared_ptr<data::stream::ReadCallback> createWriter(const type::Void& variant) const;
+
   /**
    * Serialize object to String.
    * @param variant - Object to serialize.
@@ -233,11 +233,11 @@ public:
 public:
 
   EnumObjectWrapper(T value)
-    : type::ObjectWrapper<T, EnumObjectClass>(std::make_shared<T>(value))
+    : type::ObjectWrapper<T, EnumObjectClass>(base::memory::PooledAllocation::allocateShared<T>(value))
   {}
 
   EnumObjectWrapper& operator = (T value) {
-    this->m_ptr = std::make_shared<T>(value);
+    this->m_ptr = base::memory::PooledAllocation::allocateShared<T>(value);
     return *this;
   }
 
@@ -502,7 +502,7 @@ namespace __class {
   private:
 
     static type::Void creator() {
-      return type::Void(std::make_shared<T>(), getType());
+      return type::Void(base::memory::PooledAllocation::allocateShared<T>(), getType());
     }
 
     static Type createType() {
@@ -27,6 +27,8 @@
 
 #include "./Type.hpp"
 
+#include "oatpp/core/base/memory/Allocator.hpp"
+
 #include <list>
 #include <initializer_list>
 
@@ -110,7 +112,7 @@ namespace __class {
   private:
 
     static type::Void creator() {
-      return type::Void(std::make_shared<std::list<T>>(), getType());
+      return type::Void(base::memory::PooledAllocation::allocateShared<std::list<T>>(), getType());
     }
 
     static Type createType() {
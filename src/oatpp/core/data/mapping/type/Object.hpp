@@ -42,7 +42,76 @@
 #include <type_traits>
 
 namespace oatpp { namespace data { namespace mapping { namespace type {
-  
+
+/**
+ * Max number of fields generated by `DTO_FIELD` macro in one DTO class.
+ */
+constexpr v_int32 DTO_MAX_FIELDS = 256;
+
+/**
+ * Overload rank used by DTO codegen to count DTO fields at compile time. <br>
+ * `FieldRank<N>` converts to any `FieldRank<M>` where `M < N`, so overload with the highest rank wins.
+ * @tparam N - rank.
+ */
+template<v_int32 N>
+struct FieldRank : FieldRank<N - 1> {};
+
+template<>
+struct FieldRank<0> {};
+
+/**
+ * Compile-time iteration over fields generated by `DTO_FIELD` macro in DTO class `T`. <br>
+ * Fields are visited in the order of declaration. Fields of parent DTO classes are not visited -
+ * use `T::Z__VISIT_FIELDS` and `T::Z__VISIT_FIELD_DESCRIPTORS` to visit all fields of DTO.
+ * @tparam T - DTO class.
+ * @tparam Count - number of fields declared in `T`.
+ * @tparam Index - index of the current field.
+ */
+template<class T, v_int32 Count, v_int32 Index = 0>
+struct StaticFields {
+
+  /**
+   * Call `visitor(property, field)` for each field of the object. <br>
+   * `field` is a reference to the statically typed field wrapper, e.g. `oatpp::Int32&`.
+   * @tparam Visitor - visitor type.
+   * @param visitor - visitor.
+   * @param object - pointer to DTO object.
+   */
+  template<class Visitor>
+  static void visit(Visitor& visitor, T* object) {
+    T::Z__FIELD_VISIT(visitor, object, std::integral_constant<v_int32, Index>());
+    StaticFields<T, Count, Index + 1>::visit(visitor, object);
+  }
+
+  /**
+   * Call `visitor.template visitField<T, Index>(property)` for each field of the class.
+   * @tparam Visitor - visitor type.
+   * @param visitor - visitor.
+   */
+  template<class Visitor>
+  static void visitDescriptors(Visitor& visitor) {
+    visitor.template visitField<T, Index>(T::Z__FIELD_PROPERTY(std::integral_constant<v_int32, Index>()));
+    StaticFields<T, Count, Index + 1>::visitDescriptors(visitor);
+  }
+
+};
+
+template<class T, v_int32 Count>
+struct StaticFields<T, Count, Count> {
+
+  template<class Visitor>
+  static void visit(Visitor& visitor, T* object) {
+    (void) visitor;
+    (void) object;
+  }
+
+  template<class Visitor>
+  static void visitDescriptors(Visitor& visitor) {
+    (void) visitor;
+  }
+
+};
+
 namespace __class {
 
   /**
@@ -62,7 +131,7 @@ namespace __class {
   private:
 
     static type::Void creator() {
-      return type::Void(std::make_shared<T>(), getType());
+      return type::Void(base::memory::PooledAllocation::allocateShared<T>(), getType());
     }
 
     static type::Type::Properties* initProperties() {
@@ -144,6 +213,19 @@ private:
     return &map;
   }
   
+public:
+
+  template<class Visitor>
+  static void Z__VISIT_FIELDS(Visitor& visitor, Object* object) {
+    (void) visitor;
+    (void) object;
+  }
+
+  template<class Visitor>
+  static void Z__VISIT_FIELD_DESCRIPTORS(Visitor& visitor) {
+    (void) visitor;
+  }
+
 public:
 
   virtual v_uint64 defaultHashCode() const {
@@ -174,7 +256,7 @@ public:
   OATPP_DEFINE_OBJECT_WRAPPER_DEFAULTS(DTOWrapper, TemplateObjectType, TemplateObjectClass)
 
   static DTOWrapper createShared() {
-    return std::make_shared<TemplateObjectType>();
+    return base::memory::PooledAllocation::allocateShared<TemplateObjectType>();
   }
 
   template<typename T,
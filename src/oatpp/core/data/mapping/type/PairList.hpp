@@ -27,6 +27,8 @@
 
 #include "./Type.hpp"
 
+#include "oatpp/core/base/memory/Allocator.hpp"
+
 #include <list>
 #include <initializer_list>
 #include <utility>
@@ -142,7 +144,7 @@ private:
 private:
 
   static type::Void creator() {
-    return type::Void(std::make_shared<std::list<std::pair<Key, Value>>>(), getType());
+    return type::Void(base::memory::PooledAllocation::allocateShared<std::list<std::pair<Key, Value>>>(), getType());
   }
 
   static Type createType() {
@@ -173,11 +173,11 @@ public:
   OATPP_DEFINE_OBJECT_WRAPPER_DEFAULTS(Primitive, TValueType, Clazz)
 
   Primitive(TValueType value)
-    : type::ObjectWrapper<TValueType, Clazz>(std::make_shared<TValueType>(value))
+    : type::ObjectWrapper<TValueType, Clazz>(base::memory::PooledAllocation::allocateShared<TValueType>(value))
   {}
 
   Primitive& operator = (TValueType value) {
-    this->m_ptr = std::make_shared<TValueType>(value);
+    this->m_ptr = base::memory::PooledAllocation::allocateShared<TValueType>(value);
     return *this;
   }
 
@@ -248,11 +248,11 @@ public:
   OATPP_DEFINE_OBJECT_WRAPPER_DEFAULTS(Boolean, bool, __class::Boolean)
 
   Boolean(bool value)
-    : type::ObjectWrapper<bool, __class::Boolean>(std::make_shared<bool>(value))
+    : type::ObjectWrapper<bool, __class::Boolean>(base::memory::PooledAllocation::allocateShared<bool>(value))
   {}
 
   Boolean& operator = (bool value) {
-    this->m_ptr = std::make_shared<bool>(value);
+    this->m_ptr = base::memory::PooledAllocation::allocateShared<bool>(value);
     return *this;
   }
 
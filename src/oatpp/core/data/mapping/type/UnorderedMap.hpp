@@ -27,6 +27,8 @@
 
 #include "./Type.hpp"
 
+#include "oatpp/core/base/memory/Allocator.hpp"
+
 #include <unordered_map>
 #include <initializer_list>
 #include <utility>
@@ -43,6 +45,7 @@ namespace __class {
     class AbstractPolymorphicDispatcher {
     public:
       virtual void addPolymorphicItem(const type::Void& object, const type::Void& key, const type::Void& value) const = 0;
+      virtual void reservePolymorphicItems(const type::Void& object, v_buff_size count) const = 0;
     };
 
   };
@@ -110,12 +113,17 @@ namespace __class {
         map[k] = v;
       }
 
+      void reservePolymorphicItems(const type::Void& object, v_buff_size count) const override {
+        const auto& map = object.staticCast<type::UnorderedMap<Key, Value>>();
+        map->reserve(count);
+      }
+
     };
 
   private:
 
     static type::Void creator() {
-      return type::Void(std::make_shared<std::unordered_map<Key, Value>>(), getType());
+      return type::Void(base::memory::PooledAllocation::allocateShared<std::unordered_map<Key, Value>>(), getType());
     }
 
     static Type createType() {
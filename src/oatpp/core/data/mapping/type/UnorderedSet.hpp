@@ -27,6 +27,8 @@
 
 #include "./Type.hpp"
 
+#include "oatpp/core/base/memory/Allocator.hpp"
+
 #include <unordered_set>
 #include <initializer_list>
 
@@ -42,6 +44,7 @@ public:
   class AbstractPolymorphicDispatcher {
   public:
     virtual void addPolymorphicItem(const type::Void& object, const type::Void& item) const = 0;
+    virtual void reservePolymorphicItems(const type::Void& object, v_buff_size count) const = 0;
   };
 
 };
@@ -107,12 +110,17 @@ private:
       set->insert(setItem);
     }
 
+    void reservePolymorphicItems(const type::Void& object, v_buff_size count) const override {
+      const auto& set = object.staticCast<type::UnorderedSet<T>>();
+      set->reserve(count);
+    }
+
   };
 
 private:
 
   static type::Void creator() {
-    return type::Void(std::make_shared<std::unordered_set<T>>(), getType());
+    return type::Void(base::memory::PooledAllocation::allocateShared<std::unordered_set<T>>(), getType());
   }
 
   static Type createType() {
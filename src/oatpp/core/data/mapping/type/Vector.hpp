@@ -27,6 +27,8 @@
 
 #include "./Type.hpp"
 
+#include "oatpp/core/base/memory/Allocator.hpp"
+
 #include <vector>
 #include <initializer_list>
 
@@ -42,6 +44,7 @@ namespace __class {
     class AbstractPolymorphicDispatcher {
     public:
       virtual void addPolymorphicItem(const type::Void& object, const type::Void& item) const = 0;
+      virtual void reservePolymorphicItems(const type::Void& object, v_buff_size count) const = 0;
     };
 
   };
@@ -103,12 +106,17 @@ namespace __class {
         vector->push_back(vectorItem);
       }
 
+      void reservePolymorphicItems(const type::Void& object, v_buff_size count) const override {
+        const auto& vector = object.staticCast<type::Vector<T>>();
+        vector->reserve(count);
+      }
+
     };
 
   private:
 
     static type::Void creator() {
-      return type::Void(std::make_shared<std::vector<T>>(), getType());
+      return type::Void(base::memory::PooledAllocation::allocateShared<std::vector<T>>(), getType());
     }
 
     static Type createType() {
@@ -24,6 +24,8 @@
 
 #include "BufferStream.hpp"
 
+#include "oatpp/core/base/memory/SlabAllocator.hpp"
+
 namespace oatpp { namespace data{ namespace stream {
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -32,15 +34,18 @@ namespace oatpp { namespace data{ namespace stream {
 data::stream::DefaultInitializedContext BufferOutputStream::DEFAULT_CONTEXT(data::stream::StreamType::STREAM_INFINITE);
 
 BufferOutputStream::BufferOutputStream(v_buff_size initialCapacity, v_buff_size growBytes)
-  : m_data(new v_char8[initialCapacity])
+  : m_data((p_char8) base::memory::SlabAllocator::allocate(initialCapacity))
   , m_capacity(initialCapacity)
   , m_position(0)
+  , m_initialCapacity(initialCapacity)
   , m_growBytes(growBytes)
   , m_ioMode(IOMode::ASYNCHRONOUS)
 {}
 
 BufferOutputStream::~BufferOutputStream() {
-  delete [] m_data;
+  if(m_data != nullptr) {
+    base::memory::SlabAllocator::deallocate(m_data, m_capacity);
+  }
 }
 
 v_io_size BufferOutputStream::write(const void *data, v_buff_size count, async::Action& action) {
@@ -70,6 +75,11 @@ Context& BufferOutputStream::getOutputStreamContext() {
 
 void BufferOutputStream::reserveBytesUpfront(v_buff_size count) {
 
+  if(m_data == nullptr) {
+    m_data = (p_char8) base::memory::SlabAllocator::allocate(m_initialCapacity);
+    m_capacity = m_initialCapacity;
+  }
+
   if(m_position + count > m_capacity) {
 
     if(m_growBytes <= 0) {
@@ -84,17 +94,29 @@ void BufferOutputStream::reserveBytesUpfront(v_buff_size count) {
     }
 
     v_buff_size newCapacity = m_capacity + extraChunks * m_growBytes;
-    p_char8 newData = new v_char8[newCapacity];
 
-    std::memcpy(newData, m_data, m_position);
-    delete [] m_data;
-    m_data = newData;
+    /* grow in place while the new capacity fits the same slab size class */
+    if(newCapacity > base::memory::SlabAllocator::getCapacity(m_capacity)) {
+      p_char8 newData = (p_char8) base::memory::SlabAllocator::allocate(newCapacity);
+      std::memcpy(newData, m_data, m_position);
+      base::memory::SlabAllocator::deallocate(m_data, m_capacity);
+      m_data = newData;
+    }
     m_capacity = newCapacity;
 
   }
 
 }
 
+void BufferOutputStream::releaseBuffer() {
+  if(m_data != nullptr) {
+    base::memory::SlabAllocator::deallocate(m_data, m_capacity);
+    m_data = nullptr;
+    m_capacity = 0;
+  }
+  m_position = 0;
+}
+
 p_char8 BufferOutputStream::getData() {
   return m_data;
 }
@@ -39,6 +39,7 @@ private:
   p_char8 m_data;
   v_buff_size m_capacity;
   v_buff_size m_position;
+  v_buff_size m_initialCapacity;
   v_buff_size m_growBytes;
   IOMode m_ioMode;
 public:
@@ -87,6 +88,12 @@ public:
    */
   void reserveBytesUpfront(v_buff_size count);
 
+  /**
+   * Return buffer memory to the pool and reset current position to zero. <br>
+   * Buffer of `initialCapacity` is acquired again on the next write or &l:BufferOutputStream::reserveBytesUpfront ();.
+   */
+  void releaseBuffer();
+
   /**
    * Get pointer to data.
    * @return - pointer to data.
@@ -24,6 +24,8 @@
 
 #include "ChunkedBuffer.hpp"
 
+#include "oatpp/core/base/memory/SlabAllocator.hpp"
+
 namespace oatpp { namespace data{ namespace stream {
 
 data::stream::DefaultInitializedContext ChunkedBuffer::DEFAULT_CONTEXT(data::stream::StreamType::STREAM_INFINITE);
@@ -50,7 +52,7 @@ ChunkedBuffer::~ChunkedBuffer() {
 }
 
 ChunkedBuffer::ChunkEntry* ChunkedBuffer::obtainNewEntry(){
-  auto result = new ChunkEntry(getSegemntPool().obtain(), nullptr);
+  auto result = new ChunkEntry(base::memory::SlabAllocator::allocate(CHUNK_ENTRY_SIZE), nullptr);
   if(m_firstEntry == nullptr) {
     m_firstEntry = result;
   } else {
@@ -61,7 +63,7 @@ ChunkedBuffer::ChunkEntry* ChunkedBuffer::obtainNewEntry(){
 }
 
 void ChunkedBuffer::freeEntry(ChunkEntry* entry){
-  oatpp::base::memory::MemoryPool::free(entry->chunk);
+  base::memory::SlabAllocator::deallocate(entry->chunk, CHUNK_ENTRY_SIZE);
   delete entry;
 }
 
@@ -51,11 +51,6 @@ public:
   static const v_buff_size CHUNK_ENTRY_SIZE;
   static const v_buff_size CHUNK_CHUNK_SIZE;
 
-  static oatpp::base::memory::ThreadDistributedMemoryPool& getSegemntPool(){
-    static oatpp::base::memory::ThreadDistributedMemoryPool pool(CHUNK_POOL_NAME, CHUNK_ENTRY_SIZE,  CHUNK_CHUNK_SIZE);
-    return pool;
-  }
-  
 private:
   
   class ChunkEntry {
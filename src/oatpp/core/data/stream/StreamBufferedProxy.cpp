@@ -24,6 +24,8 @@
 
 #include "StreamBufferedProxy.hpp"
 
+#include "oatpp/core/base/memory/SlabAllocator.hpp"
+
 namespace oatpp { namespace data{ namespace stream {
   
 v_io_size OutputStreamBufferedProxy::write(const void *data, v_buff_size count, async::Action& action) {
@@ -58,17 +60,88 @@ oatpp::async::CoroutineStarter OutputStreamBufferedProxy::flushAsync() {
   return m_buffer.flushToStreamAsync(m_outputStream);
 }
   
+InputStreamBufferedProxy::InputStreamBufferedProxy(const std::shared_ptr<InputStream>& inputStream,
+                                                   v_buff_size initialBufferSize,
+                                                   v_buff_size maxBufferSize)
+  : m_inputStream(inputStream)
+  , m_memoryLabel()
+  , m_buffer(nullptr, 0)
+  , m_initialBufferSize(initialBufferSize)
+  , m_maxBufferSize(maxBufferSize < initialBufferSize ? initialBufferSize : maxBufferSize)
+  , m_nextBufferSize(initialBufferSize)
+  , m_leasedBuffer(nullptr)
+{
+  if(initialBufferSize <= 0) {
+    throw std::runtime_error("[oatpp::data::stream::InputStreamBufferedProxy::InputStreamBufferedProxy()]: Error. Invalid initialBufferSize.");
+  }
+}
+
+InputStreamBufferedProxy::~InputStreamBufferedProxy() {
+  if(m_leasedBuffer != nullptr) {
+    base::memory::SlabAllocator::deallocate(m_leasedBuffer, m_buffer.getBufferSize());
+  }
+}
+
+v_io_size InputStreamBufferedProxy::fillBuffer(async::Action& action) {
+
+  if(m_maxBufferSize == 0) {
+    return m_buffer.readFromStreamAndWrite(m_inputStream.get(), m_buffer.getBufferSize(), action);
+  }
+
+  if(m_leasedBuffer == nullptr) {
+    auto capacity = base::memory::SlabAllocator::getCapacity(m_nextBufferSize);
+    m_leasedBuffer = (p_char8) base::memory::SlabAllocator::allocate(capacity);
+    m_buffer = buffer::FIFOBuffer(m_leasedBuffer, capacity);
+  }
+
+  auto capacity = m_buffer.getBufferSize();
+  auto bytesBuffered = m_buffer.readFromStreamAndWrite(m_inputStream.get(), capacity, action);
+
+  if(bytesBuffered == capacity) {
+    /* Stream has more data than the buffer can hold - grow */
+    m_nextBufferSize = capacity * 2 > m_maxBufferSize ? m_maxBufferSize : capacity * 2;
+  } else if(bytesBuffered > 0 && bytesBuffered < (m_nextBufferSize >> 2) && m_nextBufferSize > m_initialBufferSize) {
+    /* Reads became small - shrink */
+    m_nextBufferSize = (m_nextBufferSize >> 1) < m_initialBufferSize ? m_initialBufferSize : (m_nextBufferSize >> 1);
+  }
+
+  if(bytesBuffered <= 0) {
+    /* No data - don't hold the buffer while waiting */
+    releaseBufferIfDrained();
+  }
+
+  return bytesBuffered;
+
+}
+
+void InputStreamBufferedProxy::releaseBufferIfDrained() {
+  if(m_leasedBuffer != nullptr && m_buffer.availableToRead() == 0) {
+    base::memory::SlabAllocator::deallocate(m_leasedBuffer, m_buffer.getBufferSize());
+    m_leasedBuffer = nullptr;
+    m_buffer = buffer::FIFOBuffer(nullptr, 0);
+  }
+}
+
 v_io_size InputStreamBufferedProxy::read(void *data, v_buff_size count, async::Action& action) {
   
   if(m_buffer.availableToRead() > 0) {
-    return m_buffer.read(data, count);
-  } else {
-    auto bytesBuffered = m_buffer.readFromStreamAndWrite(m_inputStream.get(), m_buffer.getBufferSize(), action);
-    if(bytesBuffered > 0) {
-      return m_buffer.read(data, count);
-    }
-    return bytesBuffered;
+    auto result = m_buffer.read(data, count);
+    releaseBufferIfDrained();
+    return result;
+  }
+
+  if(m_maxBufferSize > 0 && count >= m_nextBufferSize) {
+    /* Buffer is empty and the caller's buffer is big enough - read directly */
+    return m_inputStream->read(data, count, action);
   }
+
+  auto bytesBuffered = fillBuffer(action);
+  if(bytesBuffered > 0) {
+    auto result = m_buffer.read(data, count);
+    releaseBufferIfDrained();
+    return result;
+  }
+  return bytesBuffered;
   
 }
 
@@ -77,7 +150,7 @@ v_io_size InputStreamBufferedProxy::peek(void *data, v_buff_size count, async::A
   if(m_buffer.availableToRead() > 0) {
     return m_buffer.peek(data, count);
   } else {
-    auto bytesBuffered = m_buffer.readFromStreamAndWrite(m_inputStream.get(), m_buffer.getBufferSize(), action);
+    auto bytesBuffered = fillBuffer(action);
     if(bytesBuffered > 0) {
       return m_buffer.peek(data, count);
     }
@@ -87,7 +160,17 @@ v_io_size InputStreamBufferedProxy::peek(void *data, v_buff_size count, async::A
 }
 
 v_io_size InputStreamBufferedProxy::commitReadOffset(v_buff_size count) {
-  return m_buffer.commitReadOffset(count);
+  auto result = m_buffer.commitReadOffset(count);
+  releaseBufferIfDrained();
+  return result;
+}
+
+v_io_size InputStreamBufferedProxy::prefetch(async::Action& action) {
+  auto available = m_buffer.availableToRead();
+  if(available > 0) {
+    return available;
+  }
+  return fillBuffer(action);
 }
 
 void InputStreamBufferedProxy::setInputStreamIOMode(oatpp::data::stream::IOMode ioMode) {
@@ -101,5 +184,13 @@ oatpp::data::stream::IOMode InputStreamBufferedProxy::getInputStreamIOMode() {
 Context& InputStreamBufferedProxy::getInputStreamContext() {
   return m_inputStream->getInputStreamContext();
 }
+
+v_buff_size InputStreamBufferedProxy::getHeldBufferSize() const {
+  return m_buffer.getBufferSize();
+}
+
+v_buff_size InputStreamBufferedProxy::getNextBufferSize() const {
+  return m_maxBufferSize > 0 ? m_nextBufferSize : 0;
+}
   
 }}}
@@ -82,15 +82,43 @@ public:
   
 };
   
+/**
+ * Buffered proxy of &id:oatpp::data::stream::InputStream;. <br>
+ * Works in one of two modes:
+ * <ul>
+ *   <li>Fixed buffer - read-ahead buffer is the memory label passed to the constructor.</li>
+ *   <li>Adaptive buffer - read-ahead buffer is leased from &id:oatpp::base::memory::SlabAllocator; only
+ *   while it holds unread data and is returned as soon as it drains or when the underlying stream has no data.
+ *   Buffer size starts at `initialBufferSize`, doubles when the underlying stream fills the whole buffer,
+ *   and shrinks back when reads become small. Reads bigger than the buffer bypass it.</li>
+ * </ul>
+ */
 class InputStreamBufferedProxy : public oatpp::base::Countable, public InputStream {
 public:
   OBJECT_POOL(InputStreamBufferedProxy_Pool, InputStreamBufferedProxy, 32)
   SHARED_OBJECT_POOL(Shared_InputStreamBufferedProxy_Pool, InputStreamBufferedProxy, 32)
+private:
+  v_io_size fillBuffer(async::Action& action);
+  void releaseBufferIfDrained();
 protected:
   std::shared_ptr<InputStream> m_inputStream;
   oatpp::data::share::MemoryLabel m_memoryLabel;
   buffer::FIFOBuffer m_buffer;
+protected:
+  v_buff_size m_initialBufferSize;
+  v_buff_size m_maxBufferSize;
+  v_buff_size m_nextBufferSize;
+  p_char8 m_leasedBuffer;
 public:
+
+  /**
+   * Constructor. Fixed buffer mode.
+   * @param inputStream - underlying &id:oatpp::data::stream::InputStream;.
+   * @param memoryLabel - read-ahead buffer.
+   * @param bufferReadPosition - read position of data already in the buffer.
+   * @param bufferWritePosition - write position of data already in the buffer.
+   * @param bufferCanRead - `true` if buffer is full of unread data.
+   */
   InputStreamBufferedProxy(const std::shared_ptr<InputStream>& inputStream,
                            const oatpp::data::share::MemoryLabel& memoryLabel,
                            v_io_size bufferReadPosition,
@@ -99,7 +127,27 @@ public:
     : m_inputStream(inputStream)
     , m_memoryLabel(memoryLabel)
     , m_buffer(memoryLabel.getData(), memoryLabel.getSize(), bufferReadPosition, bufferWritePosition, bufferCanRead)
+    , m_initialBufferSize(0)
+    , m_maxBufferSize(0)
+    , m_nextBufferSize(0)
+    , m_leasedBuffer(nullptr)
   {}
+
+  /**
+   * Constructor. Adaptive buffer mode.
+   * @param inputStream - underlying &id:oatpp::data::stream::InputStream;.
+   * @param initialBufferSize - size of the first leased read-ahead buffer.
+   * @param maxBufferSize - maximum size the read-ahead buffer may grow to.
+   */
+  InputStreamBufferedProxy(const std::shared_ptr<InputStream>& inputStream,
+                           v_buff_size initialBufferSize,
+                           v_buff_size maxBufferSize);
+
+  /**
+   * Non-virtual Destructor. Returns leased buffer if any.
+   */
+  ~InputStreamBufferedProxy();
+
 public:
   
   static std::shared_ptr<InputStreamBufferedProxy> createShared(const std::shared_ptr<InputStream>& inputStream,
@@ -116,6 +164,20 @@ public:
   {
     return Shared_InputStreamBufferedProxy_Pool::allocateShared(inputStream, memoryLabel, bufferReadPosition, bufferWritePosition, bufferCanRead);
   }
+
+  /**
+   * Create shared InputStreamBufferedProxy with adaptive read-ahead buffer.
+   * @param inputStream - underlying &id:oatpp::data::stream::InputStream;.
+   * @param initialBufferSize - size of the first leased read-ahead buffer.
+   * @param maxBufferSize - maximum size the read-ahead buffer may grow to.
+   * @return - `std::shared_ptr` to InputStreamBufferedProxy.
+   */
+  static std::shared_ptr<InputStreamBufferedProxy> createShared(const std::shared_ptr<InputStream>& inputStream,
+                                                                v_buff_size initialBufferSize,
+                                                                v_buff_size maxBufferSize)
+  {
+    return Shared_InputStreamBufferedProxy_Pool::allocateShared(inputStream, initialBufferSize, maxBufferSize);
+  }
   
   v_io_size read(void *data, v_buff_size count, async::Action& action) override;
 
@@ -123,6 +185,15 @@ public:
 
   v_io_size commitReadOffset(v_buff_size count);
 
+  /**
+   * Make sure the read-ahead buffer has data. Reads from the underlying stream only if the buffer is empty. <br>
+   * In adaptive mode buffer is leased only when data arrives.
+   * @param action - async specific action. If action is NOT &id:oatpp::async::Action::TYPE_NONE;, then
+   * caller MUST return this action on coroutine iteration.
+   * @return - amount of data available in the buffer or &id:oatpp::IOError;.
+   */
+  v_io_size prefetch(async::Action& action);
+
   /**
    * Set InputStream I/O mode.
    * @param ioMode
@@ -141,6 +212,19 @@ public:
    */
   Context& getInputStreamContext() override;
 
+  /**
+   * Get size of the read-ahead buffer currently held by the proxy. <br>
+   * In adaptive mode it is `0` while the proxy holds no unread data.
+   * @return - size of the held buffer.
+   */
+  v_buff_size getHeldBufferSize() const;
+
+  /**
+   * Get size of the buffer which will be leased on the next read from the underlying stream. Adaptive mode only.
+   * @return - size of the next buffer or `0` in fixed buffer mode.
+   */
+  v_buff_size getNextBufferSize() const;
+
   void setBufferPosition(v_io_size readPosition, v_io_size writePosition, bool canRead) {
     m_buffer.setBufferPosition(readPosition, writePosition, canRead);
   }
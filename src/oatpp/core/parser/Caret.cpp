@@ -24,6 +24,8 @@
 
 #include "Caret.hpp"
 
+#include "oatpp/core/utils/ConversionUtils.hpp"
+
 #include <stdlib.h>
 #include <cstdlib>
 #include <algorithm>
@@ -348,6 +350,15 @@ v_int64 Caret::StateSaveGuard::getSavedErrorCode() {
   }
 
   v_int64 Caret::parseInt(int base) {
+    if(base == 10) {
+      v_int64 result = 0;
+      auto size = utils::conversion::charSequenceToInt64((const char*)&m_data[m_pos], m_size - m_pos, result);
+      if(size == 0){
+        m_errorMessage = ERROR_INVALID_INTEGER;
+      }
+      m_pos += size;
+      return result;
+    }
     char* end;
     char* start = (char*)&m_data[m_pos];
     v_int64 result = (v_int64)std::strtoll(start, &end, base);
@@ -359,6 +370,15 @@ v_int64 Caret::StateSaveGuard::getSavedErrorCode() {
   }
 
   v_uint64 Caret::parseUnsignedInt(int base) {
+    if(base == 10) {
+      v_uint64 result = 0;
+      auto size = utils::conversion::charSequenceToUInt64((const char*)&m_data[m_pos], m_size - m_pos, result);
+      if(size == 0){
+        m_errorMessage = ERROR_INVALID_INTEGER;
+      }
+      m_pos += size;
+      return result;
+    }
     char* end;
     char* start = (char*)&m_data[m_pos];
     v_uint64 result = (v_uint64)std::strtoull(start, &end, base);
@@ -370,24 +390,22 @@ v_int64 Caret::StateSaveGuard::getSavedErrorCode() {
   }
   
   v_float32 Caret::parseFloat32(){
-    char* end;
-    char* start = (char*)&m_data[m_pos];
-    v_float32 result = std::strtof(start , &end);
-    if(start == end){
+    v_float32 result = 0;
+    auto size = utils::conversion::charSequenceToFloat32((const char*)&m_data[m_pos], m_size - m_pos, result);
+    if(size == 0){
       m_errorMessage = ERROR_INVALID_FLOAT;
     }
-    m_pos = ((v_buff_size) end - (v_buff_size) m_data);
+    m_pos += size;
     return result;
   }
   
   v_float64 Caret::parseFloat64(){
-    char* end;
-    char* start = (char*)&m_data[m_pos];
-    v_float64 result = std::strtod(start , &end);
-    if(start == end){
+    v_float64 result = 0;
+    auto size = utils::conversion::charSequenceToFloat64((const char*)&m_data[m_pos], m_size - m_pos, result);
+    if(size == 0){
       m_errorMessage = ERROR_INVALID_FLOAT;
     }
-    m_pos = ((v_buff_size) end - (v_buff_size) m_data);
+    m_pos += size;
     return result;
   }
   
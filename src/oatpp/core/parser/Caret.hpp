@@ -341,9 +341,9 @@ public:
 
   /**
    * parse integer value starting from the current position.
-   * Using function std::strtol()
+   * For base 10 - using function &id:oatpp::utils::conversion::charSequenceToInt64;. Otherwise - std::strtol()
    *
-   * Warning: position may go out of @Caret::getSize() bound.
+   * Warning: for base other than 10 position may go out of @Caret::getSize() bound.
    *
    * @param base - base is passed to std::strtol function
    * @return parsed value
@@ -352,9 +352,9 @@ public:
 
   /**
    * parse integer value starting from the current position.
-   * Using function std::strtoul()
+   * For base 10 - using function &id:oatpp::utils::conversion::charSequenceToUInt64;. Otherwise - std::strtoul()
    *
-   * Warning: position may go out of @Caret::getSize() bound.
+   * Warning: for base other than 10 position may go out of @Caret::getSize() bound.
    *
    * @param base - base is passed to std::strtoul function
    * @return parsed value
@@ -363,9 +363,7 @@ public:
 
   /**
    * parse float value starting from the current position.
-   * Using function std::strtof()
-   *
-   * Warning: position may go out of @Caret::getSize() bound.
+   * Using function &id:oatpp::utils::conversion::charSequenceToFloat32; (locale-independent).
    *
    * @return parsed value
    */
@@ -373,9 +371,7 @@ public:
 
   /**
    * parse float value starting from the current position.
-   * Using function std::strtod()
-   *
-   * Warning: position may go out of @Caret::getSize() bound.
+   * Using function &id:oatpp::utils::conversion::charSequenceToFloat64; (locale-independent).
    *
    * @return parsed value
    */
@@ -36,6 +36,28 @@
 
 namespace oatpp { namespace utils { namespace conversion {
 
+  /**
+   * Parse 64-bit integer from the char sequence. <br>
+   * Accepts the same syntax as `strtoll` with base 10 - optional leading whitespaces, sign, and decimal digits.
+   * Out of range values are clamped to the min/max value. Doesn't depend on locale and doesn't touch `errno`.
+   * @param data - pointer to data.
+   * @param size - data size.
+   * @param value - out parameter. Parsed value.
+   * @return - number of chars consumed. `0` if data doesn't start with a valid number.
+   */
+  v_buff_size charSequenceToInt64(const char* data, v_buff_size size, v_int64& value);
+
+  /**
+   * Parse 64-bit unsigned integer from the char sequence. <br>
+   * Accepts the same syntax as `strtoull` with base 10 - optional leading whitespaces, sign, and decimal digits.
+   * Out of range values are clamped to the max value. Doesn't depend on locale and doesn't touch `errno`.
+   * @param data - pointer to data.
+   * @param size - data size.
+   * @param value - out parameter. Parsed value.
+   * @return - number of chars consumed. `0` if data doesn't start with a valid number.
+   */
+  v_buff_size charSequenceToUInt64(const char* data, v_buff_size size, v_uint64& value);
+
   /**
    * String to 32-bit integer.
    * @param str - string as `const char*`.
@@ -100,8 +122,8 @@ namespace oatpp { namespace utils { namespace conversion {
    * Convert 32-bit integer to it's string representation.
    * @param value - 32-bit integer value.
    * @param data - buffer to write data to.
-   * @param n - buffer size.
-   * @return - length of the resultant string.
+   * @param n - buffer size. Should be at least 11 bytes.
+   * @return - length of the resultant string. `0` if buffer is too small.
    */
   v_buff_size int32ToCharSequence(v_int32 value, p_char8 data, v_buff_size n);
 
@@ -109,8 +131,8 @@ namespace oatpp { namespace utils { namespace conversion {
    * Convert 32-bit unsigned integer to it's string representation.
    * @param value - 32-bit unsigned integer value.
    * @param data - buffer to write data to.
-   * @param n - buffer size.
-   * @return - length of the resultant string.
+   * @param n - buffer size. Should be at least 10 bytes.
+   * @return - length of the resultant string. `0` if buffer is too small.
    */
   v_buff_size uint32ToCharSequence(v_uint32 value, p_char8 data, v_buff_size n);
 
@@ -118,8 +140,8 @@ namespace oatpp { namespace utils { namespace conversion {
   * Convert 64-bit integer to it's string representation.
   * @param value - 64-bit integer value.
   * @param data - buffer to write data to.
-  * @param n - buffer size.
-  * @return - length of the resultant string.
+  * @param n - buffer size. Should be at least 20 bytes.
+  * @return - length of the resultant string. `0` if buffer is too small.
   */
  v_buff_size int64ToCharSequence(v_int64 value, p_char8 data, v_buff_size n);
 
@@ -127,8 +149,8 @@ namespace oatpp { namespace utils { namespace conversion {
    * Convert 64-bit unsigned integer to it's string representation.
    * @param value - 64-bit unsigned integer value.
    * @param data - buffer to write data to.
-   * @param n - buffer size.
-   * @return - length of the resultant string.
+   * @param n - buffer size. Should be at least 20 bytes.
+   * @return - length of the resultant string. `0` if buffer is too small.
    */
   v_buff_size uint64ToCharSequence(v_uint64 value, p_char8 data, v_buff_size n);
 
@@ -219,6 +241,30 @@ namespace oatpp { namespace utils { namespace conversion {
     return nullptr;
   }
 
+  /**
+   * Parse 32-bit float from the char sequence. <br>
+   * Parsing is locale-independent and the result is correctly rounded. <br>
+   * Accepts optional leading whitespaces, sign, decimal number with optional fraction and exponent,
+   * and also `inf`, `infinity`, `nan` (case-insensitive).
+   * @param data - pointer to data.
+   * @param size - data size.
+   * @param value - out parameter. Parsed value.
+   * @return - number of chars consumed. `0` if data doesn't start with a valid number.
+   */
+  v_buff_size charSequenceToFloat32(const char* data, v_buff_size size, v_float32& value);
+
+  /**
+   * Parse 64-bit float from the char sequence. <br>
+   * Parsing is locale-independent and the result is correctly rounded. <br>
+   * Accepts optional leading whitespaces, sign, decimal number with optional fraction and exponent,
+   * and also `inf`, `infinity`, `nan` (case-insensitive).
+   * @param data - pointer to data.
+   * @param size - data size.
+   * @param value - out parameter. Parsed value.
+   * @return - number of chars consumed. `0` if data doesn't start with a valid number.
+   */
+  v_buff_size charSequenceToFloat64(const char* data, v_buff_size size, v_float64& value);
+
   /**
    * String to 32-bit float.
    * @param str - string as `const char*`.
@@ -253,7 +299,9 @@ namespace oatpp { namespace utils { namespace conversion {
    * Convert 32-bit float to it's string representation.
    * @param value - 32-bit float value.
    * @param data - buffer to write data to.
-   * @param n - buffer size.
+   * @param n - buffer size. Should be at least 32 bytes for the shortest representation.
+   * @param format - pattern as for `snprintf`. If `nullptr` - the shortest representation which reads back
+   * to exactly the same value is written (locale-independent).
    * @return - length of the resultant string.
    */
   v_buff_size float32ToCharSequence(v_float32 value, p_char8 data, v_buff_size n, const char* format = OATPP_FLOAT_STRING_FORMAT);
@@ -262,7 +310,9 @@ namespace oatpp { namespace utils { namespace conversion {
    * Convert 64-bit float to it's string representation.
    * @param value - 64-bit float value.
    * @param data - buffer to write data to.
-   * @param n - buffer size.
+   * @param n - buffer size. Should be at least 32 bytes for the shortest representation.
+   * @param format - pattern as for `snprintf`. If `nullptr` - the shortest representation which reads back
+   * to exactly the same value is written (locale-independent).
    * @return - length of the resultant string.
    */
   v_buff_size float64ToCharSequence(v_float64 value, p_char8 data, v_buff_size n, const char* format = OATPP_FLOAT_STRING_FORMAT);
@@ -270,6 +320,7 @@ namespace oatpp { namespace utils { namespace conversion {
   /**
    * Convert 32-bit float to it's string representation.
    * @param value - 32-bit float value.
+   * @param format - pattern as for `snprintf`. If `nullptr` - the shortest round-trip representation is used.
    * @return - value as `oatpp::String`
    */
   oatpp::String float32ToStr(v_float32 value, const char* format = OATPP_FLOAT_STRING_FORMAT);
@@ -277,6 +328,7 @@ namespace oatpp { namespace utils { namespace conversion {
   /**
    * Convert 64-bit float to it's string representation.
    * @param value - 64-bit float value.
+   * @param format - pattern as for `snprintf`. If `nullptr` - the shortest round-trip representation is used.
    * @return - value as `oatpp::String`
    */
   oatpp::String float64ToStr(v_float64 value, const char* format = OATPP_FLOAT_STRING_FORMAT);
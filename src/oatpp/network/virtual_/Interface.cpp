@@ -76,6 +76,7 @@ void Interface::unregisterInterface(const oatpp::String& name) {
 Interface::Interface(const oatpp::String& name)
   : m_name(name)
   , m_listenerLock(nullptr)
+  , m_zeroCopy(false)
 {}
 
 Interface::~Interface() {
@@ -147,8 +148,9 @@ bool Interface::ConnectionSubmission::isValid() {
   
 std::shared_ptr<Socket> Interface::acceptSubmission(const std::shared_ptr<ConnectionSubmission>& submission) {
   
-  auto pipeIn = Pipe::createShared();
-  auto pipeOut = Pipe::createShared();
+  bool zeroCopy = m_zeroCopy;
+  auto pipeIn = Pipe::createShared(zeroCopy);
+  auto pipeOut = Pipe::createShared(zeroCopy);
 
   auto serverSocket = Socket::createShared(pipeIn, pipeOut);
   auto clientSocket = Socket::createShared(pipeOut, pipeIn);
@@ -248,5 +250,13 @@ void Interface::dropAllConnection() {
 void Interface::notifyAcceptors() {
   m_condition.notify_all();
 }
+
+void Interface::setZeroCopy(bool zeroCopy) {
+  m_zeroCopy = zeroCopy;
+}
+
+bool Interface::isZeroCopy() {
+  return m_zeroCopy;
+}
   
 }}}
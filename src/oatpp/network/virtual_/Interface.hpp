@@ -117,6 +117,7 @@ private:
   std::mutex m_mutex;
   std::condition_variable m_condition;
   oatpp::collection::LinkedList<std::shared_ptr<ConnectionSubmission>> m_submissions;
+  std::atomic<bool> m_zeroCopy;
 private:
 
   Interface(const oatpp::String& name);
@@ -184,6 +185,21 @@ public:
    */
   void notifyAcceptors();
 
+  /**
+   * Enable/disable zero-copy mode for new connections. <br>
+   * In zero-copy mode connection pipes pass refcounted slices - see &id:oatpp::network::virtual_::Pipe;.
+   * Writers hand whole buffers to the peer (&id:oatpp::data::buffer::SliceOutput;) instead of copying them to the pipe buffer.
+   * Existing connections are not affected.
+   * @param zeroCopy - `true` to enable zero-copy mode.
+   */
+  void setZeroCopy(bool zeroCopy);
+
+  /**
+   * Check if new connections are created in zero-copy mode.
+   * @return - `true` if zero-copy mode is enabled.
+   */
+  bool isZeroCopy();
+
   /**
    * Get interface name.
    * @return - &id:oatpp::String;.
@@ -24,6 +24,8 @@
 
 #include "Pipe.hpp"
 
+#include <cstring>
+
 namespace oatpp { namespace network { namespace virtual_ {
 
 data::stream::DefaultInitializedContext Pipe::Reader::DEFAULT_CONTEXT(data::stream::StreamType::STREAM_INFINITE);
@@ -45,42 +47,88 @@ v_io_size Pipe::Reader::read(void *data, v_buff_size count, async::Action& actio
   if(m_maxAvailableToRead > -1 && count > m_maxAvailableToRead) {
     count = m_maxAvailableToRead;
   }
+
+  if(count <= 0) {
+    return 0;
+  }
   
   Pipe& pipe = *m_pipe;
-  oatpp::v_io_size result;
-  
-  if(m_ioMode == oatpp::data::stream::IOMode::ASYNCHRONOUS) {
+  oatpp::v_io_size result = pipe.readFromRing(data, count);
+
+  while(result == 0) {
 
-    std::lock_guard<std::mutex> lock(pipe.m_mutex);
+    if(!pipe.m_open) {
+      /* data written before close() is still readable */
+      result = pipe.readFromRing(data, count);
+      if(result == 0) {
+        result = IOError::BROKEN_PIPE;
+      }
+      break;
+    }
 
-    if (pipe.m_fifo.availableToRead() > 0) {
-      result = pipe.m_fifo.read(data, count);
-    } else if (pipe.m_open) {
+    if(m_ioMode == oatpp::data::stream::IOMode::ASYNCHRONOUS) {
       action = async::Action::createWaitListAction(&m_waitList);
       result = IOError::RETRY_READ;
-    } else {
-      result = IOError::BROKEN_PIPE;
+      break;
     }
 
-  } else {
-    std::unique_lock<std::mutex> lock(pipe.m_mutex);
-    while (pipe.m_fifo.availableToRead() == 0 && pipe.m_open) {
-      pipe.m_conditionRead.wait(lock);
+    pipe.parkReader();
+    result = pipe.readFromRing(data, count);
+
+  }
+  
+  return result;
+  
+}
+
+v_io_size Pipe::Reader::readSlice(data::buffer::BufferChain::Slice& slice, v_buff_size count, async::Action& action) {
+
+  if(!m_pipe->m_slices) {
+    auto buffer = data::buffer::IOBuffer::createShared();
+    if(count > buffer->getSize()) {
+      count = buffer->getSize();
     }
-    if (pipe.m_fifo.availableToRead() > 0) {
-      result = pipe.m_fifo.read(data, count);
-    } else {
-      result = IOError::BROKEN_PIPE;
+    auto res = read(buffer->getData(), count, action);
+    if(res > 0) {
+      slice = {buffer, (p_char8) buffer->getData(), res};
     }
+    return res;
   }
 
-  if(result > 0) {
-    pipe.m_conditionWrite.notify_one();
-    pipe.m_writer.notifyWaitList();
+  if(m_maxAvailableToRead > -1 && count > m_maxAvailableToRead) {
+    count = m_maxAvailableToRead;
   }
-  
+
+  if(count <= 0) {
+    return 0;
+  }
+
+  Pipe& pipe = *m_pipe;
+  oatpp::v_io_size result = pipe.readSliceFromSlices(slice, count);
+
+  while(result == 0) {
+
+    if(!pipe.m_open) {
+      result = pipe.readSliceFromSlices(slice, count);
+      if(result == 0) {
+        result = IOError::BROKEN_PIPE;
+      }
+      break;
+    }
+
+    if(m_ioMode == oatpp::data::stream::IOMode::ASYNCHRONOUS) {
+      action = async::Action::createWaitListAction(&m_waitList);
+      result = IOError::RETRY_READ;
+      break;
+    }
+
+    pipe.parkReader();
+    result = pipe.readSliceFromSlices(slice, count);
+
+  }
+
   return result;
-  
+
 }
 
 oatpp::data::stream::Context& Pipe::Reader::getInputStreamContext() {
@@ -117,59 +165,337 @@ v_io_size Pipe::Writer::write(const void *data, v_buff_size count, async::Action
     count = m_maxAvailableToWrtie;
   }
 
+  if(count <= 0) {
+    return 0;
+  }
+
   Pipe& pipe = *m_pipe;
-  oatpp::v_io_size result;
-  
-  if(m_ioMode == oatpp::data::stream::IOMode::ASYNCHRONOUS) {
+  oatpp::v_io_size result = 0;
 
-    std::lock_guard<std::mutex> lock(pipe.m_mutex);
+  while(result == 0) {
 
-    if (pipe.m_fifo.availableToWrite() > 0) {
-      result = pipe.m_fifo.write(data, count);
-    } else if (pipe.m_open) {
-      action = async::Action::createWaitListAction(&m_waitList);
-      result = IOError::RETRY_WRITE;
-    } else {
+    if(!pipe.m_open) {
       result = IOError::BROKEN_PIPE;
+      break;
     }
 
-  } else {
-    std::unique_lock<std::mutex> lock(pipe.m_mutex);
-    while (pipe.m_fifo.availableToWrite() == 0 && pipe.m_open) {
-      pipe.m_conditionWrite.wait(lock);
+    result = pipe.writeToRing(data, count);
+    if(result > 0) {
+      break;
     }
-    if (pipe.m_open && pipe.m_fifo.availableToWrite() > 0) {
-      result = pipe.m_fifo.write(data, count);
-    } else {
-      result = IOError::BROKEN_PIPE;
+
+    if(m_ioMode == oatpp::data::stream::IOMode::ASYNCHRONOUS) {
+      action = async::Action::createWaitListAction(&m_waitList);
+      result = IOError::RETRY_WRITE;
+      break;
     }
-  }
 
-  if(result > 0) {
-    pipe.m_conditionRead.notify_one();
-    pipe.m_reader.notifyWaitList();
+    pipe.parkWriter();
+
   }
   
   return result;
   
 }
 
+v_io_size Pipe::Writer::writeSlice(const data::buffer::BufferChain::Slice& slice, async::Action& action) {
+
+  /* Limits set for testing purposes are applied by the regular write */
+  if(!m_pipe->m_slices || m_maxAvailableToWrtie > -1) {
+    return write(slice.data, slice.size, action);
+  }
+
+  if(slice.size <= 0) {
+    return 0;
+  }
+
+  Pipe& pipe = *m_pipe;
+  oatpp::v_io_size result = 0;
+
+  while(result == 0) {
+
+    if(!pipe.m_open) {
+      result = IOError::BROKEN_PIPE;
+      break;
+    }
+
+    result = pipe.writeSliceToSlices(slice);
+    if(result > 0) {
+      break;
+    }
+
+    if(m_ioMode == oatpp::data::stream::IOMode::ASYNCHRONOUS) {
+      action = async::Action::createWaitListAction(&m_waitList);
+      result = IOError::RETRY_WRITE;
+      break;
+    }
+
+    pipe.parkWriter();
+
+  }
+
+  return result;
+
+}
+
 void Pipe::Writer::notifyWaitList() {
   m_waitList.notifyAll();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-Pipe::Pipe()
-  : m_open(true)
+Pipe::Pipe(bool zeroCopy)
+  : m_readPosition(0)
+  , m_writePosition(0)
+  , m_open(true)
+  , m_readerParked(false)
+  , m_writerParked(false)
   , m_writer(this)
   , m_reader(this)
   , m_buffer()
-  , m_fifo(m_buffer.getData(), m_buffer.getSize())
-{}
+  , m_data((p_char8) m_buffer.getData())
+  , m_capacity((v_uint64) m_buffer.getSize())
+  , m_sliceOffset(0)
+  , m_writeBufferPosition(0)
+{
+  if(zeroCopy) {
+    m_slices.reset(new data::buffer::BufferChain::Slice[ZERO_COPY_SLOTS_COUNT]);
+    m_capacity = ZERO_COPY_SLOTS_COUNT;
+  }
+}
+
+v_buff_size Pipe::availableToRead() {
+  return (v_buff_size) (m_writePosition.load() - m_readPosition.load());
+}
 
-std::shared_ptr<Pipe> Pipe::createShared(){
-  return std::make_shared<Pipe>();
+v_buff_size Pipe::availableToWrite() {
+  return (v_buff_size) (m_capacity - (m_writePosition.load() - m_readPosition.load()));
+}
+
+void Pipe::onRead(v_uint64 readPosition) {
+  /* Writer could have seen the ring full - it might be parked */
+  if(m_writePosition.load() - readPosition == m_capacity) {
+    if(m_writerParked.load()) {
+      /* Synchronize with the parking thread, then notify outside of the lock */
+      { std::lock_guard<std::mutex> lock(m_mutex); }
+      m_conditionWrite.notify_one();
+    }
+    m_writer.notifyWaitList();
+  }
+}
+
+void Pipe::onWrite(v_uint64 writePosition) {
+  /* Reader could have seen the ring empty - it might be parked */
+  if(m_readPosition.load() == writePosition) {
+    if(m_readerParked.load()) {
+      /* Synchronize with the parking thread, then notify outside of the lock */
+      { std::lock_guard<std::mutex> lock(m_mutex); }
+      m_conditionRead.notify_one();
+    }
+    m_reader.notifyWaitList();
+  }
+}
+
+v_io_size Pipe::readFromRing(void* data, v_buff_size count) {
+
+  if(m_slices) {
+    return readFromSlices(data, count);
+  }
+
+  const v_uint64 readPosition = m_readPosition.load(std::memory_order_relaxed);
+  const v_uint64 writePosition = m_writePosition.load();
+
+  v_uint64 size = writePosition - readPosition;
+  if(size == 0) {
+    return 0;
+  }
+  if(size > (v_uint64) count) {
+    size = (v_uint64) count;
+  }
+
+  const v_uint64 index = readPosition % m_capacity;
+  v_uint64 head = m_capacity - index;
+  if(head > size) {
+    head = size;
+  }
+  std::memcpy(data, &m_data[index], head);
+  std::memcpy((p_char8) data + head, m_data, size - head);
+
+  m_readPosition.store(readPosition + size);
+  onRead(readPosition);
+
+  return (v_io_size) size;
+
+}
+
+v_io_size Pipe::writeToRing(const void* data, v_buff_size count) {
+
+  if(m_slices) {
+    return writeToSlices(data, count);
+  }
+
+  const v_uint64 writePosition = m_writePosition.load(std::memory_order_relaxed);
+  const v_uint64 readPosition = m_readPosition.load();
+
+  v_uint64 size = m_capacity - (writePosition - readPosition);
+  if(size == 0) {
+    return 0;
+  }
+  if(size > (v_uint64) count) {
+    size = (v_uint64) count;
+  }
+
+  const v_uint64 index = writePosition % m_capacity;
+  v_uint64 head = m_capacity - index;
+  if(head > size) {
+    head = size;
+  }
+  std::memcpy(&m_data[index], data, head);
+  std::memcpy(m_data, (const char*) data + head, size - head);
+
+  m_writePosition.store(writePosition + size);
+  onWrite(writePosition);
+
+  return (v_io_size) size;
+
+}
+
+v_io_size Pipe::readFromSlices(void* data, v_buff_size count) {
+
+  const v_uint64 readPosition = m_readPosition.load(std::memory_order_relaxed);
+  const v_uint64 writePosition = m_writePosition.load();
+
+  v_uint64 position = readPosition;
+  v_buff_size result = 0;
+
+  while(position < writePosition && result < count) {
+
+    auto& slice = m_slices[position % m_capacity];
+
+    v_buff_size size = slice.size - m_sliceOffset;
+    if(size > count - result) {
+      size = count - result;
+    }
+
+    std::memcpy((p_char8) data + result, slice.data + m_sliceOffset, size);
+    result += size;
+    m_sliceOffset += size;
+
+    if(m_sliceOffset == slice.size) {
+      slice.owner.reset();
+      m_sliceOffset = 0;
+      ++ position;
+    }
+
+  }
+
+  if(position != readPosition) {
+    m_readPosition.store(position);
+    onRead(readPosition);
+  }
+
+  return result;
+
+}
+
+v_io_size Pipe::readSliceFromSlices(data::buffer::BufferChain::Slice& slice, v_buff_size count) {
+
+  const v_uint64 readPosition = m_readPosition.load(std::memory_order_relaxed);
+  if(m_writePosition.load() == readPosition) {
+    return 0;
+  }
+
+  auto& first = m_slices[readPosition % m_capacity];
+
+  v_buff_size size = first.size - m_sliceOffset;
+  if(size > count) {
+    size = count;
+  }
+
+  slice.data = first.data + m_sliceOffset;
+  slice.size = size;
+  m_sliceOffset += size;
+
+  if(m_sliceOffset == first.size) {
+    slice.owner = std::move(first.owner);
+    m_sliceOffset = 0;
+    m_readPosition.store(readPosition + 1);
+    onRead(readPosition);
+  } else {
+    slice.owner = first.owner;
+  }
+
+  return size;
+
+}
+
+v_io_size Pipe::writeToSlices(const void* data, v_buff_size count) {
+
+  const v_uint64 writePosition = m_writePosition.load(std::memory_order_relaxed);
+  if(writePosition - m_readPosition.load() == m_capacity) {
+    return 0;
+  }
+
+  /* Published parts of the write buffer are never modified - the next write takes the space after them */
+  if(!m_writeBuffer || m_writeBufferPosition == m_writeBuffer->getSize()) {
+    m_writeBuffer = data::buffer::IOBuffer::createShared();
+    m_writeBufferPosition = 0;
+  }
+
+  v_buff_size size = m_writeBuffer->getSize() - m_writeBufferPosition;
+  if(size > count) {
+    size = count;
+  }
+
+  p_char8 slot = (p_char8) m_writeBuffer->getData() + m_writeBufferPosition;
+  std::memcpy(slot, data, size);
+  m_writeBufferPosition += size;
+
+  m_slices[writePosition % m_capacity] = {m_writeBuffer, slot, size};
+
+  m_writePosition.store(writePosition + 1);
+  onWrite(writePosition);
+
+  return size;
+
+}
+
+v_io_size Pipe::writeSliceToSlices(const data::buffer::BufferChain::Slice& slice) {
+
+  const v_uint64 writePosition = m_writePosition.load(std::memory_order_relaxed);
+  if(writePosition - m_readPosition.load() == m_capacity) {
+    return 0;
+  }
+
+  m_slices[writePosition % m_capacity] = slice;
+
+  m_writePosition.store(writePosition + 1);
+  onWrite(writePosition);
+
+  return slice.size;
+
+}
+
+void Pipe::parkReader() {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_readerParked.store(true);
+  while (availableToRead() == 0 && m_open) {
+    m_conditionRead.wait(lock);
+  }
+  m_readerParked.store(false);
+}
+
+void Pipe::parkWriter() {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_writerParked.store(true);
+  while (availableToWrite() == 0 && m_open) {
+    m_conditionWrite.wait(lock);
+  }
+  m_writerParked.store(false);
+}
+
+std::shared_ptr<Pipe> Pipe::createShared(bool zeroCopy){
+  return std::make_shared<Pipe>(zeroCopy);
 }
 
 Pipe::~Pipe() {
@@ -184,14 +510,18 @@ Pipe::Reader* Pipe::getReader() {
   return &m_reader;
 }
 
+bool Pipe::isZeroCopy() {
+  return m_slices != nullptr;
+}
+
 void Pipe::close() {
+  m_open.store(false);
   {
     std::lock_guard<std::mutex> lock(m_mutex);
-    m_open = false;
+    m_conditionRead.notify_all();
+    m_conditionWrite.notify_all();
   }
-  m_conditionRead.notify_one();
   m_reader.notifyWaitList();
-  m_conditionWrite.notify_one();
   m_writer.notifyWaitList();
 }
 
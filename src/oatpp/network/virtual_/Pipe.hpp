@@ -29,11 +29,10 @@
 
 #include "oatpp/core/data/stream/Stream.hpp"
 
-#include "oatpp/core/data/buffer/FIFOBuffer.hpp"
+#include "oatpp/core/data/buffer/BufferChain.hpp"
 #include "oatpp/core/data/buffer/IOBuffer.hpp"
 
-#include "oatpp/core/concurrency/SpinLock.hpp"
-
+#include <atomic>
 #include <mutex>
 #include <condition_variable>
 
@@ -41,7 +40,11 @@ namespace oatpp { namespace network { namespace virtual_ {
 
 /**
  * Virtual pipe implementation. Can be used for unidirectional data transfer between different threads of the same process. <br>
- * Under the hood it uses &id:oatpp::data::buffer::SynchronizedFIFOBuffer; over the &id:oatpp::data::buffer::IOBuffer;.
+ * Under the hood it uses a lock-free single-producer/single-consumer ring buffer over the &id:oatpp::data::buffer::IOBuffer;.
+ * Reader and writer only synchronize when one of them has to park - the reader on an empty pipe, the writer on a full one. <br>
+ * In zero-copy mode the ring holds refcounted slices (&id:oatpp::data::buffer::BufferChain::Slice;) instead of bytes.
+ * Writer may hand whole buffers to the reader via &l:Pipe::Writer::writeSlice (); and reader may take them via &l:Pipe::Reader::readSlice ();
+ * without copying the data.
  */
 class Pipe : public oatpp::base::Countable {
 public:
@@ -66,8 +69,7 @@ public:
       {}
 
       void onNewItem(oatpp::async::CoroutineWaitList& list) override {
-        std::lock_guard<std::mutex> lock(m_pipe->m_mutex);
-        if (m_pipe->m_fifo.availableToRead() > 0 || !m_pipe->m_open) {
+        if (m_pipe->availableToRead() > 0 || !m_pipe->m_open) {
           list.notifyAll();
         }
       }
@@ -117,6 +119,18 @@ public:
      */
     v_io_size read(void *data, v_buff_size count, async::Action& action) override;
 
+    /**
+     * Read data from pipe as a refcounted slice. <br>
+     * In zero-copy mode the slice references the memory handed over by the writer - no data is copied.
+     * Otherwise data is read to a new &id:oatpp::data::buffer::IOBuffer;.
+     * @param slice - &id:oatpp::data::buffer::BufferChain::Slice; to put data to.
+     * @param count - max count of bytes to read.
+     * @param action - async specific action. If action is NOT &id:oatpp::async::Action::TYPE_NONE;, then
+     * caller MUST return this action on coroutine iteration.
+     * @return - &id:oatpp::v_io_size;.
+     */
+    v_io_size readSlice(data::buffer::BufferChain::Slice& slice, v_buff_size count, async::Action& action);
+
     /**
      * Set InputStream I/O mode.
      * @param ioMode
@@ -160,8 +174,7 @@ public:
       {}
 
       void onNewItem(oatpp::async::CoroutineWaitList& list) override {
-        std::lock_guard<std::mutex> lock(m_pipe->m_mutex);
-        if (m_pipe->m_fifo.availableToWrite() > 0 || !m_pipe->m_open) {
+        if (m_pipe->availableToWrite() > 0 || !m_pipe->m_open) {
           list.notifyAll();
         }
       }
@@ -209,6 +222,17 @@ public:
      */
     v_io_size write(const void *data, v_buff_size count, async::Action& action) override;
 
+    /**
+     * Hand a refcounted slice over to the reader. <br>
+     * In zero-copy mode the whole slice is queued by reference - no data is copied.
+     * Otherwise this is the same as &l:Pipe::Writer::write (); and may write only a part of the slice.
+     * @param slice - &id:oatpp::data::buffer::BufferChain::Slice;. Slice must have an owner.
+     * @param action - async specific action. If action is NOT &id:oatpp::async::Action::TYPE_NONE;, then
+     * caller MUST return this action on coroutine iteration.
+     * @return - &id:oatpp::v_io_size;.
+     */
+    v_io_size writeSlice(const data::buffer::BufferChain::Slice& slice, async::Action& action);
+
     /**
      * Set OutputStream I/O mode.
      * @param ioMode
@@ -234,29 +258,81 @@ public:
     
   };
   
+public:
+
+  /**
+   * Number of slices the pipe can hold in zero-copy mode.
+   */
+  static constexpr v_buff_size ZERO_COPY_SLOTS_COUNT = 64;
 private:
-  bool m_open;
+  static constexpr v_buff_size CACHE_LINE_SIZE = 64;
+private:
+
+  /*
+   * Positions grow monotonically and are never wrapped - `m_writePosition - m_readPosition` is the amount of data in the ring.
+   * In zero-copy mode positions count slices instead of bytes.
+   * Reader owns m_readPosition, writer owns m_writePosition. They are kept on different cache lines.
+   */
+  std::atomic<v_uint64> m_readPosition;
+  v_char8 m_readPositionPadding[CACHE_LINE_SIZE];
+  std::atomic<v_uint64> m_writePosition;
+  v_char8 m_writePositionPadding[CACHE_LINE_SIZE];
+
+  std::atomic<bool> m_open;
+  std::atomic<bool> m_readerParked;
+  std::atomic<bool> m_writerParked;
+
   Writer m_writer;
   Reader m_reader;
 
   oatpp::data::buffer::IOBuffer m_buffer;
-  oatpp::data::buffer::SynchronizedFIFOBuffer m_fifo;
+  p_char8 m_data;
+  v_uint64 m_capacity;
 
+  /*
+   * Zero-copy mode only.
+   * m_sliceOffset - bytes of the first slice consumed by reader. Owned by reader.
+   * m_writeBuffer, m_writeBufferPosition - buffer for data passed to regular write(). Owned by writer.
+   */
+  std::unique_ptr<data::buffer::BufferChain::Slice[]> m_slices;
+  v_buff_size m_sliceOffset;
+  std::shared_ptr<data::buffer::IOBuffer> m_writeBuffer;
+  v_buff_size m_writeBufferPosition;
+
+  /*
+   * Used only to park blocking reader/writer.
+   */
   std::mutex m_mutex;
   std::condition_variable m_conditionRead;
   std::condition_variable m_conditionWrite;
+
+private:
+  v_buff_size availableToRead();
+  v_buff_size availableToWrite();
+  v_io_size readFromRing(void* data, v_buff_size count);
+  v_io_size writeToRing(const void* data, v_buff_size count);
+  v_io_size readFromSlices(void* data, v_buff_size count);
+  v_io_size readSliceFromSlices(data::buffer::BufferChain::Slice& slice, v_buff_size count);
+  v_io_size writeToSlices(const void* data, v_buff_size count);
+  v_io_size writeSliceToSlices(const data::buffer::BufferChain::Slice& slice);
+  void onRead(v_uint64 readPosition);
+  void onWrite(v_uint64 writePosition);
+  void parkReader();
+  void parkWriter();
 public:
 
   /**
    * Constructor.
+   * @param zeroCopy - `true` to pass refcounted slices through the pipe instead of copying data to the ring buffer.
    */
-  Pipe();
+  Pipe(bool zeroCopy = false);
 
   /**
    * Create shared pipe.
+   * @param zeroCopy - `true` to pass refcounted slices through the pipe instead of copying data to the ring buffer.
    * @return - `std::shared_ptr` to Pipe.
    */
-  static std::shared_ptr<Pipe> createShared();
+  static std::shared_ptr<Pipe> createShared(bool zeroCopy = false);
 
   /**
    * Virtual destructor.
@@ -278,6 +354,12 @@ public:
    */
   Reader* getReader();
 
+  /**
+   * Check if pipe passes refcounted slices instead of copying data.
+   * @return - `true` if pipe is in zero-copy mode.
+   */
+  bool isZeroCopy();
+
   /**
    * Mark pipe as closed.
    */
@@ -52,6 +52,18 @@ v_io_size Socket::write(const void *data, v_buff_size count, async::Action& acti
   return m_pipeOut->getWriter()->write(data, count, action);
 }
 
+v_io_size Socket::readSlice(data::buffer::BufferChain::Slice& slice, v_buff_size count, async::Action& action) {
+  return m_pipeIn->getReader()->readSlice(slice, count, action);
+}
+
+bool Socket::canAdoptSlices() {
+  return m_pipeOut->isZeroCopy();
+}
+
+v_io_size Socket::writeSlice(const data::buffer::BufferChain::Slice& slice, async::Action& action) {
+  return m_pipeOut->getWriter()->writeSlice(slice, action);
+}
+
 void Socket::setOutputStreamIOMode(oatpp::data::stream::IOMode ioMode) {
   m_pipeOut->getWriter()->setOutputStreamIOMode(ioMode);
 }
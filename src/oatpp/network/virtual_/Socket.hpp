@@ -32,9 +32,10 @@ namespace oatpp { namespace network { namespace virtual_ {
 /**
  * Virtual socket implementation. Can be used as a bidirectional data transfer between different threads of the same process. <br>
  * Under the hood it uses a pair of &id:oatpp::network::virtual_::Pipe;. One to write data to, and one to read data from.
- * Extends &id:oatpp::base::Countable; and &id:oatpp::data::stream::IOStream;.
+ * Extends &id:oatpp::base::Countable;, &id:oatpp::data::stream::IOStream; and &id:oatpp::data::buffer::SliceOutput;.
+ * When the output pipe is in zero-copy mode, refcounted slices are handed over to the peer without copying.
  */
-class Socket : public oatpp::data::stream::IOStream, public oatpp::base::Countable {
+class Socket : public oatpp::data::stream::IOStream, public oatpp::data::buffer::SliceOutput, public oatpp::base::Countable {
 private:
   std::shared_ptr<Pipe> m_pipeIn;
   std::shared_ptr<Pipe> m_pipeOut;
@@ -88,6 +89,31 @@ public:
    */
   v_io_size write(const void *data, v_buff_size count, async::Action& action) override;
 
+  /**
+   * Read data from socket as a refcounted slice. See &id:oatpp::network::virtual_::Pipe::Reader::readSlice;.
+   * @param slice - &id:oatpp::data::buffer::BufferChain::Slice; to put data to.
+   * @param count - max count of bytes to read.
+   * @param action - async specific action. If action is NOT &id:oatpp::async::Action::TYPE_NONE;, then
+   * caller MUST return this action on coroutine iteration.
+   * @return - &id:oatpp::v_io_size;.
+   */
+  v_io_size readSlice(data::buffer::BufferChain::Slice& slice, v_buff_size count, async::Action& action);
+
+  /**
+   * Check if the output pipe is in zero-copy mode.
+   * @return - `true` if slices are handed over without copy.
+   */
+  bool canAdoptSlices() override;
+
+  /**
+   * Hand the refcounted slice over to the peer. See &id:oatpp::network::virtual_::Pipe::Writer::writeSlice;.
+   * @param slice - &id:oatpp::data::buffer::BufferChain::Slice;. Slice must have an owner.
+   * @param action - async specific action. If action is NOT &id:oatpp::async::Action::TYPE_NONE;, then
+   * caller MUST return this action on coroutine iteration.
+   * @return - &id:oatpp::v_io_size;.
+   */
+  v_io_size writeSlice(const data::buffer::BufferChain::Slice& slice, async::Action& action) override;
+
   /**
    * Set OutputStream I/O mode.
    * @param ioMode
@@ -0,0 +1,310 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "Utils.hpp"
+
+#include "oatpp/core/data/stream/ChunkedBuffer.hpp"
+
+#include <cmath>
+#include <cstring>
+
+namespace oatpp { namespace parser { namespace cbor {
+
+void Utils::writeHead(data::stream::ConsistentOutputStream* stream, v_uint8 majorType, v_uint64 argument) {
+
+  v_char8 buffer[9];
+  v_uint8 initialByte = (v_uint8) (majorType << 5);
+  v_buff_size size;
+
+  if(argument < 24) {
+    buffer[0] = (v_char8) (initialByte | argument);
+    size = 1;
+  } else if(argument <= 0xFF) {
+    buffer[0] = initialByte | 24;
+    size = 2;
+  } else if(argument <= 0xFFFF) {
+    buffer[0] = initialByte | 25;
+    size = 3;
+  } else if(argument <= 0xFFFFFFFF) {
+    buffer[0] = initialByte | 26;
+    size = 5;
+  } else {
+    buffer[0] = initialByte | 27;
+    size = 9;
+  }
+
+  for(v_buff_size i = size - 1; i > 0; i --) {
+    buffer[i] = (v_char8) (argument & 0xFF);
+    argument >>= 8;
+  }
+
+  stream->writeSimple(buffer, size);
+
+}
+
+void Utils::writeInt(data::stream::ConsistentOutputStream* stream, v_int64 value) {
+  if(value >= 0) {
+    writeHead(stream, MAJOR_TYPE_UNSIGNED_INT, (v_uint64) value);
+  } else {
+    writeHead(stream, MAJOR_TYPE_NEGATIVE_INT, ~((v_uint64) value));
+  }
+}
+
+void Utils::writeFloat32(data::stream::ConsistentOutputStream* stream, v_float32 value) {
+  v_uint32 bits;
+  std::memcpy(&bits, &value, 4);
+  v_char8 buffer[5];
+  buffer[0] = (MAJOR_TYPE_SIMPLE << 5) | INFO_FLOAT32;
+  for(v_int32 i = 4; i > 0; i --) {
+    buffer[i] = (v_char8) (bits & 0xFF);
+    bits >>= 8;
+  }
+  stream->writeSimple(buffer, 5);
+}
+
+void Utils::writeFloat64(data::stream::ConsistentOutputStream* stream, v_float64 value) {
+  v_uint64 bits;
+  std::memcpy(&bits, &value, 8);
+  v_char8 buffer[9];
+  buffer[0] = (MAJOR_TYPE_SIMPLE << 5) | INFO_FLOAT64;
+  for(v_int32 i = 8; i > 0; i --) {
+    buffer[i] = (v_char8) (bits & 0xFF);
+    bits >>= 8;
+  }
+  stream->writeSimple(buffer, 9);
+}
+
+void Utils::writeString(data::stream::ConsistentOutputStream* stream, const void* data, v_buff_size size) {
+  writeHead(stream, MAJOR_TYPE_TEXT_STRING, (v_uint64) size);
+  stream->writeSimple(data, size);
+}
+
+void Utils::writeSimple(data::stream::ConsistentOutputStream* stream, v_uint8 value) {
+  v_char8 byte = (MAJOR_TYPE_SIMPLE << 5) | value;
+  stream->writeSimple(&byte, 1);
+}
+
+bool Utils::readHead(parser::Caret& caret, Head& head) {
+
+  p_char8 data = caret.getData();
+  v_buff_size size = caret.getDataSize();
+  v_buff_size pos = caret.getPosition();
+
+  while(true) {
+
+    if(pos >= size) {
+      caret.setError("[oatpp::parser::cbor::Utils::readHead()]: Error. Unexpected end of data.", ERROR_CODE_UNEXPECTED_END);
+      return false;
+    }
+
+    v_uint8 initialByte = data[pos ++];
+    head.majorType = initialByte >> 5;
+    head.info = initialByte & 31;
+
+    v_buff_size argumentSize;
+    if(head.info < 24) {
+      head.argument = head.info;
+      argumentSize = 0;
+    } else if(head.info <= 27) {
+      argumentSize = (v_buff_size) 1 << (head.info - 24);
+    } else if(head.info == INFO_INDEFINITE &&
+              head.majorType >= MAJOR_TYPE_BYTE_STRING && head.majorType <= MAJOR_TYPE_MAP)
+    {
+      head.argument = 0;
+      argumentSize = 0;
+    } else {
+      caret.setPosition(pos - 1);
+      caret.setError("[oatpp::parser::cbor::Utils::readHead()]: Error. Invalid data item head.", ERROR_CODE_INVALID_HEAD);
+      return false;
+    }
+
+    if(argumentSize > 0) {
+      if(size - pos < argumentSize) {
+        caret.setPosition(size);
+        caret.setError("[oatpp::parser::cbor::Utils::readHead()]: Error. Unexpected end of data.", ERROR_CODE_UNEXPECTED_END);
+        return false;
+      }
+      head.argument = 0;
+      for(v_buff_size i = 0; i < argumentSize; i ++) {
+        head.argument = (head.argument << 8) | data[pos ++];
+      }
+    }
+
+    if(head.majorType != MAJOR_TYPE_TAG) {
+      break;
+    }
+
+  }
+
+  caret.setPosition(pos);
+  return true;
+
+}
+
+bool Utils::skipNull(parser::Caret& caret) {
+  if(caret.canContinue()) {
+    v_uint8 byte = *caret.getCurrData();
+    if(byte == BYTE_NULL || byte == ((MAJOR_TYPE_SIMPLE << 5) | SIMPLE_UNDEFINED)) {
+      caret.inc();
+      return true;
+    }
+  }
+  return false;
+}
+
+bool Utils::skipBreak(parser::Caret& caret) {
+  if(caret.canContinue() && *caret.getCurrData() == BYTE_BREAK) {
+    caret.inc();
+    return true;
+  }
+  return false;
+}
+
+v_float64 Utils::getFloat(const Head& head) {
+
+  switch(head.info) {
+
+    case INFO_FLOAT16: {
+      v_int32 exponent = (head.argument >> 10) & 0x1F;
+      v_int32 mantissa = head.argument & 0x3FF;
+      v_float64 value;
+      if(exponent == 0) {
+        value = std::ldexp(mantissa, -24);
+      } else if(exponent != 31) {
+        value = std::ldexp(mantissa + 1024, exponent - 25);
+      } else {
+        value = mantissa == 0 ? INFINITY : NAN;
+      }
+      return (head.argument & 0x8000) ? -value : value;
+    }
+
+    case INFO_FLOAT32: {
+      v_uint32 bits = (v_uint32) head.argument;
+      v_float32 value;
+      std::memcpy(&value, &bits, 4);
+      return value;
+    }
+
+    default: {
+      v_float64 value;
+      std::memcpy(&value, &head.argument, 8);
+      return value;
+    }
+
+  }
+
+}
+
+const char* Utils::readStringInPlace(parser::Caret& caret, const Head& head, v_buff_size& size) {
+
+  if(head.info == INFO_INDEFINITE) {
+    return nullptr;
+  }
+
+  v_buff_size pos = caret.getPosition();
+  if((v_uint64) (caret.getDataSize() - pos) < head.argument) {
+    caret.setPosition(caret.getDataSize());
+    caret.setError("[oatpp::parser::cbor::Utils::readStringInPlace()]: Error. Unexpected end of data.", ERROR_CODE_UNEXPECTED_END);
+    return nullptr;
+  }
+
+  size = (v_buff_size) head.argument;
+  caret.setPosition(pos + size);
+  return (const char*) caret.getData() + pos;
+
+}
+
+oatpp::String Utils::readString(parser::Caret& caret, const Head& head) {
+
+  if(head.info != INFO_INDEFINITE) {
+    v_buff_size size;
+    const char* data = readStringInPlace(caret, head, size);
+    if(data == nullptr) {
+      return nullptr;
+    }
+    return oatpp::String(data, size, true);
+  }
+
+  data::stream::ChunkedBuffer buffer;
+
+  while(!skipBreak(caret)) {
+    Head chunkHead;
+    if(!readHead(caret, chunkHead)) {
+      return nullptr;
+    }
+    if(chunkHead.majorType != head.majorType || chunkHead.info == INFO_INDEFINITE) {
+      caret.setError("[oatpp::parser::cbor::Utils::readString()]: Error. Invalid chunk of indefinite length string.", ERROR_CODE_INVALID_HEAD);
+      return nullptr;
+    }
+    v_buff_size size;
+    const char* data = readStringInPlace(caret, chunkHead, size);
+    if(data == nullptr) {
+      return nullptr;
+    }
+    buffer.writeSimple(data, size);
+  }
+
+  return buffer.toString();
+
+}
+
+void Utils::skipValue(parser::Caret& caret) {
+
+  Head head;
+  if(!readHead(caret, head)) {
+    return;
+  }
+
+  switch(head.majorType) {
+
+    case MAJOR_TYPE_BYTE_STRING:
+    case MAJOR_TYPE_TEXT_STRING:
+      readString(caret, head);
+      return;
+
+    case MAJOR_TYPE_ARRAY:
+    case MAJOR_TYPE_MAP: {
+      v_uint64 itemsPerEntry = head.majorType == MAJOR_TYPE_MAP ? 2 : 1;
+      if(head.info == INFO_INDEFINITE) {
+        while(!caret.hasError() && !skipBreak(caret)) {
+          for(v_uint64 i = 0; i < itemsPerEntry; i ++) {
+            skipValue(caret);
+          }
+        }
+      } else {
+        for(v_uint64 i = 0; i < head.argument * itemsPerEntry && !caret.hasError(); i ++) {
+          skipValue(caret);
+        }
+      }
+      return;
+    }
+
+    default:
+      return;
+
+  }
+
+}
+
+}}}
@@ -0,0 +1,201 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_parser_cbor_Utils_hpp
+#define oatpp_parser_cbor_Utils_hpp
+
+#include "oatpp/core/parser/Caret.hpp"
+#include "oatpp/core/data/stream/Stream.hpp"
+#include "oatpp/core/Types.hpp"
+
+namespace oatpp { namespace parser { namespace cbor {
+
+/**
+ * Utility class for CBOR ([RFC 8949](https://tools.ietf.org/html/rfc8949)) encoding and decoding.
+ */
+class Utils {
+public:
+
+  /**
+   * Unexpected end of data.
+   */
+  static constexpr v_int64 ERROR_CODE_UNEXPECTED_END = 1;
+
+  /**
+   * Malformed data item head (reserved additional information or unexpected break).
+   */
+  static constexpr v_int64 ERROR_CODE_INVALID_HEAD = 2;
+
+public:
+
+  static constexpr v_uint8 MAJOR_TYPE_UNSIGNED_INT = 0;
+  static constexpr v_uint8 MAJOR_TYPE_NEGATIVE_INT = 1;
+  static constexpr v_uint8 MAJOR_TYPE_BYTE_STRING = 2;
+  static constexpr v_uint8 MAJOR_TYPE_TEXT_STRING = 3;
+  static constexpr v_uint8 MAJOR_TYPE_ARRAY = 4;
+  static constexpr v_uint8 MAJOR_TYPE_MAP = 5;
+  static constexpr v_uint8 MAJOR_TYPE_TAG = 6;
+  static constexpr v_uint8 MAJOR_TYPE_SIMPLE = 7;
+
+  static constexpr v_uint8 SIMPLE_FALSE = 20;
+  static constexpr v_uint8 SIMPLE_TRUE = 21;
+  static constexpr v_uint8 SIMPLE_NULL = 22;
+  static constexpr v_uint8 SIMPLE_UNDEFINED = 23;
+
+  static constexpr v_uint8 INFO_FLOAT16 = 25;
+  static constexpr v_uint8 INFO_FLOAT32 = 26;
+  static constexpr v_uint8 INFO_FLOAT64 = 27;
+  static constexpr v_uint8 INFO_INDEFINITE = 31;
+
+  static constexpr v_uint8 BYTE_NULL = 0xF6;
+  static constexpr v_uint8 BYTE_BREAK = 0xFF;
+
+public:
+
+  /**
+   * Head of CBOR data item.
+   */
+  struct Head {
+
+    /**
+     * Major type - 3 high bits of the initial byte.
+     */
+    v_uint8 majorType;
+
+    /**
+     * Additional information - 5 low bits of the initial byte.
+     */
+    v_uint8 info;
+
+    /**
+     * Argument. Length for strings, arrays, and maps. Raw bits for floats.
+     * Not used if `info == INFO_INDEFINITE`.
+     */
+    v_uint64 argument;
+
+  };
+
+public:
+
+  /**
+   * Write data item head with the shortest possible argument encoding.
+   * @param stream - &id:oatpp::data::stream::ConsistentOutputStream;.
+   * @param majorType - major type.
+   * @param argument - argument.
+   */
+  static void writeHead(data::stream::ConsistentOutputStream* stream, v_uint8 majorType, v_uint64 argument);
+
+  /**
+   * Write signed integer.
+   * @param stream - &id:oatpp::data::stream::ConsistentOutputStream;.
+   * @param value - value.
+   */
+  static void writeInt(data::stream::ConsistentOutputStream* stream, v_int64 value);
+
+  /**
+   * Write single precision float.
+   * @param stream - &id:oatpp::data::stream::ConsistentOutputStream;.
+   * @param value - value.
+   */
+  static void writeFloat32(data::stream::ConsistentOutputStream* stream, v_float32 value);
+
+  /**
+   * Write double precision float.
+   * @param stream - &id:oatpp::data::stream::ConsistentOutputStream;.
+   * @param value - value.
+   */
+  static void writeFloat64(data::stream::ConsistentOutputStream* stream, v_float64 value);
+
+  /**
+   * Write text string.
+   * @param stream - &id:oatpp::data::stream::ConsistentOutputStream;.
+   * @param data - pointer to utf-8 text.
+   * @param size - size of text in bytes.
+   */
+  static void writeString(data::stream::ConsistentOutputStream* stream, const void* data, v_buff_size size);
+
+  /**
+   * Write simple value (`false`, `true`, `null`).
+   * @param stream - &id:oatpp::data::stream::ConsistentOutputStream;.
+   * @param value - simple value.
+   */
+  static void writeSimple(data::stream::ConsistentOutputStream* stream, v_uint8 value);
+
+  /**
+   * Read data item head. Tags are skipped.
+   * @param caret - &id:oatpp::parser::Caret;.
+   * @param head - &l:Utils::Head;.
+   * @return - `false` on error. Error is set to caret.
+   */
+  static bool readHead(parser::Caret& caret, Head& head);
+
+  /**
+   * Check if current data item is `null` or `undefined` and skip it if so.
+   * @param caret - &id:oatpp::parser::Caret;.
+   * @return - `true` if null was skipped.
+   */
+  static bool skipNull(parser::Caret& caret);
+
+  /**
+   * Check if current byte is "break" stop code and skip it if so.
+   * @param caret - &id:oatpp::parser::Caret;.
+   * @return - `true` if "break" was skipped.
+   */
+  static bool skipBreak(parser::Caret& caret);
+
+  /**
+   * Get float value of simple float data item. Half, single, and double precision floats are supported.
+   * @param head - &l:Utils::Head; of float data item.
+   * @return - value.
+   */
+  static v_float64 getFloat(const Head& head);
+
+  /**
+   * Read text or byte string which head is already read.
+   * @param caret - &id:oatpp::parser::Caret;.
+   * @param head - &l:Utils::Head; of the string.
+   * @return - &id:oatpp::String;. `nullptr` on error.
+   */
+  static oatpp::String readString(parser::Caret& caret, const Head& head);
+
+  /**
+   * Get definite length string which head is already read without copying.
+   * @param caret - &id:oatpp::parser::Caret;.
+   * @param head - &l:Utils::Head; of the string.
+   * @param size - out parameter - size of the string.
+   * @return - pointer to string data within caret buffer. `nullptr` for indefinite length strings or on error.
+   */
+  static const char* readStringInPlace(parser::Caret& caret, const Head& head, v_buff_size& size);
+
+  /**
+   * Skip data item.
+   * @param caret - &id:oatpp::parser::Caret;.
+   */
+  static void skipValue(parser::Caret& caret);
+
+};
+
+}}}
+
+#endif // oatpp_parser_cbor_Utils_hpp
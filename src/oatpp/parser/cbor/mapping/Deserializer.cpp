@@ -0,0 +1,390 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "Deserializer.hpp"
+
+#include "oatpp/core/data/mapping/type/Any.hpp"
+
+namespace oatpp { namespace parser { namespace cbor { namespace mapping {
+
+Deserializer::Deserializer(const std::shared_ptr<Config>& config)
+  : m_config(config)
+{
+
+  m_methods.resize(data::mapping::type::ClassId::getClassCount(), nullptr);
+
+  setDeserializerMethod(data::mapping::type::__class::String::CLASS_ID, &Deserializer::deserializeString);
+  setDeserializerMethod(data::mapping::type::__class::Any::CLASS_ID, &Deserializer::deserializeAny);
+
+  setDeserializerMethod(data::mapping::type::__class::Int8::CLASS_ID, &Deserializer::deserializeInt<oatpp::Int8>);
+  setDeserializerMethod(data::mapping::type::__class::UInt8::CLASS_ID, &Deserializer::deserializeUInt<oatpp::UInt8>);
+
+  setDeserializerMethod(data::mapping::type::__class::Int16::CLASS_ID, &Deserializer::deserializeInt<oatpp::Int16>);
+  setDeserializerMethod(data::mapping::type::__class::UInt16::CLASS_ID, &Deserializer::deserializeUInt<oatpp::UInt16>);
+
+  setDeserializerMethod(data::mapping::type::__class::Int32::CLASS_ID, &Deserializer::deserializeInt<oatpp::Int32>);
+  setDeserializerMethod(data::mapping::type::__class::UInt32::CLASS_ID, &Deserializer::deserializeUInt<oatpp::UInt32>);
+
+  setDeserializerMethod(data::mapping::type::__class::Int64::CLASS_ID, &Deserializer::deserializeInt<oatpp::Int64>);
+  setDeserializerMethod(data::mapping::type::__class::UInt64::CLASS_ID, &Deserializer::deserializeUInt<oatpp::UInt64>);
+
+  setDeserializerMethod(data::mapping::type::__class::Float32::CLASS_ID, &Deserializer::deserializeFloat32);
+  setDeserializerMethod(data::mapping::type::__class::Float64::CLASS_ID, &Deserializer::deserializeFloat64);
+  setDeserializerMethod(data::mapping::type::__class::Boolean::CLASS_ID, &Deserializer::deserializeBoolean);
+
+  setDeserializerMethod(data::mapping::type::__class::AbstractObject::CLASS_ID, &Deserializer::deserializeObject);
+  setDeserializerMethod(data::mapping::type::__class::AbstractEnum::CLASS_ID, &Deserializer::deserializeEnum);
+
+  setDeserializerMethod(data::mapping::type::__class::AbstractVector::CLASS_ID, &Deserializer::deserializeList<oatpp::AbstractVector>);
+  setDeserializerMethod(data::mapping::type::__class::AbstractList::CLASS_ID, &Deserializer::deserializeList<oatpp::AbstractList>);
+  setDeserializerMethod(data::mapping::type::__class::AbstractUnorderedSet::CLASS_ID, &Deserializer::deserializeList<oatpp::AbstractUnorderedSet>);
+
+  setDeserializerMethod(data::mapping::type::__class::AbstractPairList::CLASS_ID, &Deserializer::deserializeKeyValue<oatpp::AbstractFields>);
+  setDeserializerMethod(data::mapping::type::__class::AbstractUnorderedMap::CLASS_ID, &Deserializer::deserializeKeyValue<oatpp::AbstractUnorderedFields>);
+
+}
+
+void Deserializer::setDeserializerMethod(const data::mapping::type::ClassId& classId, DeserializerMethod method) {
+  const v_uint32 id = classId.id;
+  if(id < m_methods.size()) {
+    m_methods[id] = method;
+  } else {
+    throw std::runtime_error("[oatpp::parser::cbor::mapping::Deserializer::setDeserializerMethod()]: Error. Unknown classId");
+  }
+}
+
+bool Deserializer::readInteger(parser::Caret& caret, bool& negative, v_uint64& absolute) {
+
+  Utils::Head head;
+  if(!Utils::readHead(caret, head)) {
+    return false;
+  }
+
+  switch(head.majorType) {
+    case Utils::MAJOR_TYPE_UNSIGNED_INT:
+      negative = false;
+      absolute = head.argument;
+      return true;
+    case Utils::MAJOR_TYPE_NEGATIVE_INT:
+      negative = true;
+      absolute = head.argument;
+      return true;
+    default:
+      caret.setError("[oatpp::parser::cbor::mapping::Deserializer::readInteger()]: Error. Integer expected.", ERROR_CODE_UNEXPECTED_TYPE);
+      return false;
+  }
+
+}
+
+oatpp::Void Deserializer::deserializeFloat32(Deserializer* deserializer, parser::Caret& caret, const Type* const type) {
+  auto value = deserializeFloat64(deserializer, caret, type);
+  if(caret.hasError()) {
+    return nullptr;
+  }
+  if(!value) {
+    return oatpp::Void(Float32::ObjectWrapper::Class::getType());
+  }
+  return Float32((v_float32) * static_cast<v_float64*>(value.get()));
+}
+
+oatpp::Void Deserializer::deserializeFloat64(Deserializer* deserializer, parser::Caret& caret, const Type* const type) {
+
+  (void) deserializer;
+  (void) type;
+
+  if(Utils::skipNull(caret)) {
+    return oatpp::Void(Float64::ObjectWrapper::Class::getType());
+  }
+
+  Utils::Head head;
+  if(!Utils::readHead(caret, head)) {
+    return nullptr;
+  }
+
+  switch(head.majorType) {
+
+    case Utils::MAJOR_TYPE_UNSIGNED_INT:
+      return Float64((v_float64) head.argument);
+
+    case Utils::MAJOR_TYPE_NEGATIVE_INT:
+      return Float64(-1.0 - (v_float64) head.argument);
+
+    case Utils::MAJOR_TYPE_SIMPLE:
+      if(head.info >= Utils::INFO_FLOAT16 && head.info <= Utils::INFO_FLOAT64) {
+        return Float64(Utils::getFloat(head));
+      }
+      break;
+
+    default:
+      break;
+
+  }
+
+  caret.setError("[oatpp::parser::cbor::mapping::Deserializer::deserializeFloat64()]: Error. Number expected.", ERROR_CODE_UNEXPECTED_TYPE);
+  return nullptr;
+
+}
+
+oatpp::Void Deserializer::deserializeBoolean(Deserializer* deserializer, parser::Caret& caret, const Type* const type) {
+
+  (void) deserializer;
+  (void) type;
+
+  if(Utils::skipNull(caret)) {
+    return oatpp::Void(Boolean::ObjectWrapper::Class::getType());
+  }
+
+  Utils::Head head;
+  if(!Utils::readHead(caret, head)) {
+    return nullptr;
+  }
+
+  if(head.majorType == Utils::MAJOR_TYPE_SIMPLE) {
+    if(head.info == Utils::SIMPLE_TRUE) {
+      return Boolean(true);
+    } else if(head.info == Utils::SIMPLE_FALSE) {
+      return Boolean(false);
+    }
+  }
+
+  caret.setError("[oatpp::parser::cbor::mapping::Deserializer::deserializeBoolean()]: Error. Boolean expected.", ERROR_CODE_UNEXPECTED_TYPE);
+  return nullptr;
+
+}
+
+oatpp::Void Deserializer::deserializeString(Deserializer* deserializer, parser::Caret& caret, const Type* const type) {
+
+  (void) deserializer;
+  (void) type;
+
+  if(Utils::skipNull(caret)) {
+    return oatpp::Void(String::Class::getType());
+  }
+
+  Utils::Head head;
+  if(!Utils::readHead(caret, head)) {
+    return nullptr;
+  }
+
+  if(head.majorType != Utils::MAJOR_TYPE_TEXT_STRING && head.majorType != Utils::MAJOR_TYPE_BYTE_STRING) {
+    caret.setError("[oatpp::parser::cbor::mapping::Deserializer::deserializeString()]: Error. String expected.", ERROR_CODE_UNEXPECTED_TYPE);
+    return nullptr;
+  }
+
+  return Utils::readString(caret, head);
+
+}
+
+const data::mapping::type::Type* Deserializer::guessType(parser::Caret& caret) {
+
+  Utils::Head head;
+  {
+    parser::Caret::StateSaveGuard stateGuard(caret);
+    if(!Utils::readHead(caret, head)) {
+      return nullptr;
+    }
+  }
+
+  switch(head.majorType) {
+
+    case Utils::MAJOR_TYPE_UNSIGNED_INT:
+      if(head.argument > (v_uint64) std::numeric_limits<v_int64>::max()) {
+        return UInt64::Class::getType();
+      }
+      return Int64::Class::getType();
+
+    case Utils::MAJOR_TYPE_NEGATIVE_INT:
+      return Int64::Class::getType();
+
+    case Utils::MAJOR_TYPE_BYTE_STRING:
+    case Utils::MAJOR_TYPE_TEXT_STRING:
+      return String::Class::getType();
+
+    case Utils::MAJOR_TYPE_ARRAY:
+      return oatpp::List<Any>::ObjectWrapper::Class::getType();
+
+    case Utils::MAJOR_TYPE_MAP:
+      return oatpp::Fields<Any>::ObjectWrapper::Class::getType();
+
+    case Utils::MAJOR_TYPE_SIMPLE:
+      switch(head.info) {
+        case Utils::SIMPLE_FALSE:
+        case Utils::SIMPLE_TRUE:
+          return Boolean::Class::getType();
+        case Utils::INFO_FLOAT16:
+        case Utils::INFO_FLOAT32:
+          return Float32::Class::getType();
+        case Utils::INFO_FLOAT64:
+          return Float64::Class::getType();
+        default:
+          break;
+      }
+      break;
+
+    default:
+      break;
+
+  }
+
+  caret.setError("[oatpp::parser::cbor::mapping::Deserializer::guessType()]: Error. Can't guess type for oatpp::Any.", ERROR_CODE_UNEXPECTED_TYPE);
+  return nullptr;
+
+}
+
+oatpp::Void Deserializer::deserializeAny(Deserializer* deserializer, parser::Caret& caret, const Type* const type) {
+  (void) type;
+  if(Utils::skipNull(caret)){
+    return oatpp::Void(Any::Class::getType());
+  } else {
+    const Type* const fieldType = guessType(caret);
+    if(fieldType != nullptr) {
+      auto fieldValue = deserializer->deserialize(caret, fieldType);
+      if(caret.hasError()) {
+        return nullptr;
+      }
+      auto anyHandle = std::make_shared<data::mapping::type::AnyHandle>(fieldValue.getPtr(), fieldValue.valueType);
+      return oatpp::Void(anyHandle, Any::Class::getType());
+    }
+  }
+  return nullptr;
+}
+
+oatpp::Void Deserializer::deserializeEnum(Deserializer* deserializer, parser::Caret& caret, const Type* const type) {
+
+  auto polymorphicDispatcher = static_cast<const data::mapping::type::__class::AbstractEnum::AbstractPolymorphicDispatcher*>(
+    type->polymorphicDispatcher
+  );
+
+  data::mapping::type::EnumInterpreterError e = data::mapping::type::EnumInterpreterError::OK;
+  const auto& value = deserializer->deserialize(caret, polymorphicDispatcher->getInterpretationType());
+  if(caret.hasError()) {
+    return nullptr;
+  }
+  const auto& result = polymorphicDispatcher->fromInterpretation(value, e);
+
+  if(e == data::mapping::type::EnumInterpreterError::OK) {
+    return result;
+  }
+
+  switch(e) {
+    case data::mapping::type::EnumInterpreterError::CONSTRAINT_NOT_NULL:
+      caret.setError("[oatpp::parser::cbor::mapping::Deserializer::deserializeEnum()]: Error. Enum constraint violated - 'NotNull'.");
+      break;
+    default:
+      caret.setError("[oatpp::parser::cbor::mapping::Deserializer::deserializeEnum()]: Error. Can't deserialize Enum.");
+  }
+
+  return nullptr;
+
+}
+
+oatpp::Void Deserializer::deserializeObject(Deserializer* deserializer, parser::Caret& caret, const Type* const type) {
+
+  if(Utils::skipNull(caret)) {
+    return oatpp::Void(type);
+  }
+
+  Utils::Head head;
+  if(!Utils::readHead(caret, head)) {
+    return nullptr;
+  }
+
+  if(head.majorType != Utils::MAJOR_TYPE_MAP) {
+    caret.setError("[oatpp::parser::cbor::mapping::Deserializer::deserializeObject()]: Error. Map expected.", ERROR_CODE_UNEXPECTED_TYPE);
+    return nullptr;
+  }
+
+  auto object = type->creator();
+  const auto& fieldsMap = type->propertiesGetter()->getMap();
+  std::string key;
+
+  const bool indefinite = head.info == Utils::INFO_INDEFINITE;
+  for(v_uint64 i = 0; indefinite || i < head.argument; i ++) {
+
+    if(indefinite && Utils::skipBreak(caret)) {
+      break;
+    }
+
+    Utils::Head keyHead;
+    if(!Utils::readHead(caret, keyHead)) {
+      return nullptr;
+    }
+
+    if(keyHead.majorType != Utils::MAJOR_TYPE_TEXT_STRING) {
+      caret.setError("[oatpp::parser::cbor::mapping::Deserializer::deserializeObject()]: Error. Text string key expected.", ERROR_CODE_UNEXPECTED_TYPE);
+      return nullptr;
+    }
+
+    v_buff_size keySize;
+    const char* keyData = Utils::readStringInPlace(caret, keyHead, keySize);
+    if(keyData != nullptr) {
+      key.assign(keyData, keySize);
+    } else if(!caret.hasError()) {
+      auto keyString = Utils::readString(caret, keyHead);
+      if(keyString) {
+        key.assign((const char*) keyString->getData(), keyString->getSize());
+      }
+    }
+
+    if(caret.hasError()) {
+      return nullptr;
+    }
+
+    auto fieldIterator = fieldsMap.find(key);
+    if(fieldIterator != fieldsMap.end()) {
+      auto field = fieldIterator->second;
+      field->set(object.get(), deserializer->deserialize(caret, field->type));
+    } else if (deserializer->getConfig()->allowUnknownFields) {
+      Utils::skipValue(caret);
+    } else {
+      caret.setError("[oatpp::parser::cbor::mapping::Deserializer::deserializeObject()]: Error. Unknown field", ERROR_CODE_OBJECT_SCOPE_UNKNOWN_FIELD);
+      return nullptr;
+    }
+
+    if(caret.hasError()) {
+      return nullptr;
+    }
+
+  }
+
+  return object;
+
+}
+
+oatpp::Void Deserializer::deserialize(parser::Caret& caret, const Type* const type) {
+  auto id = type->classId.id;
+  auto& method = m_methods[id];
+  if(method) {
+    return (*method)(this, caret, type);
+  } else {
+    throw std::runtime_error("[oatpp::parser::cbor::mapping::Deserializer::deserialize()]: "
+                             "Error. No deserialize method for type '" + std::string(type->classId.name) + "'");
+  }
+}
+
+const std::shared_ptr<Deserializer::Config>& Deserializer::getConfig() {
+  return m_config;
+}
+
+}}}}
@@ -0,0 +1,310 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_parser_cbor_mapping_Deserializer_hpp
+#define oatpp_parser_cbor_mapping_Deserializer_hpp
+
+#include "oatpp/parser/cbor/Utils.hpp"
+#include "oatpp/core/Types.hpp"
+
+#include <limits>
+
+namespace oatpp { namespace parser { namespace cbor { namespace mapping {
+
+/**
+ * CBOR Deserializer.
+ * Deserialize oatpp DTO object from [CBOR](https://tools.ietf.org/html/rfc8949).
+ * See [Data Transfer Object(DTO) component](https://oatpp.io/docs/components/dto/). <br>
+ * Both definite and indefinite length items are accepted. Tags are ignored.
+ */
+class Deserializer {
+public:
+  typedef oatpp::data::mapping::type::Type Type;
+  typedef oatpp::data::mapping::type::Type::Property Property;
+  typedef oatpp::data::mapping::type::Type::Properties Properties;
+
+  typedef oatpp::data::mapping::type::Object Object;
+  typedef oatpp::String String;
+
+public:
+
+  /**
+   * Data item of unexpected major type.
+   */
+  static constexpr v_int32 ERROR_CODE_UNEXPECTED_TYPE = 3;
+
+  /**
+   * "Unknown field"
+   */
+  static constexpr v_int32 ERROR_CODE_OBJECT_SCOPE_UNKNOWN_FIELD = 4;
+
+  /**
+   * Integer value doesn't fit into the target type.
+   */
+  static constexpr v_int32 ERROR_CODE_VALUE_OUT_OF_RANGE = 5;
+
+public:
+
+  /**
+   * Deserializer config.
+   */
+  class Config : public oatpp::base::Countable {
+  public:
+    /**
+     * Constructor.
+     */
+    Config()
+    {}
+  public:
+
+    /**
+     * Create shared Config.
+     * @return - `std::shared_ptr` to Config.
+     */
+    static std::shared_ptr<Config> createShared(){
+      return std::make_shared<Config>();
+    }
+
+    /**
+     * Do not fail if unknown field is found in data.
+     * "unknown field" is the one which is not present in DTO object class.
+     */
+    bool allowUnknownFields = true;
+
+  };
+
+public:
+  typedef oatpp::Void (*DeserializerMethod)(Deserializer*, parser::Caret&, const Type* const);
+private:
+
+  /**
+   * Read head of integer data item.
+   * @param caret - &id:oatpp::parser::Caret;.
+   * @param negative - out parameter. `true` if integer is negative.
+   * @param absolute - out parameter. Argument of the data item. For negative values the actual value is `-1 - absolute`.
+   * @return - `false` on error.
+   */
+  static bool readInteger(parser::Caret& caret, bool& negative, v_uint64& absolute);
+
+  static const Type* guessType(parser::Caret& caret);
+
+private:
+
+  template<class T>
+  static oatpp::Void deserializeInt(Deserializer* deserializer, parser::Caret& caret, const Type* const type){
+
+    (void) deserializer;
+    (void) type;
+
+    typedef typename T::ObjectType ValueType;
+
+    if(Utils::skipNull(caret)) {
+      return oatpp::Void(T::Class::getType());
+    }
+
+    bool negative;
+    v_uint64 absolute;
+    if(!readInteger(caret, negative, absolute)) {
+      return nullptr;
+    }
+
+    if(negative) {
+      if(absolute <= (v_uint64) -((v_int64) std::numeric_limits<ValueType>::min() + 1)) {
+        return T((ValueType) (-1 - (v_int64) absolute));
+      }
+    } else if(absolute <= (v_uint64) std::numeric_limits<ValueType>::max()) {
+      return T((ValueType) absolute);
+    }
+
+    caret.setError("[oatpp::parser::cbor::mapping::Deserializer::deserializeInt()]: Error. Value out of range.", ERROR_CODE_VALUE_OUT_OF_RANGE);
+    return nullptr;
+
+  }
+
+  template<class T>
+  static oatpp::Void deserializeUInt(Deserializer* deserializer, parser::Caret& caret, const Type* const type){
+
+    (void) deserializer;
+    (void) type;
+
+    typedef typename T::ObjectType ValueType;
+
+    if(Utils::skipNull(caret)) {
+      return oatpp::Void(T::Class::getType());
+    }
+
+    bool negative;
+    v_uint64 absolute;
+    if(!readInteger(caret, negative, absolute)) {
+      return nullptr;
+    }
+
+    if(!negative && absolute <= (v_uint64) std::numeric_limits<ValueType>::max()) {
+      return T((ValueType) absolute);
+    }
+
+    caret.setError("[oatpp::parser::cbor::mapping::Deserializer::deserializeUInt()]: Error. Value out of range.", ERROR_CODE_VALUE_OUT_OF_RANGE);
+    return nullptr;
+
+  }
+
+  template<class Collection>
+  static oatpp::Void deserializeList(Deserializer* deserializer, parser::Caret& caret, const Type* const type) {
+
+    if(Utils::skipNull(caret)) {
+      return oatpp::Void(type);
+    }
+
+    Utils::Head head;
+    if(!Utils::readHead(caret, head)) {
+      return nullptr;
+    }
+
+    if(head.majorType != Utils::MAJOR_TYPE_ARRAY) {
+      caret.setError("[oatpp::parser::cbor::mapping::Deserializer::deserializeList()]: Error. Array expected.", ERROR_CODE_UNEXPECTED_TYPE);
+      return nullptr;
+    }
+
+    auto listWrapper = type->creator();
+    auto polymorphicDispatcher = static_cast<const typename Collection::Class::AbstractPolymorphicDispatcher*>(type->polymorphicDispatcher);
+
+    Type* itemType = *type->params.begin();
+
+    const bool indefinite = head.info == Utils::INFO_INDEFINITE;
+    for(v_uint64 i = 0; indefinite || i < head.argument; i ++) {
+
+      if(indefinite && Utils::skipBreak(caret)) {
+        break;
+      }
+
+      auto item = deserializer->deserialize(caret, itemType);
+      if(caret.hasError()){
+        return nullptr;
+      }
+
+      polymorphicDispatcher->addPolymorphicItem(listWrapper, item);
+
+    }
+
+    return listWrapper;
+
+  }
+
+  template<class Collection>
+  static oatpp::Void deserializeKeyValue(Deserializer* deserializer, parser::Caret& caret, const Type* const type) {
+
+    if(Utils::skipNull(caret)) {
+      return oatpp::Void(type);
+    }
+
+    Utils::Head head;
+    if(!Utils::readHead(caret, head)) {
+      return nullptr;
+    }
+
+    if(head.majorType != Utils::MAJOR_TYPE_MAP) {
+      caret.setError("[oatpp::parser::cbor::mapping::Deserializer::deserializeKeyValue()]: Error. Map expected.", ERROR_CODE_UNEXPECTED_TYPE);
+      return nullptr;
+    }
+
+    auto mapWrapper = type->creator();
+    auto polymorphicDispatcher = static_cast<const typename Collection::Class::AbstractPolymorphicDispatcher*>(type->polymorphicDispatcher);
+
+    auto it = type->params.begin();
+    Type* keyType = *it ++;
+    if(keyType->classId.id != oatpp::data::mapping::type::__class::String::CLASS_ID.id){
+      throw std::runtime_error("[oatpp::parser::cbor::mapping::Deserializer::deserializeKeyValue()]: Invalid map key. Key should be String");
+    }
+    Type* valueType = *it;
+
+    const bool indefinite = head.info == Utils::INFO_INDEFINITE;
+    for(v_uint64 i = 0; indefinite || i < head.argument; i ++) {
+
+      if(indefinite && Utils::skipBreak(caret)) {
+        break;
+      }
+
+      auto key = deserializeString(deserializer, caret, keyType);
+      if(caret.hasError()){
+        return nullptr;
+      }
+
+      auto item = deserializer->deserialize(caret, valueType);
+      if(caret.hasError()){
+        return nullptr;
+      }
+
+      polymorphicDispatcher->addPolymorphicItem(mapWrapper, key, item);
+
+    }
+
+    return mapWrapper;
+
+  }
+
+  static oatpp::Void deserializeFloat32(Deserializer* deserializer, parser::Caret& caret, const Type* const type);
+  static oatpp::Void deserializeFloat64(Deserializer* deserializer, parser::Caret& caret, const Type* const type);
+  static oatpp::Void deserializeBoolean(Deserializer* deserializer, parser::Caret& caret, const Type* const type);
+  static oatpp::Void deserializeString(Deserializer* deserializer, parser::Caret& caret, const Type* const type);
+  static oatpp::Void deserializeAny(Deserializer* deserializer, parser::Caret& caret, const Type* const type);
+  static oatpp::Void deserializeEnum(Deserializer* deserializer, parser::Caret& caret, const Type* const type);
+  static oatpp::Void deserializeObject(Deserializer* deserializer, parser::Caret& caret, const Type* const type);
+
+private:
+  std::shared_ptr<Config> m_config;
+  std::vector<DeserializerMethod> m_methods;
+public:
+
+  /**
+   * Constructor.
+   * @param config
+   */
+  Deserializer(const std::shared_ptr<Config>& config = std::make_shared<Config>());
+
+  /**
+   * Set deserializer method for type.
+   * @param classId - &id:oatpp::data::mapping::type::ClassId;.
+   * @param method - `typedef oatpp::Void (*DeserializerMethod)(Deserializer*, parser::Caret&, const Type* const)`.
+   */
+  void setDeserializerMethod(const data::mapping::type::ClassId& classId, DeserializerMethod method);
+
+  /**
+   * Deserialize text.
+   * @param caret - &id:oatpp::parser::Caret;.
+   * @param type - &id:oatpp::data::mapping::type::Type;
+   * @return - `oatpp::Void` over deserialized object.
+   */
+  oatpp::Void deserialize(parser::Caret& caret, const Type* const type);
+
+  /**
+   * Get deserializer config.
+   * @return
+   */
+  const std::shared_ptr<Config>& getConfig();
+
+};
+
+}}}}
+
+#endif /* oatpp_parser_cbor_mapping_Deserializer_hpp */
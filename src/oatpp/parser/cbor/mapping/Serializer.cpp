@@ -0,0 +1,255 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "Serializer.hpp"
+
+#include "oatpp/core/data/mapping/type/Any.hpp"
+#include "oatpp/core/data/stream/BufferStream.hpp"
+
+#include <cstring>
+
+namespace oatpp { namespace parser { namespace cbor { namespace mapping {
+
+Serializer::Serializer(const std::shared_ptr<Config>& config)
+  : m_config(config)
+{
+
+  m_methods.resize(data::mapping::type::ClassId::getClassCount(), nullptr);
+
+  setSerializerMethod(data::mapping::type::__class::String::CLASS_ID, &Serializer::serializeString);
+  setSerializerMethod(data::mapping::type::__class::Any::CLASS_ID, &Serializer::serializeAny);
+
+  setSerializerMethod(data::mapping::type::__class::Int8::CLASS_ID, &Serializer::serializeInt<oatpp::Int8>);
+  setSerializerMethod(data::mapping::type::__class::UInt8::CLASS_ID, &Serializer::serializeUInt<oatpp::UInt8>);
+
+  setSerializerMethod(data::mapping::type::__class::Int16::CLASS_ID, &Serializer::serializeInt<oatpp::Int16>);
+  setSerializerMethod(data::mapping::type::__class::UInt16::CLASS_ID, &Serializer::serializeUInt<oatpp::UInt16>);
+
+  setSerializerMethod(data::mapping::type::__class::Int32::CLASS_ID, &Serializer::serializeInt<oatpp::Int32>);
+  setSerializerMethod(data::mapping::type::__class::UInt32::CLASS_ID, &Serializer::serializeUInt<oatpp::UInt32>);
+
+  setSerializerMethod(data::mapping::type::__class::Int64::CLASS_ID, &Serializer::serializeInt<oatpp::Int64>);
+  setSerializerMethod(data::mapping::type::__class::UInt64::CLASS_ID, &Serializer::serializeUInt<oatpp::UInt64>);
+
+  setSerializerMethod(data::mapping::type::__class::Float32::CLASS_ID, &Serializer::serializeFloat32);
+  setSerializerMethod(data::mapping::type::__class::Float64::CLASS_ID, &Serializer::serializeFloat64);
+  setSerializerMethod(data::mapping::type::__class::Boolean::CLASS_ID, &Serializer::serializeBoolean);
+
+  setSerializerMethod(data::mapping::type::__class::AbstractObject::CLASS_ID, &Serializer::serializeObject);
+  setSerializerMethod(data::mapping::type::__class::AbstractEnum::CLASS_ID, &Serializer::serializeEnum);
+
+  setSerializerMethod(data::mapping::type::__class::AbstractVector::CLASS_ID, &Serializer::serializeList<oatpp::AbstractVector>);
+  setSerializerMethod(data::mapping::type::__class::AbstractList::CLASS_ID, &Serializer::serializeList<oatpp::AbstractList>);
+  setSerializerMethod(data::mapping::type::__class::AbstractUnorderedSet::CLASS_ID, &Serializer::serializeList<oatpp::AbstractUnorderedSet>);
+
+  setSerializerMethod(data::mapping::type::__class::AbstractPairList::CLASS_ID, &Serializer::serializeKeyValue<oatpp::AbstractFields>);
+  setSerializerMethod(data::mapping::type::__class::AbstractUnorderedMap::CLASS_ID, &Serializer::serializeKeyValue<oatpp::AbstractUnorderedFields>);
+
+}
+
+void Serializer::setSerializerMethod(const data::mapping::type::ClassId& classId, SerializerMethod method) {
+  const v_uint32 id = classId.id;
+  if(id < m_methods.size()) {
+    m_methods[id] = method;
+  } else {
+    throw std::runtime_error("[oatpp::parser::cbor::mapping::Serializer::setSerializerMethod()]: Error. Unknown classId");
+  }
+}
+
+void Serializer::serializeString(Serializer* serializer,
+                                 data::stream::ConsistentOutputStream* stream,
+                                 const oatpp::Void& polymorph)
+{
+
+  (void) serializer;
+
+  if(!polymorph) {
+    Utils::writeSimple(stream, Utils::SIMPLE_NULL);
+    return;
+  }
+
+  auto str = static_cast<oatpp::base::StrBuffer*>(polymorph.get());
+  Utils::writeString(stream, str->getData(), str->getSize());
+
+}
+
+void Serializer::serializeFloat32(Serializer* serializer,
+                                  data::stream::ConsistentOutputStream* stream,
+                                  const oatpp::Void& polymorph)
+{
+  (void) serializer;
+  if(polymorph) {
+    Utils::writeFloat32(stream, * static_cast<v_float32*>(polymorph.get()));
+  } else {
+    Utils::writeSimple(stream, Utils::SIMPLE_NULL);
+  }
+}
+
+void Serializer::serializeFloat64(Serializer* serializer,
+                                  data::stream::ConsistentOutputStream* stream,
+                                  const oatpp::Void& polymorph)
+{
+  (void) serializer;
+  if(polymorph) {
+    Utils::writeFloat64(stream, * static_cast<v_float64*>(polymorph.get()));
+  } else {
+    Utils::writeSimple(stream, Utils::SIMPLE_NULL);
+  }
+}
+
+void Serializer::serializeBoolean(Serializer* serializer,
+                                  data::stream::ConsistentOutputStream* stream,
+                                  const oatpp::Void& polymorph)
+{
+  (void) serializer;
+  if(polymorph) {
+    Utils::writeSimple(stream, * static_cast<bool*>(polymorph.get()) ? Utils::SIMPLE_TRUE : Utils::SIMPLE_FALSE);
+  } else {
+    Utils::writeSimple(stream, Utils::SIMPLE_NULL);
+  }
+}
+
+void Serializer::serializeAny(Serializer* serializer,
+                              data::stream::ConsistentOutputStream* stream,
+                              const oatpp::Void& polymorph)
+{
+
+  if(!polymorph) {
+    Utils::writeSimple(stream, Utils::SIMPLE_NULL);
+    return;
+  }
+
+  auto anyHandle = static_cast<data::mapping::type::AnyHandle*>(polymorph.get());
+  serializer->serialize(stream, oatpp::Void(anyHandle->ptr, anyHandle->type));
+
+}
+
+void Serializer::serializeEnum(Serializer* serializer,
+                               data::stream::ConsistentOutputStream* stream,
+                               const oatpp::Void& polymorph)
+{
+  auto polymorphicDispatcher = static_cast<const data::mapping::type::__class::AbstractEnum::AbstractPolymorphicDispatcher*>(
+    polymorph.valueType->polymorphicDispatcher
+  );
+
+  data::mapping::type::EnumInterpreterError e = data::mapping::type::EnumInterpreterError::OK;
+  serializer->serialize(stream, polymorphicDispatcher->toInterpretation(polymorph, e));
+
+  if(e == data::mapping::type::EnumInterpreterError::OK) {
+    return;
+  }
+
+  switch(e) {
+    case data::mapping::type::EnumInterpreterError::CONSTRAINT_NOT_NULL:
+      throw std::runtime_error("[oatpp::parser::cbor::mapping::Serializer::serializeEnum()]: Error. Enum constraint violated - 'NotNull'.");
+    default:
+      throw std::runtime_error("[oatpp::parser::cbor::mapping::Serializer::serializeEnum()]: Error. Can't serialize Enum.");
+  }
+
+}
+
+void Serializer::serializeObject(Serializer* serializer,
+                                 data::stream::ConsistentOutputStream* stream,
+                                 const oatpp::Void& polymorph)
+{
+
+  if(!polymorph) {
+    Utils::writeSimple(stream, Utils::SIMPLE_NULL);
+    return;
+  }
+
+  const auto& keys = serializer->getEncodedKeys(polymorph.valueType);
+  const auto& fields = polymorph.valueType->propertiesGetter()->getList();
+  Object* object = static_cast<Object*>(polymorph.get());
+  const bool includeNullFields = serializer->getConfig()->includeNullFields;
+
+  v_uint64 count = fields.size();
+  if(!includeNullFields) {
+    count = 0;
+    for (auto const& field : fields) {
+      if(field->get(object)) count ++;
+    }
+  }
+
+  Utils::writeHead(stream, Utils::MAJOR_TYPE_MAP, count);
+
+  auto key = keys.begin();
+  for (auto const& field : fields) {
+    auto value = field->get(object);
+    if(value || includeNullFields) {
+      stream->writeSimple(key->data(), key->size());
+      serializer->serialize(stream, value);
+    }
+    ++ key;
+  }
+
+}
+
+const std::vector<std::string>& Serializer::getEncodedKeys(const Type* type) {
+
+  std::lock_guard<concurrency::SpinLock> lock(m_keysLock);
+
+  auto it = m_keys.find(type);
+  if(it != m_keys.end()) {
+    return it->second;
+  }
+
+  auto& keys = m_keys[type];
+  const auto& fields = type->propertiesGetter()->getList();
+  keys.reserve(fields.size());
+
+  for(auto const& field : fields) {
+    data::stream::BufferOutputStream stream(16);
+    Utils::writeString(&stream, field->name, std::strlen(field->name));
+    keys.push_back(std::string((const char*) stream.getData(), stream.getCurrentPosition()));
+  }
+
+  return keys;
+
+}
+
+void Serializer::serialize(data::stream::ConsistentOutputStream* stream,
+                           const oatpp::Void& polymorph)
+{
+  auto id = polymorph.valueType->classId.id;
+  auto& method = m_methods[id];
+  if(method) {
+    (*method)(this, stream, polymorph);
+  } else {
+    throw std::runtime_error("[oatpp::parser::cbor::mapping::Serializer::serialize()]: "
+                             "Error. No serialize method for type '" + std::string(polymorph.valueType->classId.name) + "'");
+  }
+}
+
+void Serializer::serializeToStream(data::stream::ConsistentOutputStream* stream,
+                                   const oatpp::Void& polymorph)
+{
+  serialize(stream, polymorph);
+}
+
+const std::shared_ptr<Serializer::Config>& Serializer::getConfig() {
+  return m_config;
+}
+
+}}}}
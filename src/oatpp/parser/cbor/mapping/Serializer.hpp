@@ -0,0 +1,251 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_parser_cbor_mapping_Serializer_hpp
+#define oatpp_parser_cbor_mapping_Serializer_hpp
+
+#include "oatpp/parser/cbor/Utils.hpp"
+#include "oatpp/core/concurrency/SpinLock.hpp"
+#include "oatpp/core/Types.hpp"
+
+#include <unordered_map>
+#include <string>
+#include <vector>
+
+namespace oatpp { namespace parser { namespace cbor { namespace mapping {
+
+/**
+ * CBOR Serializer.
+ * Serializes oatpp DTO object to [CBOR](https://tools.ietf.org/html/rfc8949).
+ * See [Data Transfer Object(DTO) component](https://oatpp.io/docs/components/dto/). <br>
+ * DTO objects and maps are serialized as CBOR maps with text keys, lists as arrays,
+ * integers and floats keep their size and signedness, enums are serialized as their interpretation.
+ */
+class Serializer {
+public:
+  typedef oatpp::data::mapping::type::Type Type;
+  typedef oatpp::data::mapping::type::Type::Property Property;
+  typedef oatpp::data::mapping::type::Type::Properties Properties;
+
+  typedef oatpp::data::mapping::type::Object Object;
+  typedef oatpp::String String;
+public:
+  /**
+   * Serializer config.
+   */
+  class Config : public oatpp::base::Countable {
+  public:
+    /**
+     * Constructor.
+     */
+    Config()
+    {}
+  public:
+
+    /**
+     * Create shared config.
+     * @return - `std::shared_ptr` to Config.
+     */
+    static std::shared_ptr<Config> createShared(){
+      return std::make_shared<Config>();
+    }
+
+    /**
+     * Include fields with value == nullptr into serialized data.
+     */
+    bool includeNullFields = true;
+
+  };
+public:
+  typedef void (*SerializerMethod)(Serializer*,
+                                   data::stream::ConsistentOutputStream*,
+                                   const oatpp::Void&);
+private:
+
+  template<class T>
+  static void serializeInt(Serializer* serializer,
+                           data::stream::ConsistentOutputStream* stream,
+                           const oatpp::Void& polymorph)
+  {
+    (void) serializer;
+    if(polymorph) {
+      Utils::writeInt(stream, * static_cast<typename T::ObjectType*>(polymorph.get()));
+    } else {
+      Utils::writeSimple(stream, Utils::SIMPLE_NULL);
+    }
+  }
+
+  template<class T>
+  static void serializeUInt(Serializer* serializer,
+                            data::stream::ConsistentOutputStream* stream,
+                            const oatpp::Void& polymorph)
+  {
+    (void) serializer;
+    if(polymorph) {
+      Utils::writeHead(stream, Utils::MAJOR_TYPE_UNSIGNED_INT, * static_cast<typename T::ObjectType*>(polymorph.get()));
+    } else {
+      Utils::writeSimple(stream, Utils::SIMPLE_NULL);
+    }
+  }
+
+  template<class Collection>
+  static void serializeList(Serializer* serializer, data::stream::ConsistentOutputStream* stream, const oatpp::Void& polymorph) {
+
+    if(!polymorph) {
+      Utils::writeSimple(stream, Utils::SIMPLE_NULL);
+      return;
+    }
+
+    const auto& list = polymorph.staticCast<Collection>();
+    const bool includeNullFields = serializer->getConfig()->includeNullFields;
+
+    v_uint64 count = list->size();
+    if(!includeNullFields) {
+      count = 0;
+      for(auto& value : *list) {
+        if(value) count ++;
+      }
+    }
+
+    Utils::writeHead(stream, Utils::MAJOR_TYPE_ARRAY, count);
+
+    for(auto& value : *list) {
+      if(value || includeNullFields) {
+        serializer->serialize(stream, value);
+      }
+    }
+
+  }
+
+  template<class Collection>
+  static void serializeKeyValue(Serializer* serializer, data::stream::ConsistentOutputStream* stream, const oatpp::Void& polymorph) {
+
+    if(!polymorph) {
+      Utils::writeSimple(stream, Utils::SIMPLE_NULL);
+      return;
+    }
+
+    const auto& map = polymorph.staticCast<Collection>();
+    const bool includeNullFields = serializer->getConfig()->includeNullFields;
+
+    v_uint64 count = map->size();
+    if(!includeNullFields) {
+      count = 0;
+      for(auto& pair : *map) {
+        if(pair.second) count ++;
+      }
+    }
+
+    Utils::writeHead(stream, Utils::MAJOR_TYPE_MAP, count);
+
+    for(auto& pair : *map) {
+      const auto& value = pair.second;
+      if(value || includeNullFields) {
+        const auto& key = pair.first;
+        Utils::writeString(stream, key->getData(), key->getSize());
+        serializer->serialize(stream, value);
+      }
+    }
+
+  }
+
+  static void serializeString(Serializer* serializer,
+                              data::stream::ConsistentOutputStream* stream,
+                              const oatpp::Void& polymorph);
+
+  static void serializeFloat32(Serializer* serializer,
+                               data::stream::ConsistentOutputStream* stream,
+                               const oatpp::Void& polymorph);
+
+  static void serializeFloat64(Serializer* serializer,
+                               data::stream::ConsistentOutputStream* stream,
+                               const oatpp::Void& polymorph);
+
+  static void serializeBoolean(Serializer* serializer,
+                               data::stream::ConsistentOutputStream* stream,
+                               const oatpp::Void& polymorph);
+
+  static void serializeAny(Serializer* serializer,
+                           data::stream::ConsistentOutputStream* stream,
+                           const oatpp::Void& polymorph);
+
+  static void serializeEnum(Serializer* serializer,
+                            data::stream::ConsistentOutputStream* stream,
+                            const oatpp::Void& polymorph);
+
+  static void serializeObject(Serializer* serializer,
+                              data::stream::ConsistentOutputStream* stream,
+                              const oatpp::Void& polymorph);
+
+  void serialize(data::stream::ConsistentOutputStream* stream, const oatpp::Void& polymorph);
+
+private:
+
+  /**
+   * Get pre-encoded property names of object type in the same order as `type->propertiesGetter()->getList()`.
+   * Names are encoded once per type and cached for the lifetime of the serializer.
+   * @param type - object type.
+   * @return - encoded property names.
+   */
+  const std::vector<std::string>& getEncodedKeys(const Type* type);
+
+private:
+  std::shared_ptr<Config> m_config;
+  std::vector<SerializerMethod> m_methods;
+private:
+  concurrency::SpinLock m_keysLock;
+  std::unordered_map<const Type*, std::vector<std::string>> m_keys;
+public:
+
+  /**
+   * Constructor.
+   * @param config - serializer config.
+   */
+  Serializer(const std::shared_ptr<Config>& config = std::make_shared<Config>());
+
+  /**
+   * Set serializer method for type.
+   * @param classId - &id:oatpp::data::mapping::type::ClassId;.
+   * @param method - `typedef void (*SerializerMethod)(Serializer*, data::stream::ConsistentOutputStream*, const oatpp::Void&)`.
+   */
+  void setSerializerMethod(const data::mapping::type::ClassId& classId, SerializerMethod method);
+
+  /**
+   * Serialize object to stream.
+   * @param stream - &id:oatpp::data::stream::ConsistentOutputStream;.
+   * @param polymorph - DTO as &id:oatpp::Void;.
+   */
+  void serializeToStream(data::stream::ConsistentOutputStream* stream, const oatpp::Void& polymorph);
+
+  /**
+   * Get serializer config.
+   * @return
+   */
+  const std::shared_ptr<Config>& getConfig();
+
+};
+
+}}}}
+
+#endif /* oatpp_parser_cbor_mapping_Serializer_hpp */
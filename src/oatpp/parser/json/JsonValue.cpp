@@ -0,0 +1,242 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "JsonValue.hpp"
+
+#include "oatpp/core/parser/ParsingError.hpp"
+
+namespace oatpp { namespace parser { namespace json {
+
+namespace __class {
+  const data::mapping::type::ClassId JsonValue::CLASS_ID("JsonValue");
+}
+
+JsonValue::JsonValue()
+  : ObjectWrapper(__class::JsonValue::getType())
+{}
+
+JsonValue::JsonValue(std::nullptr_t) : JsonValue() {}
+
+JsonValue::JsonValue(const std::shared_ptr<JsonValueHandle>& ptr, const data::mapping::type::Type* const type)
+  : ObjectWrapper(ptr, type)
+{}
+
+JsonValue::JsonValue(const std::shared_ptr<Tape>& tape, v_uint32 index)
+  : ObjectWrapper(std::make_shared<JsonValueHandle>(tape, index), __class::JsonValue::getType())
+{}
+
+JsonValue JsonValue::parse(const oatpp::String& text) {
+  parser::Caret caret(text);
+  auto tape = Tape::parse(caret);
+  if(!tape) {
+    throw oatpp::parser::ParsingError(caret.getErrorMessage(), caret.getErrorCode(), caret.getPosition());
+  }
+  return JsonValue(tape, 0);
+}
+
+v_char8 JsonValue::getKind() const {
+  if(m_ptr) {
+    return m_ptr->tape->getKind(m_ptr->index);
+  }
+  return Tape::KIND_NULL;
+}
+
+v_char8 JsonValue::getKindChecked(v_char8 kind, const char* method) const {
+  v_char8 actual = getKind();
+  if(actual != kind) {
+    throw std::runtime_error("[oatpp::parser::json::JsonValue::" + std::string(method) + "()]: Error. Unexpected json value kind.");
+  }
+  return actual;
+}
+
+bool JsonValue::isNull() const {
+  return getKind() == Tape::KIND_NULL;
+}
+
+bool JsonValue::getBoolean() const {
+  switch(getKind()) {
+    case Tape::KIND_TRUE: return true;
+    case Tape::KIND_FALSE: return false;
+    default:
+      throw std::runtime_error("[oatpp::parser::json::JsonValue::getBoolean()]: Error. Unexpected json value kind.");
+  }
+}
+
+v_int64 JsonValue::getInt64() const {
+  if(!m_ptr) {
+    throw std::runtime_error("[oatpp::parser::json::JsonValue::getInt64()]: Error. Unexpected json value kind.");
+  }
+  return m_ptr->tape->getInt64(m_ptr->index);
+}
+
+v_uint64 JsonValue::getUInt64() const {
+  if(!m_ptr) {
+    throw std::runtime_error("[oatpp::parser::json::JsonValue::getUInt64()]: Error. Unexpected json value kind.");
+  }
+  return m_ptr->tape->getUInt64(m_ptr->index);
+}
+
+v_float64 JsonValue::getFloat64() const {
+  if(!m_ptr) {
+    throw std::runtime_error("[oatpp::parser::json::JsonValue::getFloat64()]: Error. Unexpected json value kind.");
+  }
+  return m_ptr->tape->getFloat64(m_ptr->index);
+}
+
+oatpp::String JsonValue::getString() const {
+  getKindChecked(Tape::KIND_STRING, "getString");
+  return m_ptr->tape->getString(m_ptr->index);
+}
+
+data::share::StringKeyLabel JsonValue::getStringLabel() const {
+  getKindChecked(Tape::KIND_STRING, "getStringLabel");
+  return m_ptr->tape->getStringLabel(m_ptr->index);
+}
+
+v_int64 JsonValue::getSize() const {
+  v_char8 kind = getKind();
+  if(kind != Tape::KIND_ARRAY && kind != Tape::KIND_OBJECT) {
+    throw std::runtime_error("[oatpp::parser::json::JsonValue::getSize()]: Error. Unexpected json value kind.");
+  }
+  return m_ptr->tape->getCount(m_ptr->index);
+}
+
+JsonValue JsonValue::getItem(v_int64 index) const {
+  getKindChecked(Tape::KIND_ARRAY, "getItem");
+  const auto& tape = m_ptr->tape;
+  if(index < 0 || index >= tape->getCount(m_ptr->index)) {
+    throw std::runtime_error("[oatpp::parser::json::JsonValue::getItem()]: Error. Index out of bounds.");
+  }
+  v_uint32 item = m_ptr->index + 1;
+  for(v_int64 i = 0; i < index; i ++) {
+    item = tape->getNext(item);
+  }
+  return JsonValue(tape, item);
+}
+
+oatpp::String JsonValue::getKey(v_int64 index) const {
+  getKindChecked(Tape::KIND_OBJECT, "getKey");
+  const auto& tape = m_ptr->tape;
+  if(index < 0 || index >= tape->getCount(m_ptr->index)) {
+    throw std::runtime_error("[oatpp::parser::json::JsonValue::getKey()]: Error. Index out of bounds.");
+  }
+  v_uint32 key = m_ptr->index + 1;
+  for(v_int64 i = 0; i < index; i ++) {
+    key = tape->getNext(key + 1);
+  }
+  return tape->getString(key);
+}
+
+JsonValue JsonValue::getValue(v_int64 index) const {
+  getKindChecked(Tape::KIND_OBJECT, "getValue");
+  const auto& tape = m_ptr->tape;
+  if(index < 0 || index >= tape->getCount(m_ptr->index)) {
+    throw std::runtime_error("[oatpp::parser::json::JsonValue::getValue()]: Error. Index out of bounds.");
+  }
+  v_uint32 key = m_ptr->index + 1;
+  for(v_int64 i = 0; i < index; i ++) {
+    key = tape->getNext(key + 1);
+  }
+  return JsonValue(tape, key + 1);
+}
+
+JsonValue JsonValue::getField(const oatpp::String& key) const {
+  getKindChecked(Tape::KIND_OBJECT, "getField");
+  const auto& tape = m_ptr->tape;
+  v_uint32 end = tape->getNext(m_ptr->index) - 1;
+  v_uint32 entry = m_ptr->index + 1;
+  while(entry < end) {
+    if(tape->stringEquals(entry, (const char*) key->getData(), key->getSize())) {
+      return JsonValue(tape, entry + 1);
+    }
+    entry = tape->getNext(entry + 1);
+  }
+  return nullptr;
+}
+
+data::share::MemoryLabel JsonValue::getRaw() const {
+  if(m_ptr) {
+    return m_ptr->tape->getRaw(m_ptr->index);
+  }
+  return data::share::MemoryLabel(nullptr, (p_char8) "null", 4);
+}
+
+oatpp::Any JsonValue::toAny(const Tape* tape, v_uint32 index) {
+
+  switch(tape->getKind(index)) {
+
+    case Tape::KIND_NULL:
+      return nullptr;
+
+    case Tape::KIND_TRUE:
+      return oatpp::Boolean(true);
+
+    case Tape::KIND_FALSE:
+      return oatpp::Boolean(false);
+
+    case Tape::KIND_INT64:
+      return oatpp::Int64(tape->getInt64(index));
+
+    case Tape::KIND_UINT64:
+      return oatpp::UInt64(tape->getUInt64(index));
+
+    case Tape::KIND_FLOAT64:
+      return oatpp::Float64(tape->getFloat64(index));
+
+    case Tape::KIND_STRING:
+      return tape->getString(index);
+
+    case Tape::KIND_ARRAY: {
+      auto list = oatpp::List<oatpp::Any>::createShared();
+      v_uint32 end = tape->getNext(index) - 1;
+      for(v_uint32 item = index + 1; item < end; item = tape->getNext(item)) {
+        list->push_back(toAny(tape, item));
+      }
+      return list;
+    }
+
+    case Tape::KIND_OBJECT: {
+      auto fields = oatpp::Fields<oatpp::Any>::createShared();
+      v_uint32 end = tape->getNext(index) - 1;
+      for(v_uint32 key = index + 1; key < end; key = tape->getNext(key + 1)) {
+        fields->push_back({tape->getString(key), toAny(tape, key + 1)});
+      }
+      return fields;
+    }
+
+    default:
+      throw std::runtime_error("[oatpp::parser::json::JsonValue::toAny()]: Error. Invalid tape.");
+
+  }
+
+}
+
+oatpp::Any JsonValue::toAny() const {
+  if(m_ptr) {
+    return toAny(m_ptr->tape.get(), m_ptr->index);
+  }
+  return nullptr;
+}
+
+}}}
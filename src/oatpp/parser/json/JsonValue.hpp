@@ -0,0 +1,215 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_parser_json_JsonValue_hpp
+#define oatpp_parser_json_JsonValue_hpp
+
+#include "oatpp/parser/json/Tape.hpp"
+
+#include "oatpp/core/Types.hpp"
+
+namespace oatpp { namespace parser { namespace json {
+
+namespace __class {
+
+  /**
+   * Class information of &id:oatpp::parser::json::JsonValue;.
+   */
+  class JsonValue {
+  public:
+    static const data::mapping::type::ClassId CLASS_ID;
+
+    static data::mapping::type::Type *getType() {
+      static data::mapping::type::Type type(CLASS_ID, nullptr);
+      return &type;
+    }
+
+  };
+
+}
+
+/**
+ * Reference to a value within &id:oatpp::parser::json::Tape;.
+ */
+class JsonValueHandle : public base::Countable {
+public:
+
+  JsonValueHandle(const std::shared_ptr<Tape>& pTape, v_uint32 pIndex)
+    : tape(pTape)
+    , index(pIndex)
+  {}
+
+  const std::shared_ptr<Tape> tape;
+  const v_uint32 index;
+
+};
+
+/**
+ * Lazy json document. <br>
+ * Alternative to &id:oatpp::Any; for the json mapper - the json text is parsed once into a compact &id:oatpp::parser::json::Tape;
+ * and values are materialized only when accessed. No object graph is built, strings are referenced in the source buffer. <br>
+ * Serialization writes the original json text as is, which makes it cheap to pass documents through.
+ */
+class JsonValue : public data::mapping::type::ObjectWrapper<JsonValueHandle, __class::JsonValue> {
+public:
+  typedef JsonValue __Wrapper;
+private:
+  JsonValue(const std::shared_ptr<Tape>& tape, v_uint32 index);
+  v_char8 getKindChecked(v_char8 kind, const char* method) const;
+  static oatpp::Any toAny(const Tape* tape, v_uint32 index);
+public:
+
+  JsonValue();
+  JsonValue(std::nullptr_t);
+
+  JsonValue(const std::shared_ptr<JsonValueHandle>& ptr, const data::mapping::type::Type* const type);
+
+  /**
+   * Parse json text.
+   * @param text - json text.
+   * @return - &l:JsonValue;.
+   * @throws - &id:oatpp::parser::ParsingError;
+   */
+  static JsonValue parse(const oatpp::String& text);
+
+  /**
+   * Get kind of the value. One of &id:oatpp::parser::json::Tape; `KIND_*` constants.
+   * @return - kind of the value. &id:oatpp::parser::json::Tape::KIND_NULL; for empty wrapper.
+   */
+  v_char8 getKind() const;
+
+  /**
+   * Check if value is empty wrapper or json `null`.
+   * @return - `true` if value is null.
+   */
+  bool isNull() const;
+
+  /**
+   * Get value of json `true` or `false`.
+   * @return - `bool`.
+   * @throws - `std::runtime_error` if value is not a boolean.
+   */
+  bool getBoolean() const;
+
+  /**
+   * Get value of json number.
+   * @return - `v_int64`.
+   * @throws - `std::runtime_error` if value is not a number.
+   */
+  v_int64 getInt64() const;
+
+  /**
+   * Get value of json number.
+   * @return - `v_uint64`.
+   * @throws - `std::runtime_error` if value is not a number.
+   */
+  v_uint64 getUInt64() const;
+
+  /**
+   * Get value of json number.
+   * @return - `v_float64`.
+   * @throws - `std::runtime_error` if value is not a number.
+   */
+  v_float64 getFloat64() const;
+
+  /**
+   * Get unescaped value of json string.
+   * @return - &id:oatpp::String;.
+   * @throws - `std::runtime_error` if value is not a string.
+   */
+  oatpp::String getString() const;
+
+  /**
+   * Get raw (still escaped) value of json string without copying it.
+   * @return - &id:oatpp::data::share::StringKeyLabel;.
+   * @throws - `std::runtime_error` if value is not a string.
+   */
+  data::share::StringKeyLabel getStringLabel() const;
+
+  /**
+   * Get number of items in array or number of fields in object.
+   * @return - size.
+   * @throws - `std::runtime_error` if value is not an array or object.
+   */
+  v_int64 getSize() const;
+
+  /**
+   * Get array item.
+   * @param index - item index.
+   * @return - &l:JsonValue;.
+   * @throws - `std::runtime_error` if value is not an array or index is out of bounds.
+   */
+  JsonValue getItem(v_int64 index) const;
+
+  /**
+   * Get name of object field.
+   * @param index - field index.
+   * @return - &id:oatpp::String;.
+   * @throws - `std::runtime_error` if value is not an object or index is out of bounds.
+   */
+  oatpp::String getKey(v_int64 index) const;
+
+  /**
+   * Get value of object field.
+   * @param index - field index.
+   * @return - &l:JsonValue;.
+   * @throws - `std::runtime_error` if value is not an object or index is out of bounds.
+   */
+  JsonValue getValue(v_int64 index) const;
+
+  /**
+   * Find object field by name.
+   * @param key - field name.
+   * @return - &l:JsonValue;. Empty wrapper if field is not found.
+   * @throws - `std::runtime_error` if value is not an object.
+   */
+  JsonValue getField(const oatpp::String& key) const;
+
+  /**
+   * Get json text of the value.
+   * @return - &id:oatpp::data::share::MemoryLabel;.
+   */
+  data::share::MemoryLabel getRaw() const;
+
+  /**
+   * Materialize value as tree of &id:oatpp::Any;. <br>
+   * Objects become `Fields<Any>`, arrays - `List<Any>`, integers - `Int64` (or `UInt64`), other numbers - `Float64`.
+   * @return - &id:oatpp::Any;.
+   */
+  oatpp::Any toAny() const;
+
+};
+
+}}}
+
+namespace oatpp {
+
+  /**
+   * Lazy json document. &id:oatpp::parser::json::JsonValue;.
+   */
+  typedef oatpp::parser::json::JsonValue JsonValue;
+
+}
+
+#endif /* oatpp_parser_json_JsonValue_hpp */
@@ -0,0 +1,293 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "StructuralIndex.hpp"
+
+#include <cstring>
+
+#if defined(__AVX2__)
+  #include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #include <emmintrin.h>
+  #define OATPP_JSON_STRUCTURAL_INDEX_SSE2
+#endif
+
+#if defined(_MSC_VER)
+  #include <intrin.h>
+#endif
+
+namespace oatpp { namespace parser { namespace json {
+
+namespace {
+
+struct RawBlock {
+  v_uint64 quote;
+  v_uint64 backslash;
+  v_uint64 open;
+  v_uint64 close;
+};
+
+#if defined(__AVX2__)
+
+struct Chunks {
+  __m256i lo;
+  __m256i hi;
+};
+
+void load(const v_char8* data, Chunks& chunks) {
+  chunks.lo = _mm256_loadu_si256((const __m256i*) data);
+  chunks.hi = _mm256_loadu_si256((const __m256i*) (data + 32));
+}
+
+v_uint64 match(const Chunks& chunks, v_char8 c) {
+  const __m256i value = _mm256_set1_epi8((char) c);
+  v_uint64 lo = (v_uint32) _mm256_movemask_epi8(_mm256_cmpeq_epi8(chunks.lo, value));
+  v_uint64 hi = (v_uint32) _mm256_movemask_epi8(_mm256_cmpeq_epi8(chunks.hi, value));
+  return lo | (hi << 32);
+}
+
+#elif defined(OATPP_JSON_STRUCTURAL_INDEX_SSE2)
+
+struct Chunks {
+  __m128i parts[4];
+};
+
+void load(const v_char8* data, Chunks& chunks) {
+  for(v_int32 i = 0; i < 4; i ++) {
+    chunks.parts[i] = _mm_loadu_si128((const __m128i*) (data + i * 16));
+  }
+}
+
+v_uint64 match(const Chunks& chunks, v_char8 c) {
+  const __m128i value = _mm_set1_epi8((char) c);
+  v_uint64 r0 = (v_uint16) _mm_movemask_epi8(_mm_cmpeq_epi8(chunks.parts[0], value));
+  v_uint64 r1 = (v_uint16) _mm_movemask_epi8(_mm_cmpeq_epi8(chunks.parts[1], value));
+  v_uint64 r2 = (v_uint16) _mm_movemask_epi8(_mm_cmpeq_epi8(chunks.parts[2], value));
+  v_uint64 r3 = (v_uint16) _mm_movemask_epi8(_mm_cmpeq_epi8(chunks.parts[3], value));
+  return r0 | (r1 << 16) | (r2 << 32) | (r3 << 48);
+}
+
+#else
+
+struct Chunks {
+  const v_char8* data;
+};
+
+void load(const v_char8* data, Chunks& chunks) {
+  chunks.data = data;
+}
+
+v_uint64 match(const Chunks& chunks, v_char8 c) {
+  v_uint64 result = 0;
+  for(v_int32 i = 0; i < StructuralIndex::BLOCK_SIZE; i ++) {
+    result |= (chunks.data[i] == c) ? (((v_uint64) 1) << i) : 0;
+  }
+  return result;
+}
+
+#endif
+
+void classify(const v_char8* data, v_char8 charOpen, v_char8 charClose, RawBlock& raw) {
+  Chunks chunks;
+  load(data, chunks);
+  raw.quote = match(chunks, '"');
+  raw.backslash = match(chunks, '\\');
+  raw.open = match(chunks, charOpen);
+  raw.close = match(chunks, charClose);
+}
+
+v_int32 trailingZeros(v_uint64 bitmask) {
+#if defined(_MSC_VER)
+  unsigned long index;
+  _BitScanForward64(&index, bitmask);
+  return (v_int32) index;
+#else
+  return __builtin_ctzll(bitmask);
+#endif
+}
+
+/*
+ * Point `block` to the `BLOCK_SIZE` bytes at `data + pos`.
+ * The last incomplete block is copied to `tail` and padded with spaces.
+ */
+const v_char8* getBlock(const v_char8* data, v_buff_size size, v_buff_size pos, v_char8* tail) {
+  if(size - pos >= StructuralIndex::BLOCK_SIZE) {
+    return data + pos;
+  }
+  std::memset(tail, ' ', StructuralIndex::BLOCK_SIZE);
+  std::memcpy(tail, data + pos, size - pos);
+  return tail;
+}
+
+}
+
+v_uint64 StructuralIndex::computeEscaped(v_uint64 backslash, State& state) {
+
+  if(backslash == 0) {
+    v_uint64 escaped = state.prevEscaped;
+    state.prevEscaped = 0;
+    return escaped;
+  }
+
+  /* escaped backslash can't start an escape sequence */
+  backslash &= ~state.prevEscaped;
+
+  const v_uint64 evenBits = 0x5555555555555555ULL;
+  const v_uint64 followsEscape = (backslash << 1) | state.prevEscaped;
+  const v_uint64 oddSequenceStarts = backslash & ~evenBits & ~followsEscape;
+
+  /* adding sequence starts to backslashes carries to the bit right after each sequence */
+  const v_uint64 sequencesStartingOnEvenBits = oddSequenceStarts + backslash;
+  state.prevEscaped = sequencesStartingOnEvenBits < backslash ? 1 : 0;
+
+  const v_uint64 invertMask = sequencesStartingOnEvenBits << 1;
+  return (evenBits ^ invertMask) & followsEscape;
+
+}
+
+v_uint64 StructuralIndex::prefixXor(v_uint64 bitmask) {
+  bitmask ^= bitmask << 1;
+  bitmask ^= bitmask << 2;
+  bitmask ^= bitmask << 4;
+  bitmask ^= bitmask << 8;
+  bitmask ^= bitmask << 16;
+  bitmask ^= bitmask << 32;
+  return bitmask;
+}
+
+void StructuralIndex::indexBlock(const v_char8* data, v_char8 charOpen, v_char8 charClose, State& state, Block& block) {
+
+  RawBlock raw;
+  classify(data, charOpen, charClose, raw);
+
+  const v_uint64 escaped = computeEscaped(raw.backslash, state);
+
+  block.quote = raw.quote & ~escaped;
+  block.inString = prefixXor(block.quote) ^ state.prevInString;
+  state.prevInString = (v_uint64)(((v_int64) block.inString) >> 63);
+
+  block.open = raw.open & ~(block.inString | escaped);
+  block.close = raw.close & ~(block.inString | escaped);
+
+}
+
+v_buff_size StructuralIndex::findScopeEnd(const v_char8* data, v_buff_size size, v_char8 charOpen, v_char8 charClose) {
+
+  State state;
+  Block block;
+  v_char8 tail[BLOCK_SIZE];
+  v_int64 scopeCounter = 0;
+
+  for(v_buff_size pos = 0; pos < size; pos += BLOCK_SIZE) {
+
+    indexBlock(getBlock(data, size, pos, tail), charOpen, charClose, state, block);
+
+    v_uint64 structurals = block.open | block.close;
+    while(structurals != 0) {
+      const v_int32 index = trailingZeros(structurals);
+      if((block.open >> index) & 1) {
+        scopeCounter ++;
+      } else {
+        scopeCounter --;
+        if(scopeCounter == 0) {
+          return pos + index + 1;
+        }
+      }
+      structurals &= structurals - 1;
+    }
+
+  }
+
+  return -1;
+
+}
+
+v_buff_size StructuralIndex::findStringEnd(const v_char8* data, v_buff_size size) {
+
+  State state;
+  RawBlock raw;
+  v_char8 tail[BLOCK_SIZE];
+
+  /* skip the opening quote */
+  for(v_buff_size pos = 1; pos < size; pos += BLOCK_SIZE) {
+
+    classify(getBlock(data, size, pos, tail), '"', '"', raw);
+
+    const v_uint64 quote = raw.quote & ~computeEscaped(raw.backslash, state);
+    if(quote != 0) {
+      return pos + trailingZeros(quote) + 1;
+    }
+
+  }
+
+  return -1;
+
+}
+
+v_buff_size StructuralIndex::countItems(const v_char8* data, v_buff_size size) {
+
+  State state;
+  Chunks chunks;
+  v_char8 tail[BLOCK_SIZE];
+  v_int64 scopeCounter = 0;
+  v_buff_size count = 1;
+
+  for(v_buff_size pos = 0; pos < size; pos += BLOCK_SIZE) {
+
+    load(getBlock(data, size, pos, tail), chunks);
+
+    const v_uint64 escaped = computeEscaped(match(chunks, '\\'), state);
+    const v_uint64 quote = match(chunks, '"') & ~escaped;
+    const v_uint64 inString = prefixXor(quote) ^ state.prevInString;
+    state.prevInString = (v_uint64)(((v_int64) inString) >> 63);
+
+    const v_uint64 outside = ~(inString | escaped);
+    const v_uint64 open = (match(chunks, '[') | match(chunks, '{')) & outside;
+    const v_uint64 close = (match(chunks, ']') | match(chunks, '}')) & outside;
+    const v_uint64 comma = match(chunks, ',') & outside;
+
+    v_uint64 structurals = open | close | comma;
+    while(structurals != 0) {
+      const v_int32 index = trailingZeros(structurals);
+      const v_uint64 bit = ((v_uint64) 1) << index;
+      if(open & bit) {
+        scopeCounter ++;
+      } else if(close & bit) {
+        scopeCounter --;
+        if(scopeCounter == 0) {
+          return count;
+        }
+      } else if(scopeCounter == 1) {
+        count ++;
+      }
+      structurals &= structurals - 1;
+    }
+
+  }
+
+  return -1;
+
+}
+
+}}}
@@ -0,0 +1,139 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_parser_json_StructuralIndex_hpp
+#define oatpp_parser_json_StructuralIndex_hpp
+
+#include "oatpp/core/base/Environment.hpp"
+
+namespace oatpp { namespace parser { namespace json {
+
+/**
+ * Structural character index for json text. <br>
+ * Classifies input in blocks of 64 bytes (using SSE2/AVX2 when available) into bitmasks of quotes,
+ * backslashes and scope characters, resolves escapes and string regions with bitwise arithmetic,
+ * and lets the caller jump over whole json values without looking at every byte.
+ * Used by &id:oatpp::parser::json::mapping::Deserializer; to skip unknown fields.
+ */
+class StructuralIndex {
+public:
+
+  /**
+   * Size of the block classified at once.
+   */
+  static constexpr v_buff_size BLOCK_SIZE = 64;
+
+public:
+
+  /**
+   * Bitmasks of one classified block. Bit `i` corresponds to byte `i` of the block.
+   */
+  struct Block {
+
+    /**
+     * Unescaped `"` characters.
+     */
+    v_uint64 quote;
+
+    /**
+     * Characters which are inside a string (opening quote included, closing quote excluded).
+     */
+    v_uint64 inString;
+
+    /**
+     * Scope-open characters outside of strings.
+     */
+    v_uint64 open;
+
+    /**
+     * Scope-close characters outside of strings.
+     */
+    v_uint64 close;
+
+  };
+
+  /**
+   * State carried between consecutive blocks.
+   */
+  struct State {
+
+    /**
+     * `1` if the first character of the next block is escaped.
+     */
+    v_uint64 prevEscaped = 0;
+
+    /**
+     * All ones if the next block starts inside a string.
+     */
+    v_uint64 prevInString = 0;
+
+  };
+
+private:
+  static v_uint64 computeEscaped(v_uint64 backslash, State& state);
+  static v_uint64 prefixXor(v_uint64 bitmask);
+public:
+
+  /**
+   * Classify `BLOCK_SIZE` bytes starting at `data`.
+   * @param data - pointer to at least `BLOCK_SIZE` bytes.
+   * @param charOpen - scope open char. Ex.: `{` or `[`.
+   * @param charClose - scope close char. Ex.: `}` or `]`.
+   * @param state - &l:StructuralIndex::State;. Updated for the next block.
+   * @param block - out parameter. &l:StructuralIndex::Block;.
+   */
+  static void indexBlock(const v_char8* data, v_char8 charOpen, v_char8 charClose, State& state, Block& block);
+
+  /**
+   * Find end of the scope starting at `data[0]`.
+   * @param data - pointer to scope open char.
+   * @param size - size of available data.
+   * @param charOpen - scope open char. Ex.: `{` or `[`.
+   * @param charClose - scope close char. Ex.: `}` or `]`.
+   * @return - position right after the matching close char, or `-1` if scope is not closed within `size` bytes.
+   */
+  static v_buff_size findScopeEnd(const v_char8* data, v_buff_size size, v_char8 charOpen, v_char8 charClose);
+
+  /**
+   * Find end of the string starting at `data[0]`.
+   * @param data - pointer to the opening quote.
+   * @param size - size of available data.
+   * @return - position right after the closing quote, or `-1` if string is not closed within `size` bytes.
+   */
+  static v_buff_size findStringEnd(const v_char8* data, v_buff_size size);
+
+  /**
+   * Count items of the non-empty json array (or fields of the non-empty json object) starting at `data[0]`. <br>
+   * Used to size containers before they are filled.
+   * @param data - pointer to `[` or `{`.
+   * @param size - size of available data.
+   * @return - number of items, or `-1` if scope is not closed within `size` bytes.
+   */
+  static v_buff_size countItems(const v_char8* data, v_buff_size size);
+
+};
+
+}}}
+
+#endif /* oatpp_parser_json_StructuralIndex_hpp */
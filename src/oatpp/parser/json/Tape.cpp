@@ -0,0 +1,445 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "Tape.hpp"
+
+#include "oatpp/parser/json/StructuralIndex.hpp"
+#include "oatpp/parser/json/Utils.hpp"
+
+#include <cstring>
+#include <limits>
+
+namespace oatpp { namespace parser { namespace json {
+
+Tape::Tape()
+  : m_data(nullptr)
+  , m_size(0)
+{}
+
+v_uint32 Tape::push(v_char8 kind, v_buff_size offset, v_uint64 payload) {
+  v_uint32 index = (v_uint32) (m_entries.size() / 2);
+  m_entries.push_back((((v_uint64) kind) << 56) | (((v_uint64) offset) & OFFSET_MASK));
+  m_entries.push_back(payload);
+  return index;
+}
+
+bool Tape::fitsLimit(p_char8 digits, v_buff_size count, const char* limit) {
+  v_buff_size limitSize = (v_buff_size) std::strlen(limit);
+  return count < limitSize || (count == limitSize && std::memcmp(digits, limit, (size_t) count) <= 0);
+}
+
+v_uint64 Tape::getPayload(v_uint32 index) const {
+  return m_entries[index * 2 + 1];
+}
+
+v_buff_size Tape::getOffset(v_uint32 index) const {
+  return (v_buff_size) (m_entries[index * 2] & OFFSET_MASK);
+}
+
+bool Tape::parseString(parser::Caret& caret, v_buff_size start) {
+
+  p_char8 data = caret.getCurrData();
+  v_buff_size end = StructuralIndex::findStringEnd(data, caret.getDataSize() - caret.getPosition());
+  if(end < 0) {
+    caret.setError("[oatpp::parser::json::Tape::parseString()]: Error. '\"' - expected", ERROR_CODE_STRING_NOT_CLOSED);
+    return false;
+  }
+
+  p_char8 content = data + 1;
+  v_buff_size contentSize = end - 2;
+  bool escaped = false;
+
+  for(v_buff_size i = 0; i < contentSize; i ++) {
+    v_char8 c = content[i];
+    if(c < 0x20) {
+      caret.inc(i + 1);
+      caret.setError("[oatpp::parser::json::Tape::parseString()]: Error. Unescaped control character in string", ERROR_CODE_INVALID_STRING);
+      return false;
+    }
+    escaped = escaped || c == '\\';
+  }
+
+  if(escaped) {
+    v_int64 errorCode;
+    v_buff_size errorPosition;
+    Utils::calcUnescapedStringSize(content, contentSize, errorCode, errorPosition);
+    if(errorCode != 0) {
+      caret.inc(errorPosition + 1);
+      caret.setError("[oatpp::parser::json::Tape::parseString()]: Error. Invalid escape sequence in string", ERROR_CODE_INVALID_STRING);
+      return false;
+    }
+  }
+
+  v_uint64 size = (v_uint64) contentSize;
+  if(escaped) {
+    size |= STRING_ESCAPED_FLAG;
+  }
+
+  push(KIND_STRING, caret.getPosition() - start, size);
+  caret.inc(end);
+  return true;
+
+}
+
+bool Tape::parseNumber(parser::Caret& caret, v_buff_size start) {
+
+  p_char8 data = caret.getData();
+  v_buff_size size = caret.getDataSize();
+  v_buff_size begin = caret.getPosition();
+  v_buff_size pos = begin;
+
+  bool negative = data[pos] == '-';
+  if(negative) {
+    pos ++;
+  }
+
+  v_buff_size digitsBegin = pos;
+  while(pos < size && data[pos] >= '0' && data[pos] <= '9') {
+    pos ++;
+  }
+  v_buff_size digitsCount = pos - digitsBegin;
+
+  bool isFloat = false;
+  while(pos < size) {
+    v_char8 a = data[pos];
+    if(a == '.' || a == 'e' || a == 'E' || a == '+' || a == '-' || (a >= '0' && a <= '9')) {
+      isFloat = true;
+      pos ++;
+    } else {
+      break;
+    }
+  }
+
+  if(digitsCount == 0) {
+    caret.setError("[oatpp::parser::json::Tape::parseNumber()]: Error. Invalid number", ERROR_CODE_INVALID_NUMBER);
+    return false;
+  }
+
+  if(!isFloat && negative && fitsLimit(data + digitsBegin, digitsCount, "9223372036854775808")) {
+    push(KIND_INT64, begin - start, (v_uint64) caret.parseInt());
+  } else if(!isFloat && !negative && fitsLimit(data + digitsBegin, digitsCount, "18446744073709551615")) {
+    v_uint64 value = caret.parseUnsignedInt();
+    push(value > (v_uint64) std::numeric_limits<v_int64>::max() ? KIND_UINT64 : KIND_INT64, begin - start, value);
+  } else {
+    v_float64 value = caret.parseFloat64();
+    v_uint64 bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    push(KIND_FLOAT64, begin - start, bits);
+  }
+
+  if(caret.getPosition() != pos) {
+    caret.setError("[oatpp::parser::json::Tape::parseNumber()]: Error. Invalid number", ERROR_CODE_INVALID_NUMBER);
+    return false;
+  }
+
+  return true;
+
+}
+
+bool Tape::parseKey(parser::Caret& caret, v_buff_size start) {
+
+  caret.skipBlankChars();
+  if(!caret.isAtChar('"')) {
+    caret.setError("[oatpp::parser::json::Tape::parseKey()]: Error. '\"' - expected", ERROR_CODE_OBJECT_SCOPE_NAME_EXPECTED);
+    return false;
+  }
+
+  if(!parseString(caret, start)) {
+    return false;
+  }
+
+  caret.skipBlankChars();
+  if(!caret.canContinueAtChar(':', 1)) {
+    caret.setError("[oatpp::parser::json::Tape::parseKey()]: Error. ':' - expected", ERROR_CODE_OBJECT_SCOPE_COLON_MISSING);
+    return false;
+  }
+
+  return true;
+
+}
+
+std::shared_ptr<Tape> Tape::parse(parser::Caret& caret) {
+
+  caret.skipBlankChars();
+
+  auto tape = std::make_shared<Tape>();
+  const v_buff_size start = caret.getPosition();
+
+  /* open scopes and number of items in each of them */
+  std::vector<v_uint32> scopes;
+  std::vector<v_uint32> counts;
+
+  bool expectValue = true;
+
+  while(true) {
+
+    if(expectValue) {
+
+      caret.skipBlankChars();
+      if(!caret.canContinue()) {
+        caret.setError("[oatpp::parser::json::Tape::parse()]: Error. Value expected", ERROR_CODE_VALUE_EXPECTED);
+        return nullptr;
+      }
+
+      v_char8 c = *caret.getCurrData();
+      v_buff_size offset = caret.getPosition() - start;
+
+      if(c == '{' || c == '[') {
+
+        scopes.push_back(tape->push(c, offset, 0));
+        counts.push_back(0);
+        caret.inc();
+        caret.skipBlankChars();
+
+        if(caret.isAtChar(c == '{' ? '}' : ']')) {
+          expectValue = false;
+        } else if(c == '{' && !tape->parseKey(caret, start)) {
+          return nullptr;
+        }
+
+        continue;
+
+      }
+
+      if(c == '"') {
+        if(!tape->parseString(caret, start)) {
+          return nullptr;
+        }
+      } else if(caret.isAtText("null", true)) {
+        tape->push(KIND_NULL, offset, 0);
+      } else if(caret.isAtText("true", true)) {
+        tape->push(KIND_TRUE, offset, 0);
+      } else if(caret.isAtText("false", true)) {
+        tape->push(KIND_FALSE, offset, 0);
+      } else if(c == '-' || (c >= '0' && c <= '9')) {
+        if(!tape->parseNumber(caret, start)) {
+          return nullptr;
+        }
+      } else {
+        caret.setError("[oatpp::parser::json::Tape::parse()]: Error. Value expected", ERROR_CODE_VALUE_EXPECTED);
+        return nullptr;
+      }
+
+      if(!counts.empty()) {
+        counts.back() ++;
+      }
+
+      expectValue = false;
+
+    }
+
+    if(scopes.empty()) {
+      break;
+    }
+
+    caret.skipBlankChars();
+
+    v_uint32 scope = scopes.back();
+    v_char8 kind = tape->getKind(scope);
+
+    if(caret.isAtChar(kind == KIND_OBJECT ? '}' : ']')) {
+
+      tape->push(kind == KIND_OBJECT ? '}' : ']', caret.getPosition() - start, counts.back());
+      tape->m_entries[scope * 2 + 1] = tape->m_entries.size() / 2;
+      caret.inc();
+
+      scopes.pop_back();
+      counts.pop_back();
+      if(!counts.empty()) {
+        counts.back() ++;
+      }
+
+    } else if(caret.canContinueAtChar(',', 1)) {
+
+      if(kind == KIND_OBJECT && !tape->parseKey(caret, start)) {
+        return nullptr;
+      }
+      expectValue = true;
+
+    } else {
+      if(kind == KIND_OBJECT) {
+        caret.setError("[oatpp::parser::json::Tape::parse()]: Error. '}' - expected", ERROR_CODE_SCOPE_CLOSE_EXPECTED);
+      } else {
+        caret.setError("[oatpp::parser::json::Tape::parse()]: Error. ']' - expected", ERROR_CODE_SCOPE_CLOSE_EXPECTED);
+      }
+      return nullptr;
+    }
+
+  }
+
+  tape->m_size = caret.getPosition() - start;
+
+  auto memoryHandle = caret.getDataMemoryHandle();
+  if(memoryHandle) {
+    tape->m_memoryHandle = memoryHandle;
+    tape->m_data = caret.getData() + start;
+  } else {
+    tape->m_memoryHandle = base::StrBuffer::createShared(caret.getData() + start, tape->m_size, true);
+    tape->m_data = tape->m_memoryHandle->getData();
+  }
+
+  return tape;
+
+}
+
+v_char8 Tape::getKind(v_uint32 index) const {
+  return (v_char8) (m_entries[index * 2] >> 56);
+}
+
+v_uint32 Tape::getNext(v_uint32 index) const {
+  switch(getKind(index)) {
+    case KIND_ARRAY:
+    case KIND_OBJECT:
+      return (v_uint32) getPayload(index);
+    default:
+      return index + 1;
+  }
+}
+
+v_uint32 Tape::getCount(v_uint32 index) const {
+  switch(getKind(index)) {
+    case KIND_ARRAY:
+    case KIND_OBJECT:
+      return (v_uint32) getPayload((v_uint32) getPayload(index) - 1);
+    default:
+      throw std::runtime_error("[oatpp::parser::json::Tape::getCount()]: Error. Not a container");
+  }
+}
+
+v_int64 Tape::getInt64(v_uint32 index) const {
+  switch(getKind(index)) {
+    case KIND_INT64:
+    case KIND_UINT64:
+      return (v_int64) getPayload(index);
+    case KIND_FLOAT64:
+      return (v_int64) getFloat64(index);
+    default:
+      throw std::runtime_error("[oatpp::parser::json::Tape::getInt64()]: Error. Not a number");
+  }
+}
+
+v_uint64 Tape::getUInt64(v_uint32 index) const {
+  switch(getKind(index)) {
+    case KIND_INT64:
+    case KIND_UINT64:
+      return getPayload(index);
+    case KIND_FLOAT64:
+      return (v_uint64) getFloat64(index);
+    default:
+      throw std::runtime_error("[oatpp::parser::json::Tape::getUInt64()]: Error. Not a number");
+  }
+}
+
+v_float64 Tape::getFloat64(v_uint32 index) const {
+  switch(getKind(index)) {
+    case KIND_INT64:
+      return (v_float64) (v_int64) getPayload(index);
+    case KIND_UINT64:
+      return (v_float64) getPayload(index);
+    case KIND_FLOAT64: {
+      v_uint64 bits = getPayload(index);
+      v_float64 value;
+      std::memcpy(&value, &bits, sizeof(value));
+      return value;
+    }
+    default:
+      throw std::runtime_error("[oatpp::parser::json::Tape::getFloat64()]: Error. Not a number");
+  }
+}
+
+bool Tape::isStringEscaped(v_uint32 index) const {
+  return (getPayload(index) & STRING_ESCAPED_FLAG) != 0;
+}
+
+data::share::StringKeyLabel Tape::getStringLabel(v_uint32 index) const {
+  if(getKind(index) != KIND_STRING) {
+    throw std::runtime_error("[oatpp::parser::json::Tape::getStringLabel()]: Error. Not a string");
+  }
+  v_buff_size size = (v_buff_size) (getPayload(index) & ~STRING_ESCAPED_FLAG);
+  return data::share::StringKeyLabel(m_memoryHandle, m_data + getOffset(index) + 1, size);
+}
+
+oatpp::String Tape::getString(v_uint32 index) const {
+
+  auto label = getStringLabel(index);
+  if(!isStringEscaped(index)) {
+    return label.toString();
+  }
+
+  v_int64 errorCode;
+  v_buff_size errorPosition;
+  auto result = Utils::unescapeString(label.getData(), label.getSize(), errorCode, errorPosition);
+  if(errorCode != 0) {
+    throw std::runtime_error("[oatpp::parser::json::Tape::getString()]: Error. Invalid escape sequence");
+  }
+  return result;
+
+}
+
+bool Tape::stringEquals(v_uint32 index, const char* text, v_buff_size size) const {
+  if(!isStringEscaped(index)) {
+    v_buff_size stringSize = (v_buff_size) getPayload(index);
+    return stringSize == size && std::memcmp(m_data + getOffset(index) + 1, text, (size_t) size) == 0;
+  }
+  auto value = getString(index);
+  return value->getSize() == size && std::memcmp(value->getData(), text, (size_t) size) == 0;
+}
+
+data::share::MemoryLabel Tape::getRaw(v_uint32 index) const {
+
+  v_buff_size offset = getOffset(index);
+  v_buff_size end;
+
+  switch(getKind(index)) {
+    case KIND_NULL:
+    case KIND_TRUE:
+      end = offset + 4;
+      break;
+    case KIND_FALSE:
+      end = offset + 5;
+      break;
+    case KIND_STRING:
+      end = offset + (v_buff_size) (getPayload(index) & ~STRING_ESCAPED_FLAG) + 2;
+      break;
+    case KIND_ARRAY:
+    case KIND_OBJECT:
+      end = getOffset(getNext(index) - 1) + 1;
+      break;
+    default:
+      end = offset + 1;
+      while(end < m_size) {
+        v_char8 a = m_data[end];
+        if(a == '.' || a == 'e' || a == 'E' || a == '+' || a == '-' || (a >= '0' && a <= '9')) {
+          end ++;
+        } else {
+          break;
+        }
+      }
+  }
+
+  return data::share::MemoryLabel(m_memoryHandle, m_data + offset, end - offset);
+
+}
+
+}}}
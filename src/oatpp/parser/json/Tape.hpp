@@ -0,0 +1,211 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_parser_json_Tape_hpp
+#define oatpp_parser_json_Tape_hpp
+
+#include "oatpp/core/data/share/MemoryLabel.hpp"
+#include "oatpp/core/parser/Caret.hpp"
+#include "oatpp/core/Types.hpp"
+
+#include <vector>
+
+namespace oatpp { namespace parser { namespace json {
+
+/**
+ * Compact flat representation of a parsed json value. <br>
+ * The json text is validated and indexed in one pass into a sequence of fixed-size entries.
+ * Containers store the index of their end so whole subtrees can be skipped in O(1).
+ * Strings and numbers are not copied - entries reference the source buffer which is kept alive by the tape.
+ * Used by &id:oatpp::parser::json::JsonValue;.
+ */
+class Tape : public base::Countable {
+public:
+
+  /**
+   * ERROR_CODE_VALUE_EXPECTED
+   */
+  static constexpr v_int64 ERROR_CODE_VALUE_EXPECTED = 1;
+
+  /**
+   * ERROR_CODE_STRING_NOT_CLOSED
+   */
+  static constexpr v_int64 ERROR_CODE_STRING_NOT_CLOSED = 2;
+
+  /**
+   * ERROR_CODE_INVALID_NUMBER
+   */
+  static constexpr v_int64 ERROR_CODE_INVALID_NUMBER = 3;
+
+  /**
+   * ERROR_CODE_OBJECT_SCOPE_NAME_EXPECTED
+   */
+  static constexpr v_int64 ERROR_CODE_OBJECT_SCOPE_NAME_EXPECTED = 4;
+
+  /**
+   * ERROR_CODE_OBJECT_SCOPE_COLON_MISSING
+   */
+  static constexpr v_int64 ERROR_CODE_OBJECT_SCOPE_COLON_MISSING = 5;
+
+  /**
+   * ERROR_CODE_SCOPE_CLOSE_EXPECTED
+   */
+  static constexpr v_int64 ERROR_CODE_SCOPE_CLOSE_EXPECTED = 6;
+
+  /**
+   * ERROR_CODE_INVALID_STRING - invalid escape sequence or unescaped control character in string.
+   */
+  static constexpr v_int64 ERROR_CODE_INVALID_STRING = 7;
+
+public:
+
+  static constexpr v_char8 KIND_NULL = 'n';
+  static constexpr v_char8 KIND_TRUE = 't';
+  static constexpr v_char8 KIND_FALSE = 'f';
+  static constexpr v_char8 KIND_INT64 = 'l';
+  static constexpr v_char8 KIND_UINT64 = 'u';
+  static constexpr v_char8 KIND_FLOAT64 = 'd';
+  static constexpr v_char8 KIND_STRING = '"';
+  static constexpr v_char8 KIND_ARRAY = '[';
+  static constexpr v_char8 KIND_OBJECT = '{';
+
+private:
+  static constexpr v_uint64 OFFSET_MASK = 0x00FFFFFFFFFFFFFFULL;
+  static constexpr v_uint64 STRING_ESCAPED_FLAG = 0x8000000000000000ULL;
+private:
+  std::shared_ptr<base::StrBuffer> m_memoryHandle;
+  p_char8 m_data;
+  v_buff_size m_size;
+  /* Two words per entry: (kind << 56 | offset in m_data), payload */
+  std::vector<v_uint64> m_entries;
+private:
+  v_uint32 push(v_char8 kind, v_buff_size offset, v_uint64 payload);
+  bool parseString(parser::Caret& caret, v_buff_size start);
+  static bool fitsLimit(p_char8 digits, v_buff_size count, const char* limit);
+  bool parseNumber(parser::Caret& caret, v_buff_size start);
+  bool parseKey(parser::Caret& caret, v_buff_size start);
+  v_uint64 getPayload(v_uint32 index) const;
+  v_buff_size getOffset(v_uint32 index) const;
+public:
+
+  /**
+   * Constructor.
+   */
+  Tape();
+
+  /**
+   * Parse json value at the current caret position and advance caret past the value. <br>
+   * Source memory is shared with the caret when caret has &id:oatpp::parser::Caret::getDataMemoryHandle;,
+   * otherwise the text of the value is copied once.
+   * @param caret - &id:oatpp::parser::Caret;.
+   * @return - `std::shared_ptr` to Tape or `nullptr` if parsing failed (caret error is set).
+   */
+  static std::shared_ptr<Tape> parse(parser::Caret& caret);
+
+  /**
+   * Get kind of the entry. One of `KIND_*` constants.
+   * @param index - entry index.
+   * @return - kind.
+   */
+  v_char8 getKind(v_uint32 index) const;
+
+  /**
+   * Get index of the entry following the value (including all of its children).
+   * @param index - entry index.
+   * @return - index of the next sibling entry.
+   */
+  v_uint32 getNext(v_uint32 index) const;
+
+  /**
+   * Get number of items in array or number of fields in object.
+   * @param index - index of array or object entry.
+   * @return - items count.
+   */
+  v_uint32 getCount(v_uint32 index) const;
+
+  /**
+   * Get value of numeric entry converted to `v_int64`.
+   * @param index - entry index.
+   * @return - value.
+   */
+  v_int64 getInt64(v_uint32 index) const;
+
+  /**
+   * Get value of numeric entry converted to `v_uint64`.
+   * @param index - entry index.
+   * @return - value.
+   */
+  v_uint64 getUInt64(v_uint32 index) const;
+
+  /**
+   * Get value of numeric entry converted to `v_float64`.
+   * @param index - entry index.
+   * @return - value.
+   */
+  v_float64 getFloat64(v_uint32 index) const;
+
+  /**
+   * Check if string entry contains escape sequences.
+   * @param index - index of string entry.
+   * @return - `true` if string has escape sequences.
+   */
+  bool isStringEscaped(v_uint32 index) const;
+
+  /**
+   * Get raw (still escaped) content of string entry without quotes. <br>
+   * No copy is made - label references the source buffer.
+   * @param index - index of string entry.
+   * @return - &id:oatpp::data::share::StringKeyLabel;.
+   */
+  data::share::StringKeyLabel getStringLabel(v_uint32 index) const;
+
+  /**
+   * Get unescaped value of string entry.
+   * @param index - index of string entry.
+   * @return - &id:oatpp::String;.
+   */
+  oatpp::String getString(v_uint32 index) const;
+
+  /**
+   * Check if string entry equals to the given (unescaped) text.
+   * @param index - index of string entry.
+   * @param text - pointer to text.
+   * @param size - text size.
+   * @return - `true` if equals.
+   */
+  bool stringEquals(v_uint32 index, const char* text, v_buff_size size) const;
+
+  /**
+   * Get json text of the value. <br>
+   * No copy is made - label references the source buffer.
+   * @param index - entry index.
+   * @return - &id:oatpp::data::share::MemoryLabel;.
+   */
+  data::share::MemoryLabel getRaw(v_uint32 index) const;
+
+};
+
+}}}
+
+#endif /* oatpp_parser_json_Tape_hpp */
@@ -32,11 +32,14 @@
 
 namespace oatpp { namespace parser { namespace json {
 
+class Tape;
+
 /**
  * Utility class for json serializer/deserializer.
  * Used by &id:oatpp::parser::json::mapping::Serializer;, &id:oatpp::parser::json::mapping::Deserializer;.
  */
 class Utils {
+  friend Tape;
 public:
 
   /**
@@ -24,6 +24,7 @@
 
 #include "Deserializer.hpp"
 
+#include "oatpp/parser/json/StructuralIndex.hpp"
 #include "oatpp/core/utils/ConversionUtils.hpp"
 
 namespace oatpp { namespace parser { namespace json { namespace mapping {
@@ -36,6 +37,7 @@ Deserializer::Deserializer(const std::shared_ptr<Config>& config)
 
   setDeserializerMethod(data::mapping::type::__class::String::CLASS_ID, &Deserializer::deserializeString);
   setDeserializerMethod(data::mapping::type::__class::Any::CLASS_ID, &Deserializer::deserializeAny);
+  setDeserializerMethod(json::__class::JsonValue::CLASS_ID, &Deserializer::deserializeJsonValue);
 
   setDeserializerMethod(data::mapping::type::__class::Int8::CLASS_ID, &Deserializer::deserializeInt<oatpp::Int8>);
   setDeserializerMethod(data::mapping::type::__class::UInt8::CLASS_ID, &Deserializer::deserializeUInt<oatpp::UInt8>);
@@ -74,57 +76,23 @@ void Deserializer::setDeserializerMethod(const data::mapping::type::ClassId& cla
   }
 }
 
-void Deserializer::skipScope(oatpp::parser::Caret& caret, v_char8 charOpen, v_char8 charClose){
+v_buff_size Deserializer::countItems(parser::Caret& caret, v_buff_size scopeStart) {
+  return StructuralIndex::countItems(caret.getData() + scopeStart, caret.getDataSize() - scopeStart);
+}
 
-  p_char8 data = caret.getData();
-  v_buff_size size = caret.getDataSize();
+void Deserializer::skipScope(oatpp::parser::Caret& caret, v_char8 charOpen, v_char8 charClose){
   v_buff_size pos = caret.getPosition();
-  v_int32 scopeCounter = 0;
-
-  bool isInString = false;
-
-  while(pos < size){
-    v_char8 a = data[pos];
-    if(a == charOpen){
-      if(!isInString){
-        scopeCounter ++;
-      }
-    } else if(a == charClose){
-      if(!isInString){
-        scopeCounter --;
-        if(scopeCounter == 0){
-          caret.setPosition(pos + 1);
-          return;
-        }
-      }
-    } else if(a == '"') {
-      isInString = !isInString;
-    } else if(a == '\\'){
-      pos ++;
-    }
-
-    pos ++;
-
+  v_buff_size end = StructuralIndex::findScopeEnd(caret.getData() + pos, caret.getDataSize() - pos, charOpen, charClose);
+  if(end > 0) {
+    caret.setPosition(pos + end);
   }
 }
 
 void Deserializer::skipString(oatpp::parser::Caret& caret){
-  p_char8 data = caret.getData();
-  v_buff_size size = caret.getDataSize();
   v_buff_size pos = caret.getPosition();
-  v_int32 scopeCounter = 0;
-  while(pos < size){
-    v_char8 a = data[pos];
-    if(a == '"'){
-      scopeCounter ++;
-      if(scopeCounter == 2) {
-        caret.setPosition(pos + 1);
-        return;
-      }
-    } else if(a == '\\'){
-      pos ++;
-    }
-    pos ++;
+  v_buff_size end = StructuralIndex::findStringEnd(caret.getData() + pos, caret.getDataSize() - pos);
+  if(end > 0) {
+    caret.setPosition(pos + end);
   }
 }
 
@@ -258,6 +226,18 @@ oatpp::Void Deserializer::deserializeAny(Deserializer* deserializer, parser::Car
   return oatpp::Void(Any::Class::getType());
 }
 
+oatpp::Void Deserializer::deserializeJsonValue(Deserializer* deserializer, parser::Caret& caret, const Type* const type) {
+  (void) deserializer;
+  if(caret.isAtText("null", true)){
+    return oatpp::Void(type);
+  }
+  auto tape = json::Tape::parse(caret);
+  if(tape) {
+    return oatpp::Void(std::make_shared<JsonValueHandle>(tape, 0), type);
+  }
+  return oatpp::Void(type);
+}
+
 oatpp::Void Deserializer::deserializeEnum(Deserializer* deserializer, parser::Caret& caret, const Type* const type) {
 
   auto polymorphicDispatcher = static_cast<const data::mapping::type::__class::AbstractEnum::AbstractPolymorphicDispatcher*>(
@@ -287,12 +267,89 @@ oatpp::Void Deserializer::deserializeEnum(Deserializer* deserializer, parser::Ca
 
 }
 
+void Deserializer::deserializeStatic(Deserializer* deserializer, parser::Caret& caret, oatpp::Boolean& field) {
+  (void) deserializer;
+  if(caret.isAtText("null", true)){
+    field = nullptr;
+  } else if(caret.isAtText("true", true)) {
+    field = true;
+  } else if(caret.isAtText("false", true)) {
+    field = false;
+  } else {
+    caret.setError("[oatpp::parser::json::mapping::Deserializer::readBooleanValue()]: Error. 'true' or 'false' - expected.", ERROR_CODE_VALUE_BOOLEAN);
+  }
+}
+
+void Deserializer::deserializeStatic(Deserializer* deserializer, parser::Caret& caret, oatpp::String& field) {
+  (void) deserializer;
+  if(caret.isAtText("null", true)){
+    field = nullptr;
+  } else {
+    field = oatpp::parser::json::Utils::parseString(caret);
+  }
+}
+
+const char* Deserializer::parseObjectKey(parser::Caret& caret, std::string& buffer, v_buff_size& keySize) {
+
+  const char* key = nullptr;
+  keySize = 0;
+
+  if(caret.isAtChar('"')) {
+    p_char8 data = caret.getData();
+    v_buff_size size = caret.getDataSize();
+    v_buff_size start = caret.getPosition() + 1;
+    v_buff_size pos = start;
+    while(pos < size && data[pos] != '"' && data[pos] != '\\') {
+      pos ++;
+    }
+    if(pos < size && data[pos] == '"') {
+      key = (const char*) &data[start];
+      keySize = pos - start;
+      caret.setPosition(pos + 1);
+    }
+  }
+
+  if(key == nullptr) {
+    buffer = Utils::parseStringToStdString(caret);
+    if(caret.hasError()){
+      return nullptr;
+    }
+    key = buffer.data();
+    keySize = buffer.size();
+  }
+
+  caret.skipBlankChars();
+  if(!caret.canContinueAtChar(':', 1)){
+    caret.setError("[oatpp::parser::json::mapping::Deserializer::readObject()]: Error. ':' - expected", ERROR_CODE_OBJECT_SCOPE_COLON_MISSING);
+    return nullptr;
+  }
+
+  caret.skipBlankChars();
+  return key;
+
+}
+
+void Deserializer::skipUnknownField(Deserializer* deserializer, parser::Caret& caret) {
+  if(deserializer->getConfig()->allowUnknownFields) {
+    skipValue(caret);
+  } else {
+    caret.setError("[oatpp::parser::json::mapping::Deserializer::readObject()]: Error. Unknown field", ERROR_CODE_OBJECT_SCOPE_UNKNOWN_FIELD);
+  }
+}
+
 oatpp::Void Deserializer::deserializeObject(Deserializer* deserializer, parser::Caret& caret, const Type* const type) {
 
   if(caret.isAtText("null", true)){
     return oatpp::Void(type);
   }
 
+  if(!deserializer->m_staticMethods.empty()) {
+    auto it = deserializer->m_staticMethods.find(type);
+    if(it != deserializer->m_staticMethods.end()) {
+      return (*it->second)(deserializer, caret, type);
+    }
+  }
+
   if(caret.canContinueAtChar('{', 1)) {
 
     auto object = type->creator();
@@ -25,10 +25,14 @@
 #ifndef oatpp_parser_json_mapping_Deserializer_hpp
 #define oatpp_parser_json_mapping_Deserializer_hpp
 
+#include "oatpp/parser/json/JsonValue.hpp"
 #include "oatpp/parser/json/Utils.hpp"
 #include "oatpp/core/parser/Caret.hpp"
 #include "oatpp/core/Types.hpp"
 
+#include <unordered_map>
+#include <cstring>
+#include <string>
 #include <vector>
 
 namespace oatpp { namespace parser { namespace json { namespace mapping {
@@ -111,6 +115,12 @@ public:
      */
     bool allowUnknownFields = true;
 
+    /**
+     * Allocate deserialized DTOs, primitives and containers on size-class memory pools
+     * instead of the heap. See &id:oatpp::base::memory::PooledAllocation;.
+     */
+    bool usePooledAllocation = false;
+
   };
 
 public:
@@ -153,6 +163,45 @@ private:
 
   }
 
+  static v_buff_size countItems(parser::Caret& caret, v_buff_size scopeStart);
+
+  template<class Dispatcher>
+  static void reserveCountedItems(const Dispatcher* dispatcher, const oatpp::Void& collection, parser::Caret& caret, v_buff_size scopeStart) {
+    v_buff_size count = countItems(caret, scopeStart);
+    if(count > 0) {
+      dispatcher->reservePolymorphicItems(collection, count);
+    }
+  }
+
+  /*
+   * Containers which can't be sized in advance (List, Fields) are filled as is.
+   */
+  template<class Dispatcher>
+  static void reserveItems(const Dispatcher* dispatcher, const oatpp::Void& collection, parser::Caret& caret, v_buff_size scopeStart) {
+    (void) dispatcher;
+    (void) collection;
+    (void) caret;
+    (void) scopeStart;
+  }
+
+  static void reserveItems(const oatpp::AbstractVector::Class::AbstractPolymorphicDispatcher* dispatcher,
+                           const oatpp::Void& collection, parser::Caret& caret, v_buff_size scopeStart)
+  {
+    reserveCountedItems(dispatcher, collection, caret, scopeStart);
+  }
+
+  static void reserveItems(const oatpp::AbstractUnorderedSet::Class::AbstractPolymorphicDispatcher* dispatcher,
+                           const oatpp::Void& collection, parser::Caret& caret, v_buff_size scopeStart)
+  {
+    reserveCountedItems(dispatcher, collection, caret, scopeStart);
+  }
+
+  static void reserveItems(const oatpp::AbstractUnorderedFields::Class::AbstractPolymorphicDispatcher* dispatcher,
+                           const oatpp::Void& collection, parser::Caret& caret, v_buff_size scopeStart)
+  {
+    reserveCountedItems(dispatcher, collection, caret, scopeStart);
+  }
+
   template<class Collection>
   static oatpp::Void deserializeList(Deserializer* deserializer, parser::Caret& caret, const Type* const type) {
 
@@ -160,6 +209,8 @@ private:
       return oatpp::Void(type);
     }
 
+    v_buff_size scopeStart = caret.getPosition();
+
     if(caret.canContinueAtChar('[', 1)) {
 
       auto listWrapper = type->creator();
@@ -170,6 +221,10 @@ private:
 
       caret.skipBlankChars();
 
+      if(!caret.isAtChar(']')) {
+        reserveItems(polymorphicDispatcher, listWrapper, caret, scopeStart);
+      }
+
       while(!caret.isAtChar(']') && caret.canContinue()){
 
         caret.skipBlankChars();
@@ -207,6 +262,8 @@ private:
       return oatpp::Void(type);
     }
 
+    v_buff_size scopeStart = caret.getPosition();
+
     if(caret.canContinueAtChar('{', 1)) {
 
       auto mapWrapper = type->creator();
@@ -222,6 +279,10 @@ private:
 
       caret.skipBlankChars();
 
+      if(!caret.isAtChar('}')) {
+        reserveItems(polymorphicDispatcher, mapWrapper, caret, scopeStart);
+      }
+
       while (!caret.isAtChar('}') && caret.canContinue()) {
 
         caret.skipBlankChars();
@@ -271,12 +332,294 @@ private:
   static oatpp::Void deserializeBoolean(Deserializer* deserializer, parser::Caret& caret, const Type* const type);
   static oatpp::Void deserializeString(Deserializer* deserializer, parser::Caret& caret, const Type* const type);
   static oatpp::Void deserializeAny(Deserializer* deserializer, parser::Caret& caret, const Type* const type);
+  static oatpp::Void deserializeJsonValue(Deserializer* deserializer, parser::Caret& caret, const Type* const type);
   static oatpp::Void deserializeEnum(Deserializer* deserializer, parser::Caret& caret, const Type* const type);
   static oatpp::Void deserializeObject(Deserializer* deserializer, parser::Caret& caret, const Type* const type);
 
+private:
+
+  /**
+   * Skip value of unknown field or set error if unknown fields are not allowed.
+   * @param deserializer - deserializer.
+   * @param caret - &id:oatpp::parser::Caret;.
+   */
+  static void skipUnknownField(Deserializer* deserializer, parser::Caret& caret);
+
+  /**
+   * Deserializes one DTO field with statically known type.
+   */
+  class StaticFieldDeserializer {
+  private:
+    Deserializer* m_deserializer;
+    parser::Caret& m_caret;
+  public:
+
+    StaticFieldDeserializer(Deserializer* deserializer, parser::Caret& caret)
+      : m_deserializer(deserializer)
+      , m_caret(caret)
+    {}
+
+    template<class Wrapper>
+    void operator()(const Property* property, Wrapper& field) {
+      (void) property;
+      deserializeStatic(m_deserializer, m_caret, field);
+    }
+
+  };
+
+  /**
+   * Table of statically typed field deserializers of DTO class `T`.
+   */
+  template<class T>
+  class StaticFieldsTable {
+  public:
+    typedef void (*FieldMethod)(Deserializer*, parser::Caret&, T*);
+  private:
+
+    template<class Owner, v_int32 Index>
+    static void deserializeField(Deserializer* deserializer, parser::Caret& caret, T* object) {
+      StaticFieldDeserializer fieldDeserializer(deserializer, caret);
+      Owner::Z__FIELD_VISIT(fieldDeserializer, object, std::integral_constant<v_int32, Index>());
+    }
+
+  public:
+
+    /**
+     * Field entry.
+     */
+    struct Field {
+      std::string name;
+      FieldMethod method;
+    };
+
+  public:
+
+    /**
+     * Fields in the order of declaration.
+     */
+    std::vector<Field> fields;
+
+    /**
+     * Field name to index in `fields`.
+     */
+    std::unordered_map<std::string, v_buff_size> indices;
+
+  public:
+
+    template<class Owner, v_int32 Index>
+    void visitField(const Property* property) {
+      indices[property->name] = fields.size();
+      fields.push_back({property->name, &StaticFieldsTable::deserializeField<Owner, Index>});
+    }
+
+    /**
+     * Find field by key. <br>
+     * Json produced by oatpp serializers has fields in the order of declaration,
+     * so the field next to the previously found one is checked first without hashing the key.
+     * @param key - key data.
+     * @param keySize - key size.
+     * @param nextIndex - in/out index of the expected next field.
+     * @return - field method or `nullptr` if field not found.
+     */
+    FieldMethod find(const char* key, v_buff_size keySize, v_buff_size& nextIndex) const {
+      if(nextIndex < (v_buff_size) fields.size()) {
+        const Field& expected = fields[nextIndex];
+        if((v_buff_size) expected.name.size() == keySize && std::memcmp(expected.name.data(), key, keySize) == 0) {
+          return fields[nextIndex ++].method;
+        }
+      }
+      auto it = indices.find(std::string(key, keySize));
+      if(it != indices.end()) {
+        nextIndex = it->second + 1;
+        return fields[it->second].method;
+      }
+      return nullptr;
+    }
+
+  };
+
+  /**
+   * Parse object key and the following `':'`.
+   * Unescaped keys are returned as a pointer into the caret data, escaped keys are decoded to `buffer`.
+   * @param caret - &id:oatpp::parser::Caret;.
+   * @param buffer - buffer for decoded key.
+   * @param keySize - out key size.
+   * @return - pointer to key data.
+   */
+  static const char* parseObjectKey(parser::Caret& caret, std::string& buffer, v_buff_size& keySize);
+
+  template<class T>
+  static std::shared_ptr<T> deserializeObjectStatic(Deserializer* deserializer, parser::Caret& caret) {
+
+    static const StaticFieldsTable<T> table = []() {
+      StaticFieldsTable<T> result;
+      T::Z__VISIT_FIELD_DESCRIPTORS(result);
+      return result;
+    }();
+
+    if(caret.isAtText("null", true)){
+      return nullptr;
+    }
+
+    if(!caret.canContinueAtChar('{', 1)) {
+      caret.setError("[oatpp::parser::json::mapping::Deserializer::readObject()]: Error. '{' - expected", ERROR_CODE_OBJECT_SCOPE_OPEN);
+      return nullptr;
+    }
+
+    auto object = base::memory::PooledAllocation::allocateShared<T>();
+    std::string keyBuffer;
+    v_buff_size nextIndex = 0;
+
+    caret.skipBlankChars();
+
+    while (!caret.isAtChar('}') && caret.canContinue()) {
+
+      caret.skipBlankChars();
+      v_buff_size keySize;
+      const char* key = parseObjectKey(caret, keyBuffer, keySize);
+      if(caret.hasError()){
+        return nullptr;
+      }
+
+      auto method = table.find(key, keySize, nextIndex);
+      if(method){
+        (*method)(deserializer, caret, object.get());
+      } else {
+        skipUnknownField(deserializer, caret);
+      }
+
+      if(caret.hasError()){
+        return nullptr;
+      }
+
+      caret.skipBlankChars();
+      caret.canContinueAtChar(',', 1);
+
+    }
+
+    if(!caret.canContinueAtChar('}', 1)){
+      if(!caret.hasError()){
+        caret.setError("[oatpp::parser::json::mapping::Deserializer::readObject()]: Error. '}' - expected", ERROR_CODE_OBJECT_SCOPE_CLOSE);
+      }
+      return nullptr;
+    }
+
+    return object;
+
+  }
+
+  template<class T>
+  static oatpp::Void deserializeObjectStatic(Deserializer* deserializer, parser::Caret& caret, const Type* const type) {
+    return oatpp::Void(deserializeObjectStatic<T>(deserializer, caret), type);
+  }
+
+  template<class Collection>
+  static void deserializeListStatic(Deserializer* deserializer, parser::Caret& caret, Collection& list) {
+
+    if(caret.isAtText("null", true)){
+      list = nullptr;
+      return;
+    }
+
+    if(!caret.canContinueAtChar('[', 1)) {
+      caret.setError("[oatpp::parser::json::mapping::Deserializer::deserializeList()]: Error. '[' - expected", ERROR_CODE_ARRAY_SCOPE_OPEN);
+      return;
+    }
+
+    auto items = base::memory::PooledAllocation::allocateShared<typename Collection::ObjectType>();
+
+    caret.skipBlankChars();
+
+    while(!caret.isAtChar(']') && caret.canContinue()){
+
+      caret.skipBlankChars();
+      typename Collection::ObjectType::value_type item;
+      deserializeStatic(deserializer, caret, item);
+      if(caret.hasError()){
+        return;
+      }
+
+      items->push_back(std::move(item));
+      caret.skipBlankChars();
+
+      caret.canContinueAtChar(',', 1);
+
+    }
+
+    if(!caret.canContinueAtChar(']', 1)){
+      if(!caret.hasError()){
+        caret.setError("[oatpp::parser::json::mapping::Deserializer::deserializeList()]: Error. ']' - expected", ERROR_CODE_ARRAY_SCOPE_CLOSE);
+      }
+      return;
+    }
+
+    list.setPtr(items);
+
+  }
+
+  static void parseNumber(parser::Caret& caret, v_float32& value) {
+    value = caret.parseFloat32();
+  }
+
+  static void parseNumber(parser::Caret& caret, v_float64& value) {
+    value = caret.parseFloat64();
+  }
+
+  template<typename V>
+  static void parseNumber(parser::Caret& caret, V& value, typename std::enable_if<std::is_signed<V>::value>::type* = nullptr) {
+    value = (V) caret.parseInt();
+  }
+
+  template<typename V>
+  static void parseNumber(parser::Caret& caret, V& value, typename std::enable_if<std::is_unsigned<V>::value>::type* = nullptr) {
+    value = (V) caret.parseUnsignedInt();
+  }
+
+  template<class Wrapper>
+  static void deserializeStatic(Deserializer* deserializer, parser::Caret& caret, Wrapper& field) {
+    field = deserializer->deserialize(caret, field.valueType).template staticCast<Wrapper>();
+  }
+
+  template<class V, class C>
+  static void deserializeStatic(Deserializer* deserializer, parser::Caret& caret, data::mapping::type::Primitive<V, C>& field) {
+    (void) deserializer;
+    if(caret.isAtText("null", true)){
+      field = nullptr;
+    } else {
+      V value;
+      parseNumber(caret, value);
+      field = data::mapping::type::Primitive<V, C>(value);
+    }
+  }
+
+  static void deserializeStatic(Deserializer* deserializer, parser::Caret& caret, oatpp::Boolean& field);
+  static void deserializeStatic(Deserializer* deserializer, parser::Caret& caret, oatpp::String& field);
+
+  template<class T>
+  static void deserializeStatic(Deserializer* deserializer, parser::Caret& caret, data::mapping::type::DTOWrapper<T>& field) {
+    field = deserializeObjectStatic<T>(deserializer, caret);
+  }
+
+  template<class T>
+  static void deserializeStatic(Deserializer* deserializer,
+                                parser::Caret& caret,
+                                data::mapping::type::ListObjectWrapper<T, data::mapping::type::__class::List<T>>& field)
+  {
+    deserializeListStatic(deserializer, caret, field);
+  }
+
+  template<class T>
+  static void deserializeStatic(Deserializer* deserializer,
+                                parser::Caret& caret,
+                                data::mapping::type::VectorObjectWrapper<T, data::mapping::type::__class::Vector<T>>& field)
+  {
+    deserializeListStatic(deserializer, caret, field);
+  }
+
 private:
   std::shared_ptr<Config> m_config;
   std::vector<DeserializerMethod> m_methods;
+  std::unordered_map<const Type*, DeserializerMethod> m_staticMethods;
 public:
 
   /**
@@ -292,6 +635,22 @@ public:
    */
   void setDeserializerMethod(const data::mapping::type::ClassId& classId, DeserializerMethod method);
 
+  /**
+   * Deserialize DTO class `T` with the statically typed deserializer generated by `DTO_INIT` and `DTO_FIELD` macros
+   * instead of the reflective one. <br>
+   * Field types and offsets are resolved at compile time, primitives, strings, nested DTOs,
+   * and `List`/`Vector` fields are parsed without runtime type dispatch.
+   * Fields of other types fall back to the regular deserializer methods. <br>
+   * Nested DTO fields are always deserialized statically, register only the DTO classes which are deserialized
+   * on their own or as items of non-DTO containers. <br>
+   * Register static deserializers before the deserializer is used.
+   * @tparam T - DTO class.
+   */
+  template<class T>
+  void registerStaticDeserializer() {
+    m_staticMethods[T::ObjectWrapper::Class::getType()] = &Deserializer::deserializeObjectStatic<T>;
+  }
+
   /**
    * Deserialize text.
    * @param caret - &id:oatpp::parser::Caret;.
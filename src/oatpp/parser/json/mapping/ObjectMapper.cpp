@@ -57,9 +57,21 @@ void ObjectMapper::write(data::stream::ConsistentOutputStream* stream,
 
 oatpp::Void ObjectMapper::read(oatpp::parser::Caret& caret,
                                                                      const oatpp::data::mapping::type::Type* const type) const {
+  if(m_deserializer->getConfig()->usePooledAllocation) {
+    base::memory::PooledAllocation::Scope scope;
+    return m_deserializer->deserialize(caret, type);
+  }
   return m_deserializer->deserialize(caret, type);
 }
 
+std::shared_ptr<ObjectMapper::Reader> ObjectMapper::createReader(const oatpp::data::mapping::type::Type* const type) const {
+  return std::make_shared<PushDeserializer>(m_deserializer, type);
+}
+
+std::shared_ptr<data::stream::ReadCallback> ObjectMapper::createWriter(const oatpp::Void& variant) const {
+  return std::make_shared<PullSerializer>(m_serializer, variant);
+}
+
 std::shared_ptr<Serializer> ObjectMapper::getSerializer() {
   return m_serializer;
 }
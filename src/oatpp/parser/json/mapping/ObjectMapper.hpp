@@ -27,6 +27,8 @@
 
 #include "./Serializer.hpp"
 #include "./Deserializer.hpp"
+#include "./PullSerializer.hpp"
+#include "./PushDeserializer.hpp"
 
 #include "oatpp/core/data/mapping/ObjectMapper.hpp"
 
@@ -99,6 +101,22 @@ public:
    */
   oatpp::Void read(oatpp::parser::Caret& caret, const oatpp::data::mapping::type::Type* const type) const override;
 
+  /**
+   * Implementation of &id:oatpp::data::mapping::ObjectMapper::createReader;. <br>
+   * Creates &id:oatpp::parser::json::mapping::PushDeserializer; which deserializes json as it arrives.
+   * @param type - type of resultant object &id:oatpp::data::mapping::type::Type;.
+   * @return - `std::shared_ptr` to &id:oatpp::data::mapping::ObjectMapper::Reader;.
+   */
+  std::shared_ptr<Reader> createReader(const oatpp::data::mapping::type::Type* const type) const override;
+
+  /**
+   * Implementation of &id:oatpp::data::mapping::ObjectMapper::createWriter;. <br>
+   * Creates &id:oatpp::parser::json::mapping::PullSerializer; which serializes object on demand.
+   * @param variant - object to serialize &id:oatpp::Void;.
+   * @return - `std::shared_ptr` to &id:oatpp::data::stream::ReadCallback;.
+   */
+  std::shared_ptr<data::stream::ReadCallback> createWriter(const oatpp::Void& variant) const override;
+
 
   /**
    * Get serializer.
@@ -111,6 +129,18 @@ public:
    * @return
    */
   std::shared_ptr<Deserializer> getDeserializer();
+
+  /**
+   * Map DTO class `T` with the statically typed serializer and deserializer generated by DTO codegen. <br>
+   * See &id:oatpp::parser::json::mapping::Serializer::registerStaticSerializer; and
+   * &id:oatpp::parser::json::mapping::Deserializer::registerStaticDeserializer;.
+   * @tparam T - DTO class.
+   */
+  template<class T>
+  void registerStaticMapping() {
+    m_serializer->registerStaticSerializer<T>();
+    m_deserializer->registerStaticDeserializer<T>();
+  }
   
 };
   
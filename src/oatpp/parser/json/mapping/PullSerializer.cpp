@@ -0,0 +1,224 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "PullSerializer.hpp"
+
+#include "oatpp/core/data/mapping/type/Any.hpp"
+
+#include <cstring>
+
+namespace oatpp { namespace parser { namespace json { namespace mapping {
+
+PullSerializer::PullSerializer(const std::shared_ptr<Serializer>& serializer, const oatpp::Void& object)
+  : m_serializer(serializer)
+  , m_root(object)
+  , m_rootWritten(false)
+  , m_buffer(256, 256)
+  , m_bufferPosition(0)
+  , m_stream(&m_buffer)
+{
+
+  if(m_serializer->getConfig()->useBeautifier) {
+    m_beautifier.reset(new Beautifier(&m_buffer, "  ", "\n"));
+    m_stream = m_beautifier.get();
+  }
+
+  namespace __class = data::mapping::type::__class;
+
+  m_iterators.resize(data::mapping::type::ClassId::getClassCount(), nullptr);
+
+  /* Walk only collections serialized by the default serializer methods. Custom methods are called as is. */
+
+  const auto& methods = m_serializer->m_methods;
+
+  if(methods[__class::AbstractVector::CLASS_ID.id] == &Serializer::serializeList<oatpp::AbstractVector>) {
+    m_iterators[__class::AbstractVector::CLASS_ID.id] = &createIterator<ListIterator<oatpp::AbstractVector>>;
+  }
+
+  if(methods[__class::AbstractList::CLASS_ID.id] == &Serializer::serializeList<oatpp::AbstractList>) {
+    m_iterators[__class::AbstractList::CLASS_ID.id] = &createIterator<ListIterator<oatpp::AbstractList>>;
+  }
+
+  if(methods[__class::AbstractUnorderedSet::CLASS_ID.id] == &Serializer::serializeList<oatpp::AbstractUnorderedSet>) {
+    m_iterators[__class::AbstractUnorderedSet::CLASS_ID.id] = &createIterator<ListIterator<oatpp::AbstractUnorderedSet>>;
+  }
+
+  if(methods[__class::AbstractPairList::CLASS_ID.id] == &Serializer::serializeKeyValue<oatpp::AbstractFields>) {
+    m_iterators[__class::AbstractPairList::CLASS_ID.id] = &createIterator<MapIterator<oatpp::AbstractFields>>;
+  }
+
+  if(methods[__class::AbstractUnorderedMap::CLASS_ID.id] == &Serializer::serializeKeyValue<oatpp::AbstractUnorderedFields>) {
+    m_iterators[__class::AbstractUnorderedMap::CLASS_ID.id] = &createIterator<MapIterator<oatpp::AbstractUnorderedFields>>;
+  }
+
+  m_walkObjects = methods[__class::AbstractObject::CLASS_ID.id] == &Serializer::serializeObject;
+  m_walkAny = methods[__class::Any::CLASS_ID.id] == &Serializer::serializeAny;
+
+}
+
+void PullSerializer::writeValue(const oatpp::Void& value) {
+
+  namespace __class = data::mapping::type::__class;
+
+  if(value.get() == nullptr) {
+    m_serializer->serialize(m_stream, value);
+    return;
+  }
+
+  const auto id = value.valueType->classId.id;
+
+  if(id == __class::Any::CLASS_ID.id && m_walkAny) {
+    auto anyHandle = static_cast<data::mapping::type::AnyHandle*>(value.get());
+    writeValue(oatpp::Void(anyHandle->ptr, anyHandle->type));
+    return;
+  }
+
+  if(id == __class::AbstractObject::CLASS_ID.id && m_walkObjects) {
+    const auto& fields = value.valueType->propertiesGetter()->getList();
+    Frame frame;
+    frame.value = value;
+    frame.prefixes = &m_serializer->getObjectInfo(value.valueType).prefixes;
+    frame.field = fields.begin();
+    frame.fieldsEnd = fields.end();
+    frame.fieldIndex = 0;
+    frame.closingChar = '}';
+    frame.first = true;
+    m_stream->writeCharSimple('{');
+    m_stack.push_back(std::move(frame));
+    return;
+  }
+
+  if(m_iterators[id] != nullptr) {
+    bool isMap = (id == __class::AbstractPairList::CLASS_ID.id || id == __class::AbstractUnorderedMap::CLASS_ID.id);
+    Frame frame;
+    frame.value = value;
+    frame.prefixes = nullptr;
+    frame.fieldIndex = 0;
+    frame.iterator.reset(m_iterators[id](value));
+    frame.closingChar = isMap ? '}' : ']';
+    frame.first = true;
+    m_stream->writeCharSimple(isMap ? '{' : '[');
+    m_stack.push_back(std::move(frame));
+    return;
+  }
+
+  m_serializer->serialize(m_stream, value);
+
+}
+
+bool PullSerializer::writeNext() {
+
+  if(m_stack.empty()) {
+    if(m_rootWritten) {
+      return false;
+    }
+    m_rootWritten = true;
+    writeValue(m_root);
+    return true;
+  }
+
+  const bool includeNullFields = m_serializer->getConfig()->includeNullFields;
+  Frame& frame = m_stack.back();
+
+  if(frame.prefixes != nullptr) {
+
+    auto object = static_cast<oatpp::data::mapping::type::Object*>(frame.value.get());
+
+    while(frame.field != frame.fieldsEnd) {
+
+      Property* field = *frame.field;
+      const auto& prefix = (*frame.prefixes)[frame.fieldIndex];
+      ++ frame.field;
+      ++ frame.fieldIndex;
+
+      auto value = field->get(object);
+      if(value.get() != nullptr || includeNullFields) {
+        if(frame.first) {
+          frame.first = false;
+          m_stream->writeSimple(prefix.data() + 1, prefix.size() - 1);
+        } else {
+          m_stream->writeSimple(prefix.data(), prefix.size());
+        }
+        writeValue(value);
+        return true;
+      }
+
+    }
+
+  } else {
+
+    const oatpp::String* key;
+    const oatpp::Void* value;
+
+    while(frame.iterator->next(key, value)) {
+      if(value->get() != nullptr || includeNullFields) {
+        (frame.first) ? frame.first = false : m_stream->writeSimple(",", 1);
+        if(key != nullptr) {
+          Serializer::serializeString(m_stream, (*key)->getData(), (*key)->getSize());
+          m_stream->writeSimple(":", 1);
+        }
+        writeValue(*value);
+        return true;
+      }
+    }
+
+  }
+
+  m_stream->writeCharSimple(frame.closingChar);
+  m_stack.pop_back();
+  return true;
+
+}
+
+v_io_size PullSerializer::read(void *buffer, v_buff_size count, async::Action& action) {
+
+  (void) action;
+
+  p_char8 out = (p_char8) buffer;
+  v_buff_size progress = 0;
+
+  while(progress < count) {
+
+    v_buff_size available = m_buffer.getCurrentPosition() - m_bufferPosition;
+
+    if(available > 0) {
+      v_buff_size size = available < count - progress ? available : count - progress;
+      std::memcpy(out + progress, m_buffer.getData() + m_bufferPosition, size);
+      m_bufferPosition += size;
+      progress += size;
+    } else {
+      m_buffer.setCurrentPosition(0);
+      m_bufferPosition = 0;
+      if(!writeNext()) {
+        break;
+      }
+    }
+
+  }
+
+  return progress;
+
+}
+
+}}}}
@@ -0,0 +1,207 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_parser_json_mapping_PullSerializer_hpp
+#define oatpp_parser_json_mapping_PullSerializer_hpp
+
+#include "./Serializer.hpp"
+
+#include "oatpp/parser/json/Beautifier.hpp"
+
+#include "oatpp/core/data/stream/BufferStream.hpp"
+
+namespace oatpp { namespace parser { namespace json { namespace mapping {
+
+/**
+ * Resumable pull-serializer for json. <br>
+ * Produces json on demand - each call to &l:PullSerializer::read (); serializes only as much of the object graph
+ * as needed to fill the provided buffer. DTO objects, lists, and maps are walked lazily with an explicit stack of
+ * iterators, so memory used by the serializer is bounded by the size of the read buffer and the nesting depth,
+ * not by the size of the resultant json. <br>
+ * Values of other types are serialized whole by &id:oatpp::parser::json::mapping::Serializer;.
+ * The output is the same as of &id:oatpp::parser::json::mapping::Serializer::serializeToStream;. <br>
+ * Since serialization never blocks, the same `read` works for both simple and async API. <br>
+ * Use with &id:oatpp::web::protocol::http::outgoing::StreamingBody; to stream large responses.
+ * Extends &id:oatpp::data::stream::ReadCallback;.
+ */
+class PullSerializer : public oatpp::data::stream::ReadCallback {
+public:
+  typedef oatpp::data::mapping::type::Type Type;
+  typedef oatpp::data::mapping::type::Type::Property Property;
+private:
+
+  /**
+   * Type-erased iterator over collection items.
+   */
+  class AbstractIterator {
+  public:
+
+    virtual ~AbstractIterator() = default;
+
+    /**
+     * Get next item.
+     * @param key - set to the item key for maps or to `nullptr` for lists.
+     * @param value - set to the item value.
+     * @return - `false` if there are no more items.
+     */
+    virtual bool next(const oatpp::String*& key, const oatpp::Void*& value) = 0;
+
+  };
+
+  template<class Collection>
+  class ListIterator : public AbstractIterator {
+  private:
+    Collection m_list;
+    typename Collection::ObjectType::const_iterator m_it;
+  public:
+
+    ListIterator(const oatpp::Void& list)
+      : m_list(list.staticCast<Collection>())
+      , m_it(m_list->begin())
+    {}
+
+    bool next(const oatpp::String*& key, const oatpp::Void*& value) override {
+      if(m_it == m_list->end()) {
+        return false;
+      }
+      key = nullptr;
+      value = &(*m_it);
+      ++ m_it;
+      return true;
+    }
+
+  };
+
+  template<class Collection>
+  class MapIterator : public AbstractIterator {
+  private:
+    Collection m_map;
+    typename Collection::ObjectType::const_iterator m_it;
+  public:
+
+    MapIterator(const oatpp::Void& map)
+      : m_map(map.staticCast<Collection>())
+      , m_it(m_map->begin())
+    {}
+
+    bool next(const oatpp::String*& key, const oatpp::Void*& value) override {
+      if(m_it == m_map->end()) {
+        return false;
+      }
+      key = &m_it->first;
+      value = &m_it->second;
+      ++ m_it;
+      return true;
+    }
+
+  };
+
+  typedef AbstractIterator* (*IteratorFactory)(const oatpp::Void& collection);
+
+  template<class Iterator>
+  static AbstractIterator* createIterator(const oatpp::Void& collection) {
+    return new Iterator(collection);
+  }
+
+private:
+
+  /**
+   * Scope which is being serialized.
+   */
+  struct Frame {
+
+    /**
+     * Object being serialized. Keeps the object alive while it's being walked.
+     */
+    oatpp::Void value;
+
+    /**
+     * Pre-encoded property prefixes for DTO objects. `nullptr` for collections.
+     */
+    const std::vector<std::string>* prefixes;
+
+    /**
+     * Next property of DTO object.
+     */
+    std::list<Property*>::const_iterator field;
+    std::list<Property*>::const_iterator fieldsEnd;
+    v_buff_size fieldIndex;
+
+    /**
+     * Iterator over items of list or map. `nullptr` for DTO objects.
+     */
+    std::unique_ptr<AbstractIterator> iterator;
+
+    /**
+     * Closing char of the scope - `}` or `]`.
+     */
+    v_char8 closingChar;
+
+    /**
+     * No items written yet.
+     */
+    bool first;
+
+  };
+
+private:
+  std::shared_ptr<Serializer> m_serializer;
+  oatpp::Void m_root;
+  bool m_rootWritten;
+  std::vector<Frame> m_stack;
+  std::vector<IteratorFactory> m_iterators;
+  bool m_walkObjects;
+  bool m_walkAny;
+private:
+  data::stream::BufferOutputStream m_buffer;
+  v_buff_size m_bufferPosition;
+  std::unique_ptr<Beautifier> m_beautifier;
+  data::stream::ConsistentOutputStream* m_stream;
+private:
+  void writeValue(const oatpp::Void& value);
+  bool writeNext();
+public:
+
+  /**
+   * Constructor.
+   * @param serializer - &id:oatpp::parser::json::mapping::Serializer;. Serializer config and methods are respected.
+   * @param object - object to serialize.
+   */
+  PullSerializer(const std::shared_ptr<Serializer>& serializer, const oatpp::Void& object);
+
+  /**
+   * Serialize next portion of json to the buffer.
+   * @param buffer - pointer to buffer.
+   * @param count - size of the buffer in bytes.
+   * @param action - async specific action. Serializer never blocks so action is always left untouched.
+   * @return - actual number of bytes written to the buffer. `0` - when the whole object is serialized.
+   * @throws - `std::runtime_error` on serialization error. Same as &id:oatpp::parser::json::mapping::Serializer;.
+   */
+  v_io_size read(void *buffer, v_buff_size count, async::Action& action) override;
+
+};
+
+}}}}
+
+#endif /* oatpp_parser_json_mapping_PullSerializer_hpp */
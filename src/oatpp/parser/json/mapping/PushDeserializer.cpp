@@ -0,0 +1,521 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "PushDeserializer.hpp"
+
+#include "oatpp/parser/json/Utils.hpp"
+
+namespace oatpp { namespace parser { namespace json { namespace mapping {
+
+namespace {
+
+  bool isBlankChar(v_char8 c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+  }
+
+}
+
+PushDeserializer::PushDeserializer(const std::shared_ptr<Deserializer>& deserializer, const Type* const type)
+  : m_deserializer(deserializer)
+  , m_type(type)
+  , m_resultType(type)
+  , m_done(false)
+  , m_capture(Capture::NONE)
+  , m_captureType(nullptr)
+  , m_captureKey(false)
+  , m_captureSkip(false)
+  , m_captureEscape(false)
+  , m_captureInString(false)
+  , m_captureDepth(0)
+  , m_captureStart(0)
+  , m_position(0)
+  , m_charPosition(0)
+{}
+
+void PushDeserializer::fail(const char* message, v_int64 code, v_buff_size position) {
+  if(!hasError()) {
+    setError(message, code, position);
+  }
+}
+
+bool PushDeserializer::startValue(v_char8 c, const Type* type, bool skip) {
+
+  if(skip) {
+    return startCapture(c, nullptr, false, true);
+  }
+
+  auto id = type->classId.id;
+
+  if(c == '{') {
+
+    if(id == data::mapping::type::__class::AbstractObject::CLASS_ID.id) {
+      m_stack.push_back(Frame(Kind::OBJECT, type->creator(), nullptr, false));
+      m_stack.back().fields = &type->propertiesGetter()->getMap();
+      return true;
+    }
+
+    if(id == data::mapping::type::__class::AbstractPairList::CLASS_ID.id) {
+      pushMap(type, &addMapItem<oatpp::AbstractFields>, false);
+      return true;
+    }
+
+    if(id == data::mapping::type::__class::AbstractUnorderedMap::CLASS_ID.id) {
+      pushMap(type, &addMapItem<oatpp::AbstractUnorderedFields>, false);
+      return true;
+    }
+
+    if(id == data::mapping::type::__class::Any::CLASS_ID.id) {
+      pushMap(oatpp::Fields<oatpp::Any>::Class::getType(), &addMapItem<oatpp::AbstractFields>, true);
+      return true;
+    }
+
+  } else if(c == '[') {
+
+    if(id == data::mapping::type::__class::AbstractVector::CLASS_ID.id) {
+      pushList(type, &addListItem<oatpp::AbstractVector>, false);
+      return true;
+    }
+
+    if(id == data::mapping::type::__class::AbstractList::CLASS_ID.id) {
+      pushList(type, &addListItem<oatpp::AbstractList>, false);
+      return true;
+    }
+
+    if(id == data::mapping::type::__class::AbstractUnorderedSet::CLASS_ID.id) {
+      pushList(type, &addListItem<oatpp::AbstractUnorderedSet>, false);
+      return true;
+    }
+
+    if(id == data::mapping::type::__class::Any::CLASS_ID.id) {
+      pushList(oatpp::List<oatpp::Any>::Class::getType(), &addListItem<oatpp::AbstractList>, true);
+      return true;
+    }
+
+  }
+
+  return startCapture(c, type, false, false);
+
+}
+
+bool PushDeserializer::startCapture(v_char8 c, const Type* type, bool key, bool skip) {
+
+  m_captureType = type;
+  m_captureKey = key;
+  m_captureSkip = skip;
+  m_captureEscape = false;
+  m_captureInString = false;
+  m_captureDepth = 0;
+  m_captureStart = m_charPosition;
+  m_buffer.clear();
+
+  if(c == '"') {
+    m_capture = Capture::STRING;
+  } else if(c == '{' || c == '[') {
+    m_capture = Capture::SCOPE;
+    m_captureDepth = 1;
+  } else {
+    m_capture = Capture::TOKEN;
+    return false;
+  }
+
+  if(!skip) {
+    m_buffer.push_back((char) c);
+  }
+  return true;
+
+}
+
+void PushDeserializer::pushMap(const Type* type, MapItemAdder adder, bool wrapAny) {
+
+  auto it = type->params.begin();
+  const Type* keyType = *it ++;
+  if(keyType->classId.id != oatpp::data::mapping::type::__class::String::CLASS_ID.id){
+    fail("[oatpp::parser::json::mapping::PushDeserializer::pushMap()]: Invalid json map key. Key should be String",
+         0, m_charPosition);
+    return;
+  }
+
+  m_stack.push_back(Frame(Kind::MAP, type->creator(), *it, wrapAny));
+  m_stack.back().mapItemAdder = adder;
+
+}
+
+void PushDeserializer::pushList(const Type* type, ListItemAdder adder, bool wrapAny) {
+  m_stack.push_back(Frame(Kind::LIST, type->creator(), *type->params.begin(), wrapAny));
+  m_stack.back().listItemAdder = adder;
+}
+
+void PushDeserializer::popFrame() {
+
+  oatpp::Void value = m_stack.back().container;
+  bool wrapAny = m_stack.back().wrapAny;
+  m_stack.pop_back();
+
+  if(wrapAny) {
+    auto anyHandle = std::make_shared<data::mapping::type::AnyHandle>(value.getPtr(), value.valueType);
+    onValue(oatpp::Void(anyHandle, oatpp::Any::Class::getType()));
+  } else {
+    onValue(value);
+  }
+
+}
+
+void PushDeserializer::onKey(parser::Caret& caret) {
+
+  Frame& frame = m_stack.back();
+
+  if(frame.kind == Kind::MAP) {
+
+    frame.key = Utils::parseString(caret);
+    if(caret.hasError()) {
+      fail(caret.getErrorMessage(), caret.getErrorCode(), m_captureStart + caret.getPosition());
+      return;
+    }
+
+  } else {
+
+    auto key = Utils::parseStringToStdString(caret);
+    if(caret.hasError()) {
+      fail(caret.getErrorMessage(), caret.getErrorCode(), m_captureStart + caret.getPosition());
+      return;
+    }
+
+    auto it = frame.fields->find(key);
+    if(it != frame.fields->end()) {
+      frame.field = it->second;
+      frame.skipValue = false;
+    } else if(m_deserializer->getConfig()->allowUnknownFields) {
+      frame.field = nullptr;
+      frame.skipValue = true;
+    } else {
+      fail("[oatpp::parser::json::mapping::PushDeserializer::onKey()]: Error. Unknown field",
+           Deserializer::ERROR_CODE_OBJECT_SCOPE_UNKNOWN_FIELD, m_captureStart);
+      return;
+    }
+
+  }
+
+  frame.state = State::COLON;
+
+}
+
+void PushDeserializer::onValue(const oatpp::Void& value) {
+
+  if(m_stack.empty()) {
+    m_result = value.getPtr();
+    m_resultType = value.valueType;
+    m_done = true;
+    return;
+  }
+
+  Frame& frame = m_stack.back();
+
+  switch(frame.kind) {
+    case Kind::OBJECT:
+      frame.field->set(frame.container.get(), value);
+      break;
+    case Kind::LIST:
+      (*frame.listItemAdder)(frame.container, value);
+      break;
+    case Kind::MAP:
+      (*frame.mapItemAdder)(frame.container, frame.key, value);
+      break;
+  }
+
+  frame.state = State::COMMA_OR_END;
+
+}
+
+void PushDeserializer::onCaptured() {
+
+  m_capture = Capture::NONE;
+
+  if(m_captureSkip) {
+    Frame& frame = m_stack.back();
+    frame.skipValue = false;
+    frame.state = State::COMMA_OR_END;
+    return;
+  }
+
+  parser::Caret caret((p_char8) &m_buffer[0], m_buffer.size());
+
+  if(m_captureKey) {
+    onKey(caret);
+    return;
+  }
+
+  auto value = m_deserializer->deserialize(caret, m_captureType);
+  if(caret.hasError()) {
+    fail(caret.getErrorMessage(), caret.getErrorCode(), m_captureStart + caret.getPosition());
+    return;
+  }
+
+  if(!m_stack.empty()) {
+    caret.skipBlankChars();
+    if(caret.canContinue()) {
+      if(m_stack.back().kind == Kind::LIST) {
+        fail("[oatpp::parser::json::mapping::PushDeserializer::onCaptured()]: Error. ']' - expected",
+             Deserializer::ERROR_CODE_ARRAY_SCOPE_CLOSE, m_captureStart + caret.getPosition());
+      } else {
+        fail("[oatpp::parser::json::mapping::PushDeserializer::onCaptured()]: Error. '}' - expected",
+             Deserializer::ERROR_CODE_OBJECT_SCOPE_CLOSE, m_captureStart + caret.getPosition());
+      }
+      return;
+    }
+  }
+
+  onValue(value);
+
+}
+
+v_buff_size PushDeserializer::capture(const v_char8* data, v_buff_size size) {
+
+  v_buff_size i = 0;
+  bool complete = false;
+
+  switch(m_capture) {
+
+    case Capture::TOKEN:
+      while(i < size) {
+        v_char8 c = data[i];
+        if(isBlankChar(c) || c == ',' || c == '}' || c == ']') {
+          complete = true;
+          break;
+        }
+        i ++;
+      }
+      break;
+
+    case Capture::STRING:
+      while(i < size) {
+        v_char8 c = data[i ++];
+        if(m_captureEscape) {
+          m_captureEscape = false;
+        } else if(c == '\\') {
+          m_captureEscape = true;
+        } else if(c == '"') {
+          complete = true;
+          break;
+        }
+      }
+      break;
+
+    case Capture::SCOPE:
+      while(i < size) {
+        v_char8 c = data[i ++];
+        if(m_captureInString) {
+          if(m_captureEscape) {
+            m_captureEscape = false;
+          } else if(c == '\\') {
+            m_captureEscape = true;
+          } else if(c == '"') {
+            m_captureInString = false;
+          }
+        } else if(c == '"') {
+          m_captureInString = true;
+        } else if(c == '{' || c == '[') {
+          m_captureDepth ++;
+        } else if(c == '}' || c == ']') {
+          m_captureDepth --;
+          if(m_captureDepth == 0) {
+            complete = true;
+            break;
+          }
+        }
+      }
+      break;
+
+    default:
+      break;
+
+  }
+
+  if(!m_captureSkip) {
+    m_buffer.append((const char*) data, i);
+  }
+
+  if(complete) {
+    onCaptured();
+  }
+
+  return i;
+
+}
+
+v_buff_size PushDeserializer::consumeStructure(const v_char8* data, v_buff_size pos) {
+
+  v_char8 c = data[pos];
+  if(isBlankChar(c)) {
+    return pos + 1;
+  }
+
+  m_charPosition = m_position + pos;
+
+  if(m_stack.empty()) {
+    return startValue(c, m_type, false) ? pos + 1 : pos;
+  }
+
+  Frame& frame = m_stack.back();
+
+  switch(frame.state) {
+
+    case State::KEY_OR_END:
+      if(c == '}') {
+        popFrame();
+        return pos + 1;
+      }
+      if(c == '"') {
+        startCapture(c, nullptr, true, false);
+        return pos + 1;
+      }
+      fail("[oatpp::parser::json::mapping::PushDeserializer::consumeStructure()]: Error. '}' - expected",
+           Deserializer::ERROR_CODE_OBJECT_SCOPE_CLOSE, m_charPosition);
+      return pos;
+
+    case State::COLON:
+      if(c == ':') {
+        frame.state = State::VALUE;
+        return pos + 1;
+      }
+      fail("[oatpp::parser::json::mapping::PushDeserializer::consumeStructure()]: Error. ':' - expected",
+           Deserializer::ERROR_CODE_OBJECT_SCOPE_COLON_MISSING, m_charPosition);
+      return pos;
+
+    case State::VALUE: {
+      const Type* type = frame.kind == Kind::OBJECT ? (frame.field ? frame.field->type : nullptr) : frame.valueType;
+      return startValue(c, type, frame.skipValue) ? pos + 1 : pos;
+    }
+
+    case State::VALUE_OR_END:
+      if(c == ']') {
+        popFrame();
+        return pos + 1;
+      }
+      return startValue(c, frame.valueType, false) ? pos + 1 : pos;
+
+    case State::COMMA_OR_END:
+      if(frame.kind == Kind::LIST) {
+        if(c == ',') {
+          frame.state = State::VALUE_OR_END;
+          return pos + 1;
+        }
+        if(c == ']') {
+          popFrame();
+          return pos + 1;
+        }
+        fail("[oatpp::parser::json::mapping::PushDeserializer::consumeStructure()]: Error. ']' - expected",
+             Deserializer::ERROR_CODE_ARRAY_SCOPE_CLOSE, m_charPosition);
+      } else {
+        if(c == ',') {
+          frame.state = State::KEY_OR_END;
+          return pos + 1;
+        }
+        if(c == '}') {
+          popFrame();
+          return pos + 1;
+        }
+        fail("[oatpp::parser::json::mapping::PushDeserializer::consumeStructure()]: Error. '}' - expected",
+             Deserializer::ERROR_CODE_OBJECT_SCOPE_CLOSE, m_charPosition);
+      }
+      return pos;
+
+  }
+
+  return pos;
+
+}
+
+void PushDeserializer::consume(const v_char8* data, v_buff_size count) {
+
+  v_buff_size pos = 0;
+
+  while(pos < count && !m_done && !hasError()) {
+    if(m_capture != Capture::NONE) {
+      pos += capture(&data[pos], count - pos);
+    } else {
+      pos = consumeStructure(data, pos);
+    }
+  }
+
+}
+
+v_io_size PushDeserializer::write(const void *data, v_buff_size count, async::Action& action) {
+
+  (void) action;
+
+  if(m_deserializer->getConfig()->usePooledAllocation) {
+    base::memory::PooledAllocation::Scope scope;
+    consume((const v_char8*) data, count);
+  } else {
+    consume((const v_char8*) data, count);
+  }
+
+  m_position += count;
+  return count;
+
+}
+
+oatpp::Void PushDeserializer::finish() {
+  if(m_deserializer->getConfig()->usePooledAllocation) {
+    base::memory::PooledAllocation::Scope scope;
+    return complete();
+  }
+  return complete();
+}
+
+oatpp::Void PushDeserializer::complete() {
+
+  if(!m_done && !hasError() && m_capture != Capture::NONE && (m_capture == Capture::TOKEN || m_stack.empty())) {
+    onCaptured();
+  }
+
+  if(!m_done && !hasError()) {
+
+    if(m_stack.empty()) {
+      parser::Caret caret("");
+      auto value = m_deserializer->deserialize(caret, m_type);
+      if(caret.hasError()) {
+        fail(caret.getErrorMessage(), caret.getErrorCode(), m_position);
+      } else {
+        onValue(value);
+      }
+    } else if(m_stack.back().kind == Kind::LIST) {
+      fail("[oatpp::parser::json::mapping::PushDeserializer::finish()]: Error. ']' - expected",
+           Deserializer::ERROR_CODE_ARRAY_SCOPE_CLOSE, m_position);
+    } else {
+      fail("[oatpp::parser::json::mapping::PushDeserializer::finish()]: Error. '}' - expected",
+           Deserializer::ERROR_CODE_OBJECT_SCOPE_CLOSE, m_position);
+    }
+
+  }
+
+  if(hasError()) {
+    return nullptr;
+  }
+
+  return oatpp::Void(m_result, m_resultType);
+
+}
+
+}}}}
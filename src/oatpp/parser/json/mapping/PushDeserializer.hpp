@@ -0,0 +1,189 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_parser_json_mapping_PushDeserializer_hpp
+#define oatpp_parser_json_mapping_PushDeserializer_hpp
+
+#include "./Deserializer.hpp"
+
+#include "oatpp/core/data/mapping/ObjectMapper.hpp"
+
+namespace oatpp { namespace parser { namespace json { namespace mapping {
+
+/**
+ * Resumable push-parser for json. <br>
+ * Consumes json chunk by chunk as it arrives (for example from the request body stream) and builds the resultant object
+ * incrementally. Objects, lists, and maps are built as their elements arrive, only the text of the current
+ * scalar value is buffered, so memory used by the parser does not depend on the size of the json. <br>
+ * Scalar values and values of types other than DTO objects, lists, maps, and `Any` are buffered
+ * and deserialized by &id:oatpp::parser::json::mapping::Deserializer;.
+ * Extends &id:oatpp::data::mapping::ObjectMapper::Reader;.
+ */
+class PushDeserializer : public oatpp::data::mapping::ObjectMapper::Reader {
+public:
+  typedef oatpp::data::mapping::type::Type Type;
+  typedef oatpp::data::mapping::type::Type::Property Property;
+private:
+
+  typedef void (*ListItemAdder)(const oatpp::Void& list, const oatpp::Void& item);
+  typedef void (*MapItemAdder)(const oatpp::Void& map, const oatpp::Void& key, const oatpp::Void& value);
+
+  template<class Collection>
+  static void addListItem(const oatpp::Void& list, const oatpp::Void& item) {
+    auto dispatcher = static_cast<const typename Collection::Class::AbstractPolymorphicDispatcher*>(list.valueType->polymorphicDispatcher);
+    dispatcher->addPolymorphicItem(list, item);
+  }
+
+  template<class Collection>
+  static void addMapItem(const oatpp::Void& map, const oatpp::Void& key, const oatpp::Void& value) {
+    auto dispatcher = static_cast<const typename Collection::Class::AbstractPolymorphicDispatcher*>(map.valueType->polymorphicDispatcher);
+    dispatcher->addPolymorphicItem(map, key, value);
+  }
+
+private:
+
+  /**
+   * What is expected next in the scope.
+   */
+  enum class State : v_int32 {
+    KEY_OR_END,
+    COLON,
+    VALUE,
+    VALUE_OR_END,
+    COMMA_OR_END
+  };
+
+  /**
+   * Buffered token kind.
+   */
+  enum class Capture : v_int32 {
+    NONE,
+    TOKEN,
+    STRING,
+    SCOPE
+  };
+
+  enum class Kind : v_int32 {
+    OBJECT,
+    LIST,
+    MAP
+  };
+
+  /**
+   * Object, list, or map being built.
+   */
+  struct Frame {
+
+    Frame(Kind pKind, const oatpp::Void& pContainer, const Type* pValueType, bool pWrapAny)
+      : kind(pKind)
+      , state(pKind == Kind::LIST ? State::VALUE_OR_END : State::KEY_OR_END)
+      , container(pContainer)
+      , fields(nullptr)
+      , valueType(pValueType)
+      , field(nullptr)
+      , listItemAdder(nullptr)
+      , mapItemAdder(nullptr)
+      , skipValue(false)
+      , wrapAny(pWrapAny)
+    {}
+
+    Kind kind;
+    State state;
+    oatpp::Void container;
+    const std::unordered_map<std::string, Property*>* fields;
+    const Type* valueType;
+    Property* field;
+    oatpp::String key;
+    ListItemAdder listItemAdder;
+    MapItemAdder mapItemAdder;
+    bool skipValue;
+    bool wrapAny;
+  };
+
+private:
+  std::shared_ptr<Deserializer> m_deserializer;
+  const Type* m_type;
+  std::vector<Frame> m_stack;
+  std::shared_ptr<void> m_result;
+  const Type* m_resultType;
+  bool m_done;
+private:
+  Capture m_capture;
+  const Type* m_captureType;
+  bool m_captureKey;
+  bool m_captureSkip;
+  bool m_captureEscape;
+  bool m_captureInString;
+  v_int32 m_captureDepth;
+  std::string m_buffer;
+  v_buff_size m_captureStart;
+private:
+  v_buff_size m_position;
+  v_buff_size m_charPosition;
+private:
+  void fail(const char* message, v_int64 code, v_buff_size position);
+  bool startValue(v_char8 c, const Type* type, bool skip);
+  bool startCapture(v_char8 c, const Type* type, bool key, bool skip);
+  void pushMap(const Type* type, MapItemAdder adder, bool wrapAny);
+  void pushList(const Type* type, ListItemAdder adder, bool wrapAny);
+  void popFrame();
+  void onKey(parser::Caret& caret);
+  void onValue(const oatpp::Void& value);
+  void onCaptured();
+  v_buff_size capture(const v_char8* data, v_buff_size size);
+  v_buff_size consumeStructure(const v_char8* data, v_buff_size pos);
+  void consume(const v_char8* data, v_buff_size count);
+  oatpp::Void complete();
+public:
+
+  /**
+   * Constructor.
+   * @param deserializer - &id:oatpp::parser::json::mapping::Deserializer; used for scalar values and config.
+   * @param type - type of the resultant object. See &id:oatpp::data::mapping::type::Type;.
+   */
+  PushDeserializer(const std::shared_ptr<Deserializer>& deserializer, const Type* const type);
+
+  /**
+   * Push next chunk of json. <br>
+   * If &id:oatpp::parser::json::mapping::Deserializer::Config;::usePooledAllocation is set,
+   * objects are allocated within &id:oatpp::base::memory::PooledAllocation::Scope;.
+   * @param data - pointer to data.
+   * @param count - size of the data in bytes.
+   * @param action - not used.
+   * @return - `count`. Data pushed after an error or after the end of the root value is ignored.
+   */
+  v_io_size write(const void *data, v_buff_size count, async::Action& action) override;
+
+  /**
+   * Signal the end of json and get the resultant object.
+   * If nullptr is returned - check &id:oatpp::data::mapping::ObjectMapper::Reader::hasError;.
+   * @return - &id:oatpp::Void;.
+   */
+  oatpp::Void finish() override;
+
+};
+
+}}}}
+
+#endif /* oatpp_parser_json_mapping_PushDeserializer_hpp */
@@ -27,6 +27,7 @@
 #include "oatpp/parser/json/Utils.hpp"
 #include "oatpp/core/data/mapping/type/Any.hpp"
 
+
 namespace oatpp { namespace parser { namespace json { namespace mapping {
 
 Serializer::Serializer(const std::shared_ptr<Config>& config)
@@ -37,6 +38,7 @@ Serializer::Serializer(const std::shared_ptr<Config>& config)
 
   setSerializerMethod(data::mapping::type::__class::String::CLASS_ID, &Serializer::serializeString);
   setSerializerMethod(data::mapping::type::__class::Any::CLASS_ID, &Serializer::serializeAny);
+  setSerializerMethod(json::__class::JsonValue::CLASS_ID, &Serializer::serializeJsonValue);
 
   setSerializerMethod(data::mapping::type::__class::Int8::CLASS_ID, &Serializer::serializePrimitive<oatpp::Int8>);
   setSerializerMethod(data::mapping::type::__class::UInt8::CLASS_ID, &Serializer::serializePrimitive<oatpp::UInt8>);
@@ -115,6 +117,24 @@ void Serializer::serializeAny(Serializer* serializer,
 
 }
 
+void Serializer::serializeJsonValue(Serializer* serializer,
+                                    data::stream::ConsistentOutputStream* stream,
+                                    const oatpp::Void& polymorph)
+{
+
+  (void) serializer;
+
+  if(!polymorph) {
+    stream->writeSimple("null", 4);
+    return;
+  }
+
+  auto handle = static_cast<JsonValueHandle*>(polymorph.get());
+  auto raw = handle->tape->getRaw(handle->index);
+  stream->writeSimple(raw.getData(), raw.getSize());
+
+}
+
 void Serializer::serializeEnum(Serializer* serializer,
                                data::stream::ConsistentOutputStream* stream,
                                const oatpp::Void& polymorph)
@@ -149,28 +169,72 @@ void Serializer::serializeObject(Serializer* serializer,
     return;
   }
 
+  const auto& info = serializer->getObjectInfo(polymorph.valueType);
+  auto staticMethod = info.staticMethod.load(std::memory_order_acquire);
+  if(staticMethod) {
+    (*staticMethod)(serializer, stream, polymorph);
+    return;
+  }
+
   stream->writeCharSimple('{');
 
   bool first = true;
-  auto fields = polymorph.valueType->propertiesGetter()->getList();
+  const auto& fields = polymorph.valueType->propertiesGetter()->getList();
   Object* object = static_cast<Object*>(polymorph.get());
 
+  auto prefix = info.prefixes.begin();
   for (auto const& field : fields) {
 
     auto value = field->get(object);
     if(value || serializer->getConfig()->includeNullFields) {
-      (first) ? first = false : stream->writeSimple(",", 1);
-      serializeString(stream, (p_char8)field->name, std::strlen(field->name));
-      stream->writeSimple(":", 1);
+      if(first) {
+        first = false;
+        stream->writeSimple(prefix->data() + 1, prefix->size() - 1);
+      } else {
+        stream->writeSimple(prefix->data(), prefix->size());
+      }
       serializer->serialize(stream, value);
     }
 
+    ++ prefix;
+
   }
 
   stream->writeCharSimple('}');
 
 }
 
+std::string Serializer::encodePropertyPrefix(const char* name) {
+  auto encodedName = Utils::escapeString((p_char8)name, std::strlen(name), false);
+  std::string prefix;
+  prefix.reserve(encodedName->getSize() + 4);
+  prefix.append(",\"", 2);
+  prefix.append((const char*) encodedName->getData(), encodedName->getSize());
+  prefix.append("\":", 2);
+  return prefix;
+}
+
+Serializer::ObjectInfo& Serializer::getObjectInfo(const Type* type) {
+
+  std::lock_guard<concurrency::SpinLock> lock(m_objectsLock);
+
+  auto it = m_objects.find(type);
+  if(it != m_objects.end()) {
+    return it->second;
+  }
+
+  ObjectInfo& info = m_objects[type];
+  const auto& fields = type->propertiesGetter()->getList();
+  info.prefixes.reserve(fields.size());
+
+  for(auto const& field : fields) {
+    info.prefixes.push_back(encodePropertyPrefix(field->name));
+  }
+
+  return info;
+
+}
+
 void Serializer::serialize(data::stream::ConsistentOutputStream* stream,
                             const oatpp::Void& polymorph)
 {
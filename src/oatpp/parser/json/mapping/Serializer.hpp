@@ -26,7 +26,14 @@
 #define oatpp_parser_json_mapping_Serializer_hpp
 
 #include "oatpp/parser/json/Beautifier.hpp"
+#include "oatpp/parser/json/JsonValue.hpp"
+#include "oatpp/core/concurrency/SpinLock.hpp"
 #include "oatpp/core/Types.hpp"
+
+#include <unordered_map>
+#include <atomic>
+#include <mutex>
+#include <string>
 #include <vector>
 
 namespace oatpp { namespace parser { namespace json { namespace mapping {
@@ -36,6 +43,7 @@ namespace oatpp { namespace parser { namespace json { namespace mapping {
  * Serializes oatpp DTO object to json. See [Data Transfer Object(DTO) component](https://oatpp.io/docs/components/dto/).
  */
 class Serializer {
+  friend class PullSerializer;
 public:
   typedef oatpp::data::mapping::type::Type Type;
   typedef oatpp::data::mapping::type::Type::Property Property;
@@ -177,15 +185,226 @@ private:
                             data::stream::ConsistentOutputStream* stream,
                             const oatpp::Void& polymorph);
 
+  static void serializeJsonValue(Serializer* serializer,
+                                 data::stream::ConsistentOutputStream* stream,
+                                 const oatpp::Void& polymorph);
+
   static void serializeObject(Serializer* serializer,
                               data::stream::ConsistentOutputStream* stream,
                               const oatpp::Void& polymorph);
 
   void serialize(data::stream::ConsistentOutputStream* stream, const oatpp::Void& polymorph);
 
+private:
+
+  /**
+   * Collects pre-encoded property name prefixes in the order of DTO field declaration.
+   */
+  class StaticPrefixesBuilder {
+  public:
+    std::vector<std::string> prefixes;
+  public:
+    template<class Owner, v_int32 Index>
+    void visitField(const Property* property) {
+      prefixes.push_back(encodePropertyPrefix(property->name));
+    }
+  };
+
+  /**
+   * Serializes DTO fields with statically known types.
+   */
+  class StaticFieldSerializer {
+  private:
+    Serializer* m_serializer;
+    data::stream::ConsistentOutputStream* m_stream;
+    const std::string* m_prefix;
+    bool m_includeNullFields;
+    bool m_first;
+  public:
+
+    StaticFieldSerializer(Serializer* serializer, data::stream::ConsistentOutputStream* stream, const std::string* prefixes)
+      : m_serializer(serializer)
+      , m_stream(stream)
+      , m_prefix(prefixes)
+      , m_includeNullFields(serializer->getConfig()->includeNullFields)
+      , m_first(true)
+    {}
+
+    template<class Wrapper>
+    void operator()(const Property* property, const Wrapper& value) {
+      (void) property;
+      if(value.get() != nullptr || m_includeNullFields) {
+        if(m_first) {
+          m_first = false;
+          m_stream->writeSimple(m_prefix->data() + 1, m_prefix->size() - 1);
+        } else {
+          m_stream->writeSimple(m_prefix->data(), m_prefix->size());
+        }
+        serializeStatic(m_serializer, m_stream, value);
+      }
+      ++ m_prefix;
+    }
+
+  };
+
+  template<class T>
+  static void serializeObjectStatic(Serializer* serializer, data::stream::ConsistentOutputStream* stream, T* object) {
+
+    static const std::vector<std::string> prefixes = []() {
+      StaticPrefixesBuilder builder;
+      T::Z__VISIT_FIELD_DESCRIPTORS(builder);
+      return std::move(builder.prefixes);
+    }();
+
+    stream->writeCharSimple('{');
+    StaticFieldSerializer fieldSerializer(serializer, stream, prefixes.data());
+    T::Z__VISIT_FIELDS(fieldSerializer, object);
+    stream->writeCharSimple('}');
+
+  }
+
+  template<class T>
+  static void serializeObjectStatic(Serializer* serializer,
+                                    data::stream::ConsistentOutputStream* stream,
+                                    const oatpp::Void& polymorph)
+  {
+    if(polymorph) {
+      serializeObjectStatic<T>(serializer, stream, static_cast<T*>(polymorph.get()));
+    } else {
+      stream->writeSimple("null", 4);
+    }
+  }
+
+  template<class Collection>
+  static void serializeListStatic(Serializer* serializer, data::stream::ConsistentOutputStream* stream, const Collection& list) {
+
+    if(list.get() == nullptr) {
+      stream->writeSimple("null", 4);
+      return;
+    }
+
+    const bool includeNullFields = serializer->getConfig()->includeNullFields;
+
+    stream->writeCharSimple('[');
+    bool first = true;
+
+    for(auto& value : *list) {
+      if(value.get() != nullptr || includeNullFields) {
+        (first) ? first = false : stream->writeSimple(",", 1);
+        serializeStatic(serializer, stream, value);
+      }
+    }
+
+    stream->writeCharSimple(']');
+
+  }
+
+  template<class Wrapper>
+  static void serializeStatic(Serializer* serializer, data::stream::ConsistentOutputStream* stream, const Wrapper& value) {
+    serializer->serialize(stream, value);
+  }
+
+  template<class V, class C>
+  static void serializeStatic(Serializer* serializer,
+                              data::stream::ConsistentOutputStream* stream,
+                              const data::mapping::type::Primitive<V, C>& value)
+  {
+    (void) serializer;
+    if(value.get() != nullptr) {
+      stream->writeAsString(* value.get());
+    } else {
+      stream->writeSimple("null", 4);
+    }
+  }
+
+  static void serializeStatic(Serializer* serializer, data::stream::ConsistentOutputStream* stream, const oatpp::Boolean& value) {
+    (void) serializer;
+    if(value.get() != nullptr) {
+      stream->writeAsString(* value.get());
+    } else {
+      stream->writeSimple("null", 4);
+    }
+  }
+
+  static void serializeStatic(Serializer* serializer, data::stream::ConsistentOutputStream* stream, const oatpp::String& value) {
+    (void) serializer;
+    if(value.get() != nullptr) {
+      serializeString(stream, value->getData(), value->getSize());
+    } else {
+      stream->writeSimple("null", 4);
+    }
+  }
+
+  template<class T>
+  static void serializeStatic(Serializer* serializer,
+                              data::stream::ConsistentOutputStream* stream,
+                              const data::mapping::type::DTOWrapper<T>& value)
+  {
+    if(value.get() != nullptr) {
+      serializeObjectStatic<T>(serializer, stream, value.get());
+    } else {
+      stream->writeSimple("null", 4);
+    }
+  }
+
+  template<class T>
+  static void serializeStatic(Serializer* serializer,
+                              data::stream::ConsistentOutputStream* stream,
+                              const data::mapping::type::ListObjectWrapper<T, data::mapping::type::__class::List<T>>& value)
+  {
+    serializeListStatic(serializer, stream, value);
+  }
+
+  template<class T>
+  static void serializeStatic(Serializer* serializer,
+                              data::stream::ConsistentOutputStream* stream,
+                              const data::mapping::type::VectorObjectWrapper<T, data::mapping::type::__class::Vector<T>>& value)
+  {
+    serializeListStatic(serializer, stream, value);
+  }
+
+private:
+
+  /**
+   * Per-type information cached by serializer.
+   */
+  struct ObjectInfo {
+
+    /**
+     * Pre-encoded property name prefixes `,"name":` in the same order as `type->propertiesGetter()->getList()`.
+     * Prefix without the leading comma is used for the first serialized field.
+     */
+    std::vector<std::string> prefixes;
+
+    /**
+     * Statically typed serializer method registered for this type. May be `nullptr`.
+     * Atomic since it may be registered while other threads serialize objects of this type.
+     */
+    std::atomic<SerializerMethod> staticMethod {nullptr};
+
+  };
+
+  /**
+   * Encode property name as `,"name":`.
+   * @param name - property name.
+   * @return - encoded prefix.
+   */
+  static std::string encodePropertyPrefix(const char* name);
+
+  /**
+   * Get cached information for object type.
+   * Information is computed once per type and cached for the lifetime of the serializer.
+   * @param type - object type.
+   * @return - &l:Serializer::ObjectInfo;.
+   */
+  ObjectInfo& getObjectInfo(const Type* type);
+
 private:
   std::shared_ptr<Config> m_config;
   std::vector<SerializerMethod> m_methods;
+private:
+  concurrency::SpinLock m_objectsLock;
+  std::unordered_map<const Type*, ObjectInfo> m_objects;
 public:
 
   /**
@@ -201,6 +420,22 @@ public:
    */
   void setSerializerMethod(const data::mapping::type::ClassId& classId, SerializerMethod method);
 
+  /**
+   * Serialize DTO class `T` with the statically typed serializer generated by `DTO_INIT` and `DTO_FIELD` macros
+   * instead of the reflective one. <br>
+   * Field types and offsets are resolved at compile time, primitives, strings, nested DTOs,
+   * and `List`/`Vector` fields are written without runtime type dispatch.
+   * Fields of other types fall back to the regular serializer methods. <br>
+   * Nested DTO fields are always serialized statically, register only the DTO classes which are serialized
+   * on their own or as items of non-DTO containers.
+   * @tparam T - DTO class.
+   */
+  template<class T>
+  void registerStaticSerializer() {
+    auto& info = getObjectInfo(T::ObjectWrapper::Class::getType());
+    info.staticMethod.store(&Serializer::serializeObjectStatic<T>, std::memory_order_release);
+  }
+
   /**
    * Serialize object to stream.
    * @param stream - &id:oatpp::data::stream::ConsistentOutputStream;.
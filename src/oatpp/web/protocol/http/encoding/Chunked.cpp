@@ -24,7 +24,9 @@
 
 #include "Chunked.hpp"
 
-#include "oatpp/core/utils/ConversionUtils.hpp"
+#include <algorithm>
+#include <cstring>
+#include <limits>
 
 namespace oatpp { namespace web { namespace protocol { namespace http { namespace encoding {
 
@@ -35,6 +37,36 @@ v_io_size EncoderChunked::suggestInputStreamReadSize() {
   return 32767;
 }
 
+v_buff_size EncoderChunked::writeChunkHeader(p_char8 buffer, bool trailer, v_io_size chunkSize) {
+
+  static const char* HEX_DIGITS = "0123456789ABCDEF";
+
+  v_buff_size pos = 0;
+
+  if(trailer) {
+    buffer[pos ++] = '\r';
+    buffer[pos ++] = '\n';
+  }
+
+  v_char8 digits[16];
+  v_buff_size digitsCount = 0;
+  v_uint64 value = (v_uint64) chunkSize;
+  do {
+    digits[digitsCount ++] = HEX_DIGITS[value & 0x0F];
+    value >>= 4;
+  } while(value > 0);
+
+  while(digitsCount > 0) {
+    buffer[pos ++] = digits[-- digitsCount];
+  }
+
+  buffer[pos ++] = '\r';
+  buffer[pos ++] = '\n';
+
+  return pos;
+
+}
+
 v_int32 EncoderChunked::iterate(data::buffer::InlineReadData& dataIn, data::buffer::InlineReadData& dataOut) {
 
   if(dataOut.bytesLeft > 0) {
@@ -59,21 +91,21 @@ v_int32 EncoderChunked::iterate(data::buffer::InlineReadData& dataIn, data::buff
 
     if(m_writeChunkHeader) {
 
-      async::Action action;
-      data::stream::BufferOutputStream stream(16, 16);
-      if(!m_firstChunk) {
-        stream.write("\r\n", 2, action);
+      v_buff_size size = writeChunkHeader(m_buffer, m_pendingTrailer, dataIn.bytesLeft);
+      m_pendingTrailer = false;
+
+      if(dataIn.bytesLeft <= SMALL_CHUNK_MAX_SIZE) {
+        /* coalesce header, payload, and trailer of the small chunk */
+        std::memcpy(m_buffer + size, dataIn.currBufferPtr, dataIn.bytesLeft);
+        size += dataIn.bytesLeft;
+        m_buffer[size ++] = '\r';
+        m_buffer[size ++] = '\n';
+        m_lastFlush = dataIn.bytesLeft;
+      } else {
+        m_writeChunkHeader = false;
       }
 
-      stream << utils::conversion::primitiveToStr(dataIn.bytesLeft, "%X");
-      stream.write("\r\n", 2, action);
-
-      m_chunkHeader = stream.toString();
-      dataOut.set(m_chunkHeader->getData(), m_chunkHeader->getSize());
-
-      m_firstChunk = false;
-      m_writeChunkHeader = false;
-
+      dataOut.set(m_buffer, size);
       return Error::FLUSH_DATA_OUT;
 
     }
@@ -81,24 +113,19 @@ v_int32 EncoderChunked::iterate(data::buffer::InlineReadData& dataIn, data::buff
     dataOut = dataIn;
     m_lastFlush = dataOut.bytesLeft;
     m_writeChunkHeader = true;
+    m_pendingTrailer = true;
     return Error::FLUSH_DATA_OUT;
 
   }
 
   if(m_writeChunkHeader){
 
-    async::Action action;
-    data::stream::BufferOutputStream stream(16, 16);
-    if(!m_firstChunk) {
-      stream.write("\r\n", 2, action);
-    }
-
-    stream.write("0\r\n\r\n", 5, action);
+    v_buff_size size = writeChunkHeader(m_buffer, m_pendingTrailer, 0);
+    m_buffer[size ++] = '\r';
+    m_buffer[size ++] = '\n';
+    dataOut.set(m_buffer, size);
 
-    m_chunkHeader = stream.toString();
-    dataOut.set(m_chunkHeader->getData(), m_chunkHeader->getSize());
-
-    m_firstChunk = false;
+    m_pendingTrailer = false;
     m_writeChunkHeader = false;
 
     return Error::FLUSH_DATA_OUT;
@@ -114,72 +141,158 @@ v_int32 EncoderChunked::iterate(data::buffer::InlineReadData& dataIn, data::buff
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // DecoderChunked
 
-DecoderChunked::DecoderChunked()
-  : m_chunkHeaderBuffer(16, 16)
-  , m_currentChunkSize(-1)
-  , m_firstChunk(true)
-  , m_finished(false)
+DecoderChunked::DecoderChunked(v_buff_size maxLineSize, v_io_size maxBodySize)
+  : m_maxLineSize(maxLineSize)
+  , m_maxBodySize(maxBodySize)
+  , m_state(State::CHUNK_HEADER)
+  , m_chunkBytesLeft(0)
+  , m_bodySize(0)
   , m_lastFlush(0)
+  , m_trailerFieldsCount(0)
 {}
 
-v_io_size DecoderChunked::suggestInputStreamReadSize() {
-  if(m_currentChunkSize > 0) {
-    return m_currentChunkSize;
+bool DecoderChunked::parseChunkSize(p_char8 line, v_buff_size lineSize, v_io_size& chunkSize) {
+
+  chunkSize = 0;
+  v_buff_size i = 0;
+
+  for(; i < lineSize; i++) {
+
+    v_char8 c = line[i];
+    v_io_size digit;
+
+    if(c >= '0' && c <= '9') {
+      digit = c - '0';
+    } else if(c >= 'a' && c <= 'f') {
+      digit = c - 'a' + 10;
+    } else if(c >= 'A' && c <= 'F') {
+      digit = c - 'A' + 10;
+    } else {
+      break;
+    }
+
+    if(chunkSize > (std::numeric_limits<v_io_size>::max() >> 4)) {
+      return false;
+    }
+    chunkSize = (chunkSize << 4) + digit;
+
   }
-  return 1;
-}
 
-v_int32 DecoderChunked::readHeader(data::buffer::InlineReadData& dataIn) {
+  if(i == 0) {
+    return false;
+  }
 
-  async::Action action;
+  /* skip chunk extensions */
+  return i == lineSize || line[i] == ';' || line[i] == ' ' || line[i] == '\t';
 
-  while(dataIn.bytesLeft > 0 && m_currentChunkSize < 0) {
+}
 
-    if (m_chunkHeaderBuffer.getCurrentPosition() < 12) {
+v_int32 DecoderChunked::readLine(data::buffer::InlineReadData& dataIn, p_char8& line, v_buff_size& lineSize) {
 
-      m_chunkHeaderBuffer.write(dataIn.currBufferPtr, 1, action);
-      dataIn.inc(1);
+  /*
+   * Framing lines are short (bounded by m_maxLineSize), so a single-byte search is enough.
+   * The SSE2/AVX2 classifier of oatpp::parser::json::StructuralIndex tracks JSON string and escape state
+   * in 64-byte blocks and is not reused here - libc memchr is already vectorized for a single needle.
+   */
+  p_char8 data = (p_char8) dataIn.currBufferPtr;
+  p_char8 lineEnd = (p_char8) std::memchr(data, '\n', dataIn.bytesLeft);
+  v_buff_size size = lineEnd == nullptr ? dataIn.bytesLeft : lineEnd - data + 1;
 
-      auto pos = m_chunkHeaderBuffer.getCurrentPosition();
+  if((v_buff_size) m_lineBuffer.size() + size > m_maxLineSize) {
+    return ERROR_CHUNK_HEADER_TOO_LONG;
+  }
 
-      if(m_currentChunkSize == -1) {
+  dataIn.inc(size);
 
-        if (pos > 2 && m_chunkHeaderBuffer.getData()[pos - 2] == '\r' && m_chunkHeaderBuffer.getData()[pos - 1] == '\n') {
+  if(lineEnd == nullptr) {
+    m_lineBuffer.append((const char*) data, size);
+    return Error::PROVIDE_DATA_IN;
+  }
 
-          if(m_firstChunk) {
-            m_currentChunkSize = strtol((const char *) m_chunkHeaderBuffer.getData(), nullptr, 16);
-          } else {
-            // skip "/r/n" before chunk size
-            m_currentChunkSize = strtol((const char *) (m_chunkHeaderBuffer.getData() + 2), nullptr, 16);
-          }
+  if(m_lineBuffer.empty()) {
+    line = data;
+  } else {
+    m_lineBuffer.append((const char*) data, size);
+    line = (p_char8) &m_lineBuffer[0];
+    size = m_lineBuffer.size();
+  }
 
-          if (m_currentChunkSize > 0) {
-            return Error::OK;
-          } else {
-            m_currentChunkSize = -2;
-          }
+  /* strip LF and optional CR */
+  size --;
+  if(size > 0 && line[size - 1] == '\r') {
+    size --;
+  }
 
-        }
+  lineSize = size;
+  return Error::OK;
 
-      } else if(m_currentChunkSize == -2) {
+}
 
-        if (pos > 4 &&
-            m_chunkHeaderBuffer.getData()[pos - 4] == '\r' && m_chunkHeaderBuffer.getData()[pos - 3] == '\n' &&
-            m_chunkHeaderBuffer.getData()[pos - 2] == '\r' && m_chunkHeaderBuffer.getData()[pos - 1] == '\n') {
-          m_currentChunkSize = 0;
-          m_finished = true;
-          return Error::OK;
-        }
+v_int32 DecoderChunked::onLine(p_char8 line, v_buff_size lineSize) {
 
-      }
+  switch(m_state) {
 
-    } else {
-      return ERROR_CHUNK_HEADER_TOO_LONG;
+    case State::CHUNK_HEADER: {
+      v_io_size chunkSize;
+      if(!parseChunkSize(line, lineSize, chunkSize)) {
+        return ERROR_INVALID_CHUNK_HEADER;
+      }
+      if(m_maxBodySize >= 0 && chunkSize > m_maxBodySize - m_bodySize) {
+        return ERROR_BODY_TOO_LARGE;
+      }
+      m_bodySize += chunkSize;
+      if(chunkSize > 0) {
+        m_chunkBytesLeft = chunkSize;
+        m_state = State::CHUNK_DATA;
+      } else {
+        m_state = State::TRAILER;
+      }
+      return Error::OK;
     }
 
+    case State::CHUNK_DATA_END:
+      if(lineSize != 0) {
+        return ERROR_INVALID_CHUNK_HEADER;
+      }
+      m_state = State::CHUNK_HEADER;
+      return Error::OK;
+
+    case State::TRAILER:
+      /* trailer fields are skipped. Empty line ends the body */
+      if(lineSize == 0) {
+        m_state = State::FINISHED;
+      } else if(++ m_trailerFieldsCount > MAX_TRAILER_FIELDS) {
+        return ERROR_TOO_MANY_TRAILER_FIELDS;
+      }
+      return Error::OK;
+
+    default:
+      return ERROR_INVALID_CHUNK_HEADER;
+
   }
 
-  return Error::PROVIDE_DATA_IN;
+}
+
+v_io_size DecoderChunked::suggestInputStreamReadSize() {
+
+  /*
+   * Ask only for the bytes which are guaranteed to belong to the body:
+   * chunk data is followed by CRLF and by at least 3 bytes of the next chunk-size line ("0\r\n"),
+   * and the chunk-size line is followed by at least CRLF.
+   */
+  switch(m_state) {
+    case State::CHUNK_DATA:
+      /* chunk size may be up to the max of v_io_size */
+      return std::min<v_io_size>(m_chunkBytesLeft, std::numeric_limits<v_io_size>::max() - 5) + 5;
+    case State::CHUNK_DATA_END:
+      return m_lineBuffer.empty() ? 5 : 4;
+    case State::CHUNK_HEADER:
+      return m_lineBuffer.empty() ? 5 : 3;
+    case State::TRAILER:
+      return m_lineBuffer.empty() ? 2 : 1;
+    default:
+      return 1;
+  }
 
 }
 
@@ -193,50 +306,63 @@ v_int32 DecoderChunked::iterate(data::buffer::InlineReadData& dataIn, data::buff
 
     if(m_lastFlush > 0) {
       dataIn.inc(m_lastFlush);
-      m_currentChunkSize -= m_lastFlush;
-      if(m_currentChunkSize == 0) {
-        m_currentChunkSize = -1;
+      m_chunkBytesLeft -= m_lastFlush;
+      if(m_chunkBytesLeft == 0) {
+        m_state = State::CHUNK_DATA_END;
       }
       m_lastFlush = 0;
     }
 
-    if (m_finished) {
-      dataOut.set(nullptr, 0);
-      return Error::FINISHED;
-    }
+    while(true) {
 
-    if (dataIn.bytesLeft == 0) {
-      return Error::PROVIDE_DATA_IN;
-    }
+      if(m_state == State::FINISHED) {
+        dataOut.set(nullptr, 0);
+        return Error::FINISHED;
+      }
 
-    if(m_currentChunkSize < 0) {
-      return readHeader(dataIn);
-    } else if(m_currentChunkSize == 0) {
-      m_chunkHeaderBuffer.setCurrentPosition(0);
-      dataOut.set(nullptr, 0);
-      m_finished = true;
-      return Error::FINISHED;
-    }
+      if(dataIn.bytesLeft == 0) {
+        return Error::PROVIDE_DATA_IN;
+      }
+
+      if(m_state == State::CHUNK_DATA) {
+        m_lastFlush = dataIn.bytesLeft;
+        if(m_lastFlush > m_chunkBytesLeft) {
+          m_lastFlush = m_chunkBytesLeft;
+        }
+        dataOut.set(dataIn.currBufferPtr, m_lastFlush);
+        return Error::FLUSH_DATA_OUT;
+      }
+
+      p_char8 line;
+      v_buff_size lineSize;
+      v_int32 res = readLine(dataIn, line, lineSize);
+      if(res != Error::OK) {
+        return res;
+      }
 
-    m_chunkHeaderBuffer.setCurrentPosition(0);
+      res = onLine(line, lineSize);
+      m_lineBuffer.clear();
+      if(res != Error::OK) {
+        return res;
+      }
 
-    m_lastFlush = dataIn.bytesLeft;
-    if(m_lastFlush > m_currentChunkSize) {
-      m_lastFlush = m_currentChunkSize;
     }
 
-    dataOut.set(dataIn.currBufferPtr, m_lastFlush);
-    return Error::FLUSH_DATA_OUT;
+  }
 
+  if(m_state != State::FINISHED) {
+    return ERROR_UNEXPECTED_END;
   }
 
-  m_chunkHeaderBuffer.setCurrentPosition(0);
   dataOut.set(nullptr, 0);
-  m_finished = true;
   return Error::FINISHED;
 
 }
 
+v_io_size DecoderChunked::getBodySize() {
+  return m_bodySize;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // ChunkedEncoderProvider
 
@@ -251,12 +377,17 @@ std::shared_ptr<data::buffer::Processor> ChunkedEncoderProvider::getProcessor()
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // ChunkedDecoderProvider
 
+ChunkedDecoderProvider::ChunkedDecoderProvider(v_buff_size maxLineSize, v_io_size maxBodySize)
+  : m_maxLineSize(maxLineSize)
+  , m_maxBodySize(maxBodySize)
+{}
+
 oatpp::String ChunkedDecoderProvider::getEncodingName() {
   return "chunked";
 }
 
 std::shared_ptr<data::buffer::Processor> ChunkedDecoderProvider::getProcessor() {
-  return std::make_shared<DecoderChunked>();
+  return std::make_shared<DecoderChunked>(m_maxLineSize, m_maxBodySize);
 }
 
 }}}}}
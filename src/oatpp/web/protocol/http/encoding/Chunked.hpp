@@ -31,13 +31,29 @@
 namespace oatpp { namespace web { namespace protocol { namespace http { namespace encoding {
 
 /**
- * Chunked-encoding buffer processor. &id:oatpp::data::buffer::Processor;.
+ * Chunked-encoding buffer processor. &id:oatpp::data::buffer::Processor;. <br>
+ * Chunk framing is written to the inline buffer - no allocations are made during encoding. <br>
+ * Small chunks (up to &l:EncoderChunked::SMALL_CHUNK_MAX_SIZE;) are copied to the inline buffer together with their framing,
+ * so that the whole chunk is flushed in one write.
+ * Larger chunks are flushed as the chunk header followed by the payload, and the chunk trailer is flushed with the next header.
  */
 class EncoderChunked : public data::buffer::Processor {
+public:
+  /**
+   * Max size of the chunk payload which is coalesced with its framing into a single write.
+   */
+  static constexpr v_buff_size SMALL_CHUNK_MAX_SIZE = 1024;
+private:
+  /*
+   * "\r\n" (trailer of the previous chunk) + hex size + "\r\n"
+   */
+  static constexpr v_buff_size HEADER_MAX_SIZE = 2 + 16 + 2;
+private:
+  static v_buff_size writeChunkHeader(p_char8 buffer, bool trailer, v_io_size chunkSize);
 private:
-  oatpp::String m_chunkHeader;
+  v_char8 m_buffer[HEADER_MAX_SIZE + SMALL_CHUNK_MAX_SIZE + 2];
   bool m_writeChunkHeader = true;
-  bool m_firstChunk = true;
+  bool m_pendingTrailer = false;
   bool m_finished = false;
   v_io_size m_lastFlush = 0;
 public:
@@ -61,25 +77,81 @@ public:
 };
 
 /**
- * Chunked-decoding buffer processor. &id:oatpp::data::buffer::Processor;.
+ * Chunked-decoding buffer processor. &id:oatpp::data::buffer::Processor;. <br>
+ * Chunk-size lines are located with `std::memchr` and parsed in place when the whole line is available in the input buffer.
+ * Chunk payload is passed to the output without copying. <br>
+ * Decoder never asks to read beyond the minimum remaining chunked framing, so it doesn't consume data following the body. <br>
+ * Chunk extensions and trailer fields are skipped.
  */
 class DecoderChunked : public data::buffer::Processor {
 public:
+  /**
+   * Chunk-size line (or trailer field line) exceeds the max line size.
+   */
   static constexpr v_int32 ERROR_CHUNK_HEADER_TOO_LONG = 100;
+
+  /**
+   * Malformed chunk-size line or missing CRLF after the chunk data.
+   */
+  static constexpr v_int32 ERROR_INVALID_CHUNK_HEADER = 101;
+
+  /**
+   * Total size of the decoded body exceeds the max body size.
+   */
+  static constexpr v_int32 ERROR_BODY_TOO_LARGE = 102;
+
+  /**
+   * Number of trailer fields exceeds &l:DecoderChunked::MAX_TRAILER_FIELDS;.
+   */
+  static constexpr v_int32 ERROR_TOO_MANY_TRAILER_FIELDS = 103;
+
+  /**
+   * Input ended before the last chunk and the trailer section were received.
+   */
+  static constexpr v_int32 ERROR_UNEXPECTED_END = 104;
+public:
+
+  /**
+   * Default max size of the chunk-size line including CRLF.
+   */
+  static constexpr v_buff_size DEFAULT_MAX_LINE_SIZE = 1024;
+
+  /**
+   * Max number of trailer fields accepted after the last chunk.
+   */
+  static constexpr v_int32 MAX_TRAILER_FIELDS = 64;
 private:
-  data::stream::BufferOutputStream m_chunkHeaderBuffer;
-  v_io_size m_currentChunkSize;
-  bool m_firstChunk;
-  bool m_finished;
-  v_io_size m_lastFlush;
+
+  enum class State : v_int32 {
+    CHUNK_HEADER,
+    CHUNK_DATA,
+    CHUNK_DATA_END,
+    TRAILER,
+    FINISHED
+  };
+
+private:
+  static bool parseChunkSize(p_char8 line, v_buff_size lineSize, v_io_size& chunkSize);
 private:
-  v_int32 readHeader(data::buffer::InlineReadData& dataIn);
+  v_int32 readLine(data::buffer::InlineReadData& dataIn, p_char8& line, v_buff_size& lineSize);
+  v_int32 onLine(p_char8 line, v_buff_size lineSize);
+private:
+  v_buff_size m_maxLineSize;
+  v_io_size m_maxBodySize;
+  std::string m_lineBuffer;
+  State m_state;
+  v_io_size m_chunkBytesLeft;
+  v_io_size m_bodySize;
+  v_io_size m_lastFlush;
+  v_int32 m_trailerFieldsCount;
 public:
 
   /**
    * Constructor.
+   * @param maxLineSize - max size of the chunk-size line (or trailer field line) including CRLF.
+   * @param maxBodySize - max total size of the decoded body. `-1` - no limit.
    */
-  DecoderChunked();
+  DecoderChunked(v_buff_size maxLineSize = DEFAULT_MAX_LINE_SIZE, v_io_size maxBodySize = -1);
 
   /**
    * If the client is using the input stream to read data and push it to the processor,
@@ -97,6 +169,12 @@ public:
    */
   v_int32 iterate(data::buffer::InlineReadData& dataIn, data::buffer::InlineReadData& dataOut) override;
 
+  /**
+   * Get total size of the body decoded so far.
+   * @return - size of the decoded body in bytes.
+   */
+  v_io_size getBodySize();
+
 };
 
 /**
@@ -123,8 +201,18 @@ public:
  * EncoderProvider for "chunked" decoding.
  */
 class ChunkedDecoderProvider : public EncoderProvider {
+private:
+  v_buff_size m_maxLineSize;
+  v_io_size m_maxBodySize;
 public:
 
+  /**
+   * Constructor.
+   * @param maxLineSize - max size of the chunk-size line (or trailer field line) including CRLF.
+   * @param maxBodySize - max total size of the decoded body. `-1` - no limit.
+   */
+  ChunkedDecoderProvider(v_buff_size maxLineSize = DecoderChunked::DEFAULT_MAX_LINE_SIZE, v_io_size maxBodySize = -1);
+
   /**
    * Get encoding name.
    * @return
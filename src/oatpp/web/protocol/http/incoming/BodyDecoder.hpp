@@ -48,7 +48,7 @@ private:
     Headers m_headers;
     std::shared_ptr<oatpp::data::stream::InputStream> m_bodyStream;
     std::shared_ptr<oatpp::data::mapping::ObjectMapper> m_objectMapper;
-    std::shared_ptr<oatpp::data::stream::ChunkedBuffer> m_outputStream;
+    std::shared_ptr<oatpp::data::mapping::ObjectMapper::Reader> m_reader;
   public:
     
     ToDtoDecoder(const BodyDecoder* decoder,
@@ -59,19 +59,17 @@ private:
       , m_headers(headers)
       , m_bodyStream(bodyStream)
       , m_objectMapper(objectMapper)
-      , m_outputStream(std::make_shared<oatpp::data::stream::ChunkedBuffer>())
+      , m_reader(objectMapper->createReader(Type::ObjectWrapper::Class::getType()))
     {}
     
     oatpp::async::Action act() override {
-      return m_decoder->decodeAsync(m_headers, m_bodyStream, m_outputStream).next(this->yieldTo(&ToDtoDecoder::onDecoded));
+      return m_decoder->decodeAsync(m_headers, m_bodyStream, m_reader).next(this->yieldTo(&ToDtoDecoder::onDecoded));
     }
     
     oatpp::async::Action onDecoded() {
-      auto body = m_outputStream->toString();
-      oatpp::parser::Caret caret(body);
-      auto dto = m_objectMapper->readFromCaret<Type>(caret);
-      if(caret.hasError()) {
-        return this->template error<oatpp::async::Error>(caret.getErrorMessage());
+      auto dto = m_reader->finish().template staticCast<typename Type::ObjectWrapper>();
+      if(m_reader->hasError()) {
+        return this->template error<oatpp::async::Error>(m_reader->getErrorMessage());
       }
       return this->_return(dto);
     }
@@ -117,7 +115,8 @@ public:
   }
 
   /**
-   * Read body stream, decode, and deserialize it as DTO Object (see [Data Transfer Object (DTO)](https://oatpp.io/docs/components/dto/)).
+   * Read body stream, decode, and deserialize it as DTO Object (see [Data Transfer Object (DTO)](https://oatpp.io/docs/components/dto/)). <br>
+   * Body is deserialized as it is read with reader created by &id:oatpp::data::mapping::ObjectMapper::createReader;.
    * @tparam Type - DTO object type.
    * @param headers - Headers map. &id:oatpp::web::protocol::http::Headers;.
    * @param bodyStream - pointer to &id:oatpp::data::stream::InputStream;.
@@ -128,7 +127,13 @@ public:
   typename Type::ObjectWrapper decodeToDto(const Headers& headers,
                                            data::stream::InputStream* bodyStream,
                                            data::mapping::ObjectMapper* objectMapper) const {
-    return objectMapper->readFromString<Type>(decodeToString(headers, bodyStream));
+    auto reader = objectMapper->createReader(Type::ObjectWrapper::Class::getType());
+    decode(headers, bodyStream, reader.get());
+    auto result = reader->finish().template staticCast<typename Type::ObjectWrapper>();
+    if(!result) {
+      throw oatpp::parser::ParsingError(reader->getErrorMessage(), reader->getErrorCode(), reader->getErrorPosition());
+    }
+    return result;
   }
 
   /**
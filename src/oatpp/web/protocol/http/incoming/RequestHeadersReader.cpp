@@ -33,6 +33,14 @@ v_io_size RequestHeadersReader::readHeadersSectionIterative(ReadHeadersIteration
                                                                   async::Action& action)
 {
 
+  if(m_bufferStream->getCurrentPosition() == 0) {
+    /* Don't acquire headers buffer until the first bytes of request arrive */
+    auto res = stream->prefetch(action);
+    if(res <= 0) {
+      return res;
+    }
+  }
+
   v_buff_size desiredToRead = m_readChunkSize;
   if(m_bufferStream->getCurrentPosition() + desiredToRead > m_maxHeadersSize) {
     desiredToRead = m_maxHeadersSize - m_bufferStream->getCurrentPosition();
@@ -31,8 +31,12 @@
 
 namespace oatpp { namespace web { namespace protocol { namespace http { namespace incoming {
 
-SimpleBodyDecoder::SimpleBodyDecoder(const std::shared_ptr<encoding::ProviderCollection>& contentDecoders)
+SimpleBodyDecoder::SimpleBodyDecoder(const std::shared_ptr<encoding::ProviderCollection>& contentDecoders,
+                                     v_buff_size chunkedLineMaxSize,
+                                     v_io_size chunkedBodyMaxSize)
   : m_contentDecoders(contentDecoders)
+  , m_chunkedLineMaxSize(chunkedLineMaxSize)
+  , m_chunkedBodyMaxSize(chunkedBodyMaxSize)
 {}
 
 base::ObjectHandle<data::buffer::Processor>
@@ -55,7 +59,7 @@ SimpleBodyDecoder::getStreamProcessor (const data::share::StringKeyLabelCI& tran
       throw std::runtime_error("[oatpp::web::protocol::http::incoming::SimpleBodyDecoder::getStreamProcessor()]: "
                                "Error. Unsupported Transfer-Encoding. '" + transferEncoding.std_str() + "'.");
     }
-    processors.push_back(std::make_shared<http::encoding::DecoderChunked>());
+    processors.push_back(std::make_shared<http::encoding::DecoderChunked>(m_chunkedLineMaxSize, m_chunkedBodyMaxSize));
   }
 
   if(contentEncoding) {
@@ -88,7 +92,7 @@ void SimpleBodyDecoder::decode(const Headers& headers,
     auto contentEncoding = headers.getAsMemoryLabel<data::share::StringKeyLabelCI>(Header::CONTENT_ENCODING);
     auto processor = getStreamProcessor(transferEncoding, contentEncoding);
 
-    data::buffer::IOBuffer buffer;
+    data::buffer::IOBuffer buffer(data::buffer::IOBuffer::selectSize(-1, processor->suggestInputStreamReadSize()));
     data::stream::transfer(bodyStream, writeCallback, 0 /* read until error */, buffer.getData(), buffer.getSize(), processor);
 
   } else {
@@ -103,7 +107,7 @@ void SimpleBodyDecoder::decode(const Headers& headers,
 
         auto contentEncoding = headers.getAsMemoryLabel<data::share::StringKeyLabelCI>(Header::CONTENT_ENCODING);
         auto processor = getStreamProcessor(nullptr, contentEncoding);
-        data::buffer::IOBuffer buffer;
+        data::buffer::IOBuffer buffer(data::buffer::IOBuffer::selectSize(contentLength, processor->suggestInputStreamReadSize()));
         data::stream::transfer(bodyStream, writeCallback, contentLength, buffer.getData(), buffer.getSize(), processor);
 
       }
@@ -116,7 +120,7 @@ void SimpleBodyDecoder::decode(const Headers& headers,
 
         auto contentEncoding = headers.getAsMemoryLabel<data::share::StringKeyLabelCI>(Header::CONTENT_ENCODING);
         auto processor = getStreamProcessor(nullptr, contentEncoding);
-        data::buffer::IOBuffer buffer;
+        data::buffer::IOBuffer buffer(data::buffer::IOBuffer::selectSize(-1, processor->suggestInputStreamReadSize()));
         data::stream::transfer(bodyStream, writeCallback,  0 /* read until error */, buffer.getData(), buffer.getSize(), processor);
 
       } else {
@@ -139,7 +143,7 @@ async::CoroutineStarter SimpleBodyDecoder::decodeAsync(const Headers& headers,
 
     auto contentEncoding = headers.getAsMemoryLabel<data::share::StringKeyLabelCI>(Header::CONTENT_ENCODING);
     auto processor = getStreamProcessor(transferEncoding, contentEncoding);
-    auto buffer = data::buffer::IOBuffer::createShared();
+    auto buffer = data::buffer::IOBuffer::createShared(data::buffer::IOBuffer::selectSize(-1, processor->suggestInputStreamReadSize()));
     return data::stream::transferAsync(bodyStream, writeCallback, 0 /* read until error */, buffer, processor);
 
   } else {
@@ -154,7 +158,7 @@ async::CoroutineStarter SimpleBodyDecoder::decodeAsync(const Headers& headers,
 
         auto contentEncoding = headers.getAsMemoryLabel<data::share::StringKeyLabelCI>(Header::CONTENT_ENCODING);
         auto processor = getStreamProcessor(nullptr, contentEncoding);
-        auto buffer = data::buffer::IOBuffer::createShared();
+        auto buffer = data::buffer::IOBuffer::createShared(data::buffer::IOBuffer::selectSize(contentLength, processor->suggestInputStreamReadSize()));
         return data::stream::transferAsync(bodyStream, writeCallback, contentLength, buffer, processor);
 
       }
@@ -167,7 +171,7 @@ async::CoroutineStarter SimpleBodyDecoder::decodeAsync(const Headers& headers,
 
         auto contentEncoding = headers.getAsMemoryLabel<data::share::StringKeyLabelCI>(Header::CONTENT_ENCODING);
         auto processor = getStreamProcessor(nullptr, contentEncoding);
-        auto buffer = data::buffer::IOBuffer::createShared();
+        auto buffer = data::buffer::IOBuffer::createShared(data::buffer::IOBuffer::selectSize(-1, processor->suggestInputStreamReadSize()));
         return data::stream::transferAsync(bodyStream, writeCallback,  0 /* read until error */, buffer, processor);
 
       }
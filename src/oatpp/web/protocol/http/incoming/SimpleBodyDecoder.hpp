@@ -27,6 +27,7 @@
 
 #include "BodyDecoder.hpp"
 #include "oatpp/web/protocol/http/encoding/ProviderCollection.hpp"
+#include "oatpp/web/protocol/http/encoding/Chunked.hpp"
 
 namespace oatpp { namespace web { namespace protocol { namespace http { namespace incoming {
 
@@ -36,6 +37,8 @@ namespace oatpp { namespace web { namespace protocol { namespace http { namespac
 class SimpleBodyDecoder : public BodyDecoder {
 private:
   std::shared_ptr<encoding::ProviderCollection> m_contentDecoders;
+  v_buff_size m_chunkedLineMaxSize;
+  v_io_size m_chunkedBodyMaxSize;
 private:
   base::ObjectHandle<data::buffer::Processor> getStreamProcessor(const data::share::StringKeyLabelCI& transferEncoding,
                                                                  const data::share::StringKeyLabelCI& contentEncoding) const;
@@ -44,8 +47,12 @@ public:
   /**
    * Constructor.
    * @param decoders - collection content decoders.
+   * @param chunkedLineMaxSize - max size of the chunk-size line for `Transfer-Encoding: chunked` bodies.
+   * @param chunkedBodyMaxSize - max decoded size of `Transfer-Encoding: chunked` bodies. `-1` - no limit.
    */
-  SimpleBodyDecoder(const std::shared_ptr<encoding::ProviderCollection>& contentDecoders = nullptr);
+  SimpleBodyDecoder(const std::shared_ptr<encoding::ProviderCollection>& contentDecoders = nullptr,
+                    v_buff_size chunkedLineMaxSize = encoding::DecoderChunked::DEFAULT_MAX_LINE_SIZE,
+                    v_io_size chunkedBodyMaxSize = -1);
 
   /**
    * Decode bodyStream and write decoded data to toStream.
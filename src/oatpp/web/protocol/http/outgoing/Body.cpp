@@ -23,3 +23,11 @@
  ***************************************************************************/
 
 #include "Body.hpp"
+
+namespace oatpp { namespace web { namespace protocol { namespace http { namespace outgoing {
+
+const data::buffer::BufferChain* Body::getKnownChain() {
+  return nullptr;
+}
+
+}}}}}
@@ -27,6 +27,7 @@
 
 #include "oatpp/web/protocol/http/Http.hpp"
 
+#include "oatpp/core/data/buffer/BufferChain.hpp"
 #include "oatpp/core/data/stream/Stream.hpp"
 #include "oatpp/core/collection/ListMap.hpp"
 #include "oatpp/core/async/Coroutine.hpp"
@@ -71,6 +72,16 @@ public:
    * @return - &id:oatpp::v_io_size;.
    */
   virtual v_buff_size getKnownSize() = 0;
+
+  /**
+   * Body known data as a chain of refcounted memory slices.
+   * If not `nullptr`, then a body which doesn't fit the headers buffer is written to the connection slice by slice without copying.
+   * Connections implementing &id:oatpp::data::buffer::SliceOutput; may adopt the slices by reference. <br>
+   * Bodies with non-contiguous data return `nullptr` from &l:Body::getKnownData ();. <br>
+   * Default implementation returns `nullptr`.
+   * @return - pointer to &id:oatpp::data::buffer::BufferChain; or `nullptr`.
+   */
+  virtual const data::buffer::BufferChain* getKnownChain();
   
 };
   
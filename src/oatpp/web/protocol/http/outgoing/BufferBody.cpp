@@ -73,4 +73,12 @@ v_buff_size BufferBody::getKnownSize() {
   return m_buffer->getSize();
 }
 
+const data::buffer::BufferChain* BufferBody::getKnownChain() {
+  if(!m_chain) {
+    m_chain.reset(new data::buffer::BufferChain());
+    m_chain->append(m_buffer);
+  }
+  return m_chain.get();
+}
+
 }}}}}
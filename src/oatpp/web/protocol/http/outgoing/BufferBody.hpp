@@ -42,6 +42,7 @@ private:
   oatpp::String m_buffer;
   oatpp::data::share::StringKeyLabel m_contentType;
   data::buffer::InlineReadData m_inlineData;
+  std::unique_ptr<data::buffer::BufferChain> m_chain;
 public:
   BufferBody(const oatpp::String& buffer, const data::share::StringKeyLabel& contentType);
 public:
@@ -82,6 +83,12 @@ public:
    * @return - `v_buff_size`.
    */
   v_buff_size getKnownSize() override;
+
+  /**
+   * Get body buffer as a single-slice chain, referencing the buffer. Chain is created on the first call.
+   * @return - pointer to &id:oatpp::data::buffer::BufferChain;.
+   */
+  const data::buffer::BufferChain* getKnownChain() override;
   
 };
   
@@ -0,0 +1,91 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "BufferChainBody.hpp"
+
+namespace oatpp { namespace web { namespace protocol { namespace http { namespace outgoing {
+
+BufferChainBody::BufferChainBody(const std::shared_ptr<data::buffer::BufferChain>& chain, const data::share::StringKeyLabel& contentType)
+  : m_chain(chain)
+  , m_contentType(contentType)
+  , m_sliceIndex(0)
+  , m_sliceOffset(0)
+{}
+
+std::shared_ptr<BufferChainBody> BufferChainBody::createShared(const std::shared_ptr<data::buffer::BufferChain>& chain,
+                                                               const data::share::StringKeyLabel& contentType)
+{
+  return Shared_Http_Outgoing_BufferChainBody_Pool::allocateShared(chain, contentType);
+}
+
+v_io_size BufferChainBody::read(void *buffer, v_buff_size count, async::Action& action) {
+
+  (void) action;
+
+  const auto& slices = m_chain->getSlices();
+  v_buff_size result = 0;
+
+  while(result < count && m_sliceIndex < (v_buff_size) slices.size()) {
+
+    const auto& slice = slices[m_sliceIndex];
+
+    v_buff_size size = slice.size - m_sliceOffset;
+    if(size > count - result) {
+      size = count - result;
+    }
+
+    std::memcpy((p_char8) buffer + result, slice.data + m_sliceOffset, size);
+    result += size;
+    m_sliceOffset += size;
+
+    if(m_sliceOffset == slice.size) {
+      m_sliceOffset = 0;
+      ++ m_sliceIndex;
+    }
+
+  }
+
+  return result;
+
+}
+
+void BufferChainBody::declareHeaders(Headers& headers) {
+  if(m_contentType) {
+    headers.put(Header::CONTENT_TYPE, m_contentType);
+  }
+}
+
+p_char8 BufferChainBody::getKnownData() {
+  return nullptr;
+}
+
+v_buff_size BufferChainBody::getKnownSize() {
+  return m_chain->getSize();
+}
+
+const data::buffer::BufferChain* BufferChainBody::getKnownChain() {
+  return m_chain.get();
+}
+
+}}}}}
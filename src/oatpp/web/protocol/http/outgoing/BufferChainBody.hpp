@@ -0,0 +1,98 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_web_protocol_http_outgoing_BufferChainBody_hpp
+#define oatpp_web_protocol_http_outgoing_BufferChainBody_hpp
+
+#include "./Body.hpp"
+#include "oatpp/web/protocol/http/Http.hpp"
+
+namespace oatpp { namespace web { namespace protocol { namespace http { namespace outgoing {
+
+/**
+ * Implementation of &id:oatpp::web::protocol::http::outgoing::Body; class.
+ * Implements functionality to use &id:oatpp::data::buffer::BufferChain; as data source for http body. <br>
+ * When body is sent with known size, slices of the chain are written to the connection without copying.
+ */
+class BufferChainBody : public oatpp::base::Countable, public Body {
+public:
+  OBJECT_POOL(Http_Outgoing_BufferChainBody_Pool, BufferChainBody, 32)
+  SHARED_OBJECT_POOL(Shared_Http_Outgoing_BufferChainBody_Pool, BufferChainBody, 32)
+private:
+  std::shared_ptr<data::buffer::BufferChain> m_chain;
+  oatpp::data::share::StringKeyLabel m_contentType;
+  v_buff_size m_sliceIndex;
+  v_buff_size m_sliceOffset;
+public:
+  BufferChainBody(const std::shared_ptr<data::buffer::BufferChain>& chain, const data::share::StringKeyLabel& contentType);
+public:
+
+  /**
+   * Create shared BufferChainBody.
+   * @param chain - &id:oatpp::data::buffer::BufferChain;. *Chain must not be modified while body is in use.*
+   * @param contentType - type of the content.
+   * @return - `std::shared_ptr` to BufferChainBody.
+   */
+  static std::shared_ptr<BufferChainBody> createShared(const std::shared_ptr<data::buffer::BufferChain>& chain,
+                                                       const data::share::StringKeyLabel& contentType = data::share::StringKeyLabel());
+
+  /**
+   * Read operation callback.
+   * @param buffer - pointer to buffer.
+   * @param count - size of the buffer in bytes.
+   * @param action - async specific action. If action is NOT &id:oatpp::async::Action::TYPE_NONE;, then
+   * caller MUST return this action on coroutine iteration.
+   * @return - actual number of bytes written to buffer. 0 - to indicate end-of-file.
+   */
+  v_io_size read(void *buffer, v_buff_size count, async::Action& action) override;
+
+  /**
+   * Declare `Content-Type` header.
+   * @param headers - &id:oatpp::web::protocol::http::Headers;.
+   */
+  void declareHeaders(Headers& headers) override;
+
+  /**
+   * Pointer to the body known data. Chain data is not contiguous.
+   * @return - `nullptr`.
+   */
+  p_char8 getKnownData() override;
+
+  /**
+   * Return known size of the body.
+   * @return - `v_buff_size`.
+   */
+  v_buff_size getKnownSize() override;
+
+  /**
+   * Get body chain.
+   * @return - pointer to &id:oatpp::data::buffer::BufferChain;.
+   */
+  const data::buffer::BufferChain* getKnownChain() override;
+
+};
+
+}}}}}
+
+#endif /* oatpp_web_protocol_http_outgoing_BufferChainBody_hpp */
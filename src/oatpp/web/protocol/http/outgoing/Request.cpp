@@ -110,11 +110,23 @@ void Request::send(data::stream::OutputStream* stream){
     if(bodySize >= 0) {
 
       if(bodySize + buffer.getCurrentPosition() < buffer.getCapacity()) {
-        buffer.writeSimple(m_body->getKnownData(), bodySize);
+        auto data = m_body->getKnownData();
+        if(data) {
+          buffer.writeSimple(data, bodySize);
+        } else if(m_body->getKnownChain() != nullptr) {
+          for(const auto& slice : m_body->getKnownChain()->getSlices()) {
+            buffer.writeSimple(slice.data, slice.size);
+          }
+        }
         buffer.flushToStream(stream);
       } else {
         buffer.flushToStream(stream);
-        stream->writeExactSizeDataSimple(m_body->getKnownData(), bodySize);
+        auto chain = m_body->getKnownChain();
+        if(chain) {
+          chain->flushToStream(stream);
+        } else {
+          stream->writeExactSizeDataSimple(m_body->getKnownData(), bodySize);
+        }
       }
 
     } else {
@@ -123,9 +135,8 @@ void Request::send(data::stream::OutputStream* stream){
 
       http::encoding::EncoderChunked chunkedEncoder;
 
-      /* Reuse headers buffer */
-      buffer.setCurrentPosition(0);
-      data::stream::transfer(m_body, stream, 0, buffer.getData(), buffer.getCapacity(), &chunkedEncoder);
+      data::buffer::IOBuffer transferBuffer(data::buffer::IOBuffer::selectSize(-1, chunkedEncoder.suggestInputStreamReadSize()));
+      data::stream::transfer(m_body, stream, 0, transferBuffer.getData(), transferBuffer.getSize(), &chunkedEncoder);
 
     }
 
@@ -190,21 +201,35 @@ oatpp::async::CoroutineStarter Request::sendAsync(std::shared_ptr<Request> _this
 
           if(bodySize + m_headersWriteBuffer->getCurrentPosition() < m_headersWriteBuffer->getCapacity()) {
 
-            m_headersWriteBuffer->writeSimple(m_this->m_body->getKnownData(), bodySize);
+            auto data = m_this->m_body->getKnownData();
+            if(data) {
+              m_headersWriteBuffer->writeSimple(data, bodySize);
+            } else if(m_this->m_body->getKnownChain() != nullptr) {
+              for(const auto& slice : m_this->m_body->getKnownChain()->getSlices()) {
+                m_headersWriteBuffer->writeSimple(slice.data, slice.size);
+              }
+            }
             return oatpp::data::stream::BufferOutputStream::flushToStreamAsync(m_headersWriteBuffer, m_stream)
               .next(finish());
-          } else {
+          }
 
+          auto chain = m_this->m_body->getKnownChain();
+          if(chain) {
             return oatpp::data::stream::BufferOutputStream::flushToStreamAsync(m_headersWriteBuffer, m_stream)
-              .next(m_stream->writeExactSizeDataAsync(m_this->m_body->getKnownData(), bodySize))
+              .next(chain->flushToStreamAsync(m_stream))
               .next(finish());
           }
 
+          return oatpp::data::stream::BufferOutputStream::flushToStreamAsync(m_headersWriteBuffer, m_stream)
+            .next(m_stream->writeExactSizeDataAsync(m_this->m_body->getKnownData(), bodySize))
+            .next(finish());
+
         } else {
 
           auto chunkedEncoder = std::make_shared<http::encoding::EncoderChunked>();
+          auto buffer = data::buffer::IOBuffer::createShared(data::buffer::IOBuffer::selectSize(-1, chunkedEncoder->suggestInputStreamReadSize()));
           return oatpp::data::stream::BufferOutputStream::flushToStreamAsync(m_headersWriteBuffer, m_stream)
-                 .next(data::stream::transferAsync(m_this->m_body, m_stream, 0, data::buffer::IOBuffer::createShared(), chunkedEncoder))
+                 .next(data::stream::transferAsync(m_this->m_body, m_stream, 0, buffer, chunkedEncoder))
                  .next(finish());
 
         }
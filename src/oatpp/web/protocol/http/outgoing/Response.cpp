@@ -25,6 +25,7 @@
 #include "./Response.hpp"
 
 #include "oatpp/web/protocol/http/encoding/Chunked.hpp"
+#include "oatpp/core/data/buffer/IOBuffer.hpp"
 #include "oatpp/core/utils/ConversionUtils.hpp"
 
 namespace oatpp { namespace web { namespace protocol { namespace http { namespace outgoing {
@@ -125,11 +126,23 @@ void Response::send(data::stream::OutputStream* stream,
       if (bodySize >= 0) {
 
         if (bodySize + headersWriteBuffer->getCurrentPosition() < headersWriteBuffer->getCapacity()) {
-          headersWriteBuffer->writeSimple(m_body->getKnownData(), bodySize);
+          auto data = m_body->getKnownData();
+          if(data) {
+            headersWriteBuffer->writeSimple(data, bodySize);
+          } else if(m_body->getKnownChain() != nullptr) {
+            for(const auto& slice : m_body->getKnownChain()->getSlices()) {
+              headersWriteBuffer->writeSimple(slice.data, slice.size);
+            }
+          }
           headersWriteBuffer->flushToStream(stream);
         } else {
           headersWriteBuffer->flushToStream(stream);
-          stream->writeExactSizeDataSimple(m_body->getKnownData(), bodySize);
+          auto chain = m_body->getKnownChain();
+          if(chain) {
+            chain->flushToStream(stream);
+          } else {
+            stream->writeExactSizeDataSimple(m_body->getKnownData(), bodySize);
+          }
         }
 
       } else {
@@ -138,8 +151,8 @@ void Response::send(data::stream::OutputStream* stream,
 
         http::encoding::EncoderChunked chunkedEncoder;
 
-        /* Reuse headers buffer */
-        data::stream::transfer(m_body, stream, 0, headersWriteBuffer->getData(), headersWriteBuffer->getCapacity(), &chunkedEncoder);
+        data::buffer::IOBuffer buffer(data::buffer::IOBuffer::selectSize(-1, chunkedEncoder.suggestInputStreamReadSize()));
+        data::stream::transfer(m_body, stream, 0, buffer.getData(), buffer.getSize(), &chunkedEncoder);
 
       }
 
@@ -155,8 +168,8 @@ void Response::send(data::stream::OutputStream* stream,
         &chunkedEncoder
       });
 
-      /* Reuse headers buffer */
-      data::stream::transfer(m_body, stream, 0, headersWriteBuffer->getData(), headersWriteBuffer->getCapacity(), &pipeline);
+      data::buffer::IOBuffer buffer(data::buffer::IOBuffer::selectSize(m_body->getKnownSize(), pipeline.suggestInputStreamReadSize()));
+      data::stream::transfer(m_body, stream, 0, buffer.getData(), buffer.getSize(), &pipeline);
 
     }
 
@@ -237,22 +250,36 @@ oatpp::async::CoroutineStarter Response::sendAsync(const std::shared_ptr<Respons
 
             if (bodySize + m_headersWriteBuffer->getCurrentPosition() < m_headersWriteBuffer->getCapacity()) {
 
-              m_headersWriteBuffer->writeSimple(m_this->m_body->getKnownData(), bodySize);
+              auto data = m_this->m_body->getKnownData();
+              if(data) {
+                m_headersWriteBuffer->writeSimple(data, bodySize);
+              } else if(m_this->m_body->getKnownChain() != nullptr) {
+                for(const auto& slice : m_this->m_body->getKnownChain()->getSlices()) {
+                  m_headersWriteBuffer->writeSimple(slice.data, slice.size);
+                }
+              }
               return oatpp::data::stream::BufferOutputStream::flushToStreamAsync(m_headersWriteBuffer, m_stream)
                 .next(finish());
 
-            } else {
+            }
 
+            auto chain = m_this->m_body->getKnownChain();
+            if(chain) {
               return oatpp::data::stream::BufferOutputStream::flushToStreamAsync(m_headersWriteBuffer, m_stream)
-                .next(m_stream->writeExactSizeDataAsync(m_this->m_body->getKnownData(), bodySize))
+                .next(chain->flushToStreamAsync(m_stream))
                 .next(finish());
             }
 
+            return oatpp::data::stream::BufferOutputStream::flushToStreamAsync(m_headersWriteBuffer, m_stream)
+              .next(m_stream->writeExactSizeDataAsync(m_this->m_body->getKnownData(), bodySize))
+              .next(finish());
+
           } else {
 
             auto chunkedEncoder = std::make_shared<http::encoding::EncoderChunked>();
+            auto buffer = data::buffer::IOBuffer::createShared(data::buffer::IOBuffer::selectSize(-1, chunkedEncoder->suggestInputStreamReadSize()));
             return oatpp::data::stream::BufferOutputStream::flushToStreamAsync(m_headersWriteBuffer, m_stream)
-              .next(data::stream::transferAsync(m_this->m_body, m_stream, 0, data::buffer::IOBuffer::createShared(), chunkedEncoder))
+              .next(data::stream::transferAsync(m_this->m_body, m_stream, 0, buffer, chunkedEncoder))
               .next(finish());
 
           }
@@ -267,8 +294,9 @@ oatpp::async::CoroutineStarter Response::sendAsync(const std::shared_ptr<Respons
             chunkedEncoder
           }));
 
+          auto buffer = data::buffer::IOBuffer::createShared(data::buffer::IOBuffer::selectSize(m_this->m_body->getKnownSize(), pipeline->suggestInputStreamReadSize()));
           return oatpp::data::stream::BufferOutputStream::flushToStreamAsync(m_headersWriteBuffer, m_stream)
-            .next(data::stream::transferAsync(m_this->m_body, m_stream, 0, data::buffer::IOBuffer::createShared(), pipeline)
+            .next(data::stream::transferAsync(m_this->m_body, m_stream, 0, buffer, pipeline)
             . next(finish()));
 
         }
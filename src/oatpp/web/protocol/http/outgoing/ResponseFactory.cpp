@@ -25,6 +25,7 @@
 #include "./ResponseFactory.hpp"
 
 #include "./BufferBody.hpp"
+#include "./StreamingBody.hpp"
 
 namespace oatpp { namespace web { namespace protocol { namespace http { namespace outgoing {
   
@@ -43,5 +44,14 @@ ResponseFactory::createResponse(const Status& status,
   ));
 }
 
+std::shared_ptr<Response>
+ResponseFactory::createStreamingResponse(const Status& status,
+                                         const oatpp::Void& dto,
+                                         const std::shared_ptr<data::mapping::ObjectMapper>& objectMapper) {
+  auto response = Response::createShared(status, std::make_shared<StreamingBody>(objectMapper->createWriter(dto)));
+  response->putHeader(Header::CONTENT_TYPE, objectMapper->getInfo().http_content_type);
+  return response;
+}
+
   
 }}}}}
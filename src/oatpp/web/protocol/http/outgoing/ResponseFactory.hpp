@@ -57,6 +57,20 @@ public:
   static std::shared_ptr<Response> createResponse(const Status& status,
                                                   const oatpp::Void& dto,
                                                   const std::shared_ptr<data::mapping::ObjectMapper>& objectMapper);
+
+  /**
+   * Create &id:oatpp::web::protocol::http::outgoing::Response; with &id:oatpp::web::protocol::http::outgoing::StreamingBody;. <br>
+   * DTO is serialized on demand as the body is written to the connection using writer created by
+   * &id:oatpp::data::mapping::ObjectMapper::createWriter;. Body is sent with chunked transfer encoding. <br>
+   * *DTO must not be modified until the response is sent.*
+   * @param status - &id:oatpp::web::protocol::http::Status;.
+   * @param dto - see [Data Transfer Object (DTO)](https://oatpp.io/docs/components/dto/).
+   * @param objectMapper - &id:oatpp::data::mapping::ObjectMapper;.
+   * @return - `std::shared_ptr` to &id:oatpp::web::protocol::http::outgoing::Response;.
+   */
+  static std::shared_ptr<Response> createStreamingResponse(const Status& status,
+                                                           const oatpp::Void& dto,
+                                                           const std::shared_ptr<data::mapping::ObjectMapper>& objectMapper);
   
 };
   
@@ -57,7 +57,9 @@ HttpProcessor::Components::Components(const std::shared_ptr<HttpRouter>& pRouter
 HttpProcessor::Components::Components(const std::shared_ptr<HttpRouter>& pRouter, const std::shared_ptr<Config>& pConfig)
   : Components(pRouter,
                nullptr,
-               std::make_shared<oatpp::web::protocol::http::incoming::SimpleBodyDecoder>(),
+               std::make_shared<oatpp::web::protocol::http::incoming::SimpleBodyDecoder>(nullptr,
+                                                                                    pConfig->chunkedLineMaxSize,
+                                                                                    pConfig->chunkedBodyMaxSize),
                handler::DefaultErrorHandler::createShared(),
                std::make_shared<RequestInterceptors>(),
                pConfig)
@@ -73,7 +75,7 @@ HttpProcessor::ProcessingResources::ProcessingResources(const std::shared_ptr<Co
   , headersInBuffer(components->config->headersInBufferInitial, components->config->headersInBufferGrow)
   , headersOutBuffer(components->config->headersOutBufferInitial, components->config->headersOutBufferGrow)
   , headersReader(&headersInBuffer, components->config->headersReaderChunkSize, components->config->headersReaderMaxSize)
-  , inStream(data::stream::InputStreamBufferedProxy::createShared(connection, base::StrBuffer::createShared(data::buffer::IOBuffer::BUFFER_SIZE)))
+  , inStream(data::stream::InputStreamBufferedProxy::createShared(connection, components->config->inBufferInitial, components->config->inBufferMax))
 {}
 
 bool HttpProcessor::processNextRequest(ProcessingResources& resources) {
@@ -151,7 +153,13 @@ bool HttpProcessor::processNextRequest(ProcessingResources& resources) {
 
   switch(connectionState) {
 
-    case protocol::http::utils::CommunicationUtils::CONNECTION_STATE_KEEP_ALIVE: return true;
+    case protocol::http::utils::CommunicationUtils::CONNECTION_STATE_KEEP_ALIVE: {
+      if(resources.components->config->releaseBuffersOnIdle) {
+        resources.headersInBuffer.releaseBuffer();
+        resources.headersOutBuffer.releaseBuffer();
+      }
+      return true;
+    }
 
     case protocol::http::utils::CommunicationUtils::CONNECTION_STATE_UPGRADE: {
 
@@ -213,7 +221,7 @@ HttpProcessor::Coroutine::Coroutine(const std::shared_ptr<Components>& component
   , m_headersInBuffer(components->config->headersInBufferInitial, components->config->headersInBufferGrow)
   , m_headersReader(&m_headersInBuffer, components->config->headersReaderChunkSize, components->config->headersReaderMaxSize)
   , m_headersOutBuffer(std::make_shared<oatpp::data::stream::BufferOutputStream>(components->config->headersOutBufferInitial, components->config->headersOutBufferGrow))
-  , m_inStream(data::stream::InputStreamBufferedProxy::createShared(m_connection, base::StrBuffer::createShared(data::buffer::IOBuffer::BUFFER_SIZE)))
+  , m_inStream(data::stream::InputStreamBufferedProxy::createShared(m_connection, components->config->inBufferInitial, components->config->inBufferMax))
   , m_connectionState(oatpp::web::protocol::http::utils::CommunicationUtils::CONNECTION_STATE_KEEP_ALIVE)
 {}
 
@@ -279,6 +287,11 @@ HttpProcessor::Coroutine::Action HttpProcessor::Coroutine::onResponseFormed() {
 HttpProcessor::Coroutine::Action HttpProcessor::Coroutine::onRequestDone() {
   
   if(m_connectionState == oatpp::web::protocol::http::utils::CommunicationUtils::CONNECTION_STATE_KEEP_ALIVE) {
+    if(m_components->config->releaseBuffersOnIdle) {
+      m_currentRequest.reset();
+      m_headersInBuffer.releaseBuffer();
+      m_headersOutBuffer->releaseBuffer();
+    }
     return yieldTo(&HttpProcessor::Coroutine::parseHeaders);
   }
   
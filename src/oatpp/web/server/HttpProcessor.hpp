@@ -31,6 +31,7 @@
 #include "./handler/ErrorHandler.hpp"
 
 #include "oatpp/web/protocol/http/encoding/ProviderCollection.hpp"
+#include "oatpp/web/protocol/http/encoding/Chunked.hpp"
 
 #include "oatpp/web/protocol/http/incoming/RequestHeadersReader.hpp"
 #include "oatpp/web/protocol/http/incoming/Request.hpp"
@@ -87,6 +88,33 @@ public:
      */
     v_buff_size headersReaderMaxSize = 4096;
 
+    /**
+     * Initial size of the connection read-ahead buffer. <br>
+     * The buffer is leased only while it holds unread data. See &id:oatpp::data::stream::InputStreamBufferedProxy;.
+     */
+    v_buff_size inBufferInitial = 2048;
+
+    /**
+     * Maximum size the connection read-ahead buffer may grow to for connections streaming large bodies.
+     */
+    v_buff_size inBufferMax = 64 * 1024;
+
+    /**
+     * Return headers buffers to the pool after each response of keep-alive connection. <br>
+     * Buffers are acquired again when the first bytes of the next request arrive.
+     */
+    bool releaseBuffersOnIdle = true;
+
+    /**
+     * Maximum allowed size of the chunk-size line in `Transfer-Encoding: chunked` request body.
+     */
+    v_buff_size chunkedLineMaxSize = protocol::http::encoding::DecoderChunked::DEFAULT_MAX_LINE_SIZE;
+
+    /**
+     * Maximum allowed decoded size of `Transfer-Encoding: chunked` request body. `-1` - no limit.
+     */
+    v_io_size chunkedBodyMaxSize = -1;
+
   };
 
 public:
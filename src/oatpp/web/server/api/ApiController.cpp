@@ -105,4 +105,15 @@ std::shared_ptr<ApiController::OutgoingResponse> ApiController::createDtoRespons
   return ResponseFactory::createResponse(status, dto, m_defaultObjectMapper);
 }
 
+std::shared_ptr<ApiController::OutgoingResponse> ApiController::createDtoStreamingResponse(const Status& status,
+                                                                                           const oatpp::Void& dto,
+                                                                                           const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& objectMapper) const {
+  return ResponseFactory::createStreamingResponse(status, dto, objectMapper);
+}
+
+std::shared_ptr<ApiController::OutgoingResponse> ApiController::createDtoStreamingResponse(const Status& status,
+                                                                                           const oatpp::Void& dto) const {
+  return ResponseFactory::createStreamingResponse(status, dto, m_defaultObjectMapper);
+}
+
 }}}}
@@ -450,6 +450,13 @@ public:
   std::shared_ptr<OutgoingResponse> createDtoResponse(const Status& status,
                                                       const oatpp::Void& dto) const;
 
+  std::shared_ptr<OutgoingResponse> createDtoStreamingResponse(const Status& status,
+                                                               const oatpp::Void& dto,
+                                                               const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& objectMapper) const;
+
+  std::shared_ptr<OutgoingResponse> createDtoStreamingResponse(const Status& status,
+                                                               const oatpp::Void& dto) const;
+
 public:
 
   template<typename T>
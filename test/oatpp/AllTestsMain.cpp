@@ -23,14 +23,22 @@
 
 #include "oatpp/core/data/stream/BufferStreamTest.hpp"
 #include "oatpp/core/data/stream/ChunkedBufferTest.hpp"
+#include "oatpp/core/data/stream/StreamBufferedProxyTest.hpp"
 #include "oatpp/core/data/share/LazyStringMapTest.hpp"
 #include "oatpp/core/data/share/MemoryLabelTest.hpp"
 #include "oatpp/core/data/buffer/ProcessorTest.hpp"
+#include "oatpp/core/data/buffer/BufferChainTest.hpp"
+#include "oatpp/core/data/buffer/IOBufferTest.hpp"
+
+#include "oatpp/parser/cbor/mapping/ObjectMapperTest.hpp"
 
 #include "oatpp/parser/json/mapping/DeserializerTest.hpp"
 #include "oatpp/parser/json/mapping/DTOMapperPerfTest.hpp"
 #include "oatpp/parser/json/mapping/DTOMapperTest.hpp"
 #include "oatpp/parser/json/mapping/EnumTest.hpp"
+#include "oatpp/parser/json/mapping/JsonValueTest.hpp"
+#include "oatpp/parser/json/mapping/PullSerializerTest.hpp"
+#include "oatpp/parser/json/mapping/PushDeserializerTest.hpp"
 #include "oatpp/parser/json/mapping/UnorderedSetTest.hpp"
 
 #include "oatpp/encoding/UnicodeTest.hpp"
@@ -40,6 +48,8 @@
 
 #include "oatpp/core/parser/CaretTest.hpp"
 
+#include "oatpp/core/utils/ConversionUtilsTest.hpp"
+
 #include "oatpp/core/data/mapping/type/UnorderedMapTest.hpp"
 #include "oatpp/core/data/mapping/type/PairListTest.hpp"
 #include "oatpp/core/data/mapping/type/VectorTest.hpp"
@@ -89,9 +99,12 @@ void runTests() {
   OATPP_RUN_TEST(oatpp::test::core::data::share::LazyStringMapTest);
 
   OATPP_RUN_TEST(oatpp::test::core::data::buffer::ProcessorTest);
+  OATPP_RUN_TEST(oatpp::test::core::data::buffer::BufferChainTest);
+  OATPP_RUN_TEST(oatpp::test::core::data::buffer::IOBufferTest);
 
   OATPP_RUN_TEST(oatpp::test::core::data::stream::ChunkedBufferTest);
   OATPP_RUN_TEST(oatpp::test::core::data::stream::BufferStreamTest);
+  OATPP_RUN_TEST(oatpp::test::core::data::stream::StreamBufferedProxyTest);
 
   OATPP_RUN_TEST(oatpp::test::core::data::mapping::type::ObjectWrapperTest);
   OATPP_RUN_TEST(oatpp::test::core::data::mapping::type::TypeTest);
@@ -111,14 +124,21 @@ void runTests() {
 
   OATPP_RUN_TEST(oatpp::test::parser::CaretTest);
 
+  OATPP_RUN_TEST(oatpp::test::core::utils::ConversionUtilsTest);
+
   OATPP_RUN_TEST(oatpp::test::parser::json::mapping::EnumTest);
 
   OATPP_RUN_TEST(oatpp::test::parser::json::mapping::UnorderedSetTest);
 
   OATPP_RUN_TEST(oatpp::test::parser::json::mapping::DeserializerTest);
+  OATPP_RUN_TEST(oatpp::test::parser::json::mapping::PushDeserializerTest);
+  OATPP_RUN_TEST(oatpp::test::parser::json::mapping::PullSerializerTest);
+  OATPP_RUN_TEST(oatpp::test::parser::json::mapping::JsonValueTest);
   OATPP_RUN_TEST(oatpp::test::parser::json::mapping::DTOMapperPerfTest);
   OATPP_RUN_TEST(oatpp::test::parser::json::mapping::DTOMapperTest);
 
+  OATPP_RUN_TEST(oatpp::test::parser::cbor::mapping::ObjectMapperTest);
+
   OATPP_RUN_TEST(oatpp::test::encoding::Base64Test);
   OATPP_RUN_TEST(oatpp::test::encoding::UnicodeTest);
 
@@ -162,6 +182,9 @@ void runTests() {
     oatpp::test::web::FullTest test_virtual(0, 1000);
     test_virtual.run();
 
+    oatpp::test::web::FullTest test_virtual_zero_copy(0, 1000, true);
+    test_virtual_zero_copy.run();
+
     oatpp::test::web::FullTest test_port(8000, 10);
     test_port.run();
 
@@ -172,6 +195,9 @@ void runTests() {
     oatpp::test::web::FullAsyncTest test_virtual(0, 1000);
     test_virtual.run();
 
+    oatpp::test::web::FullAsyncTest test_virtual_zero_copy(0, 1000, true);
+    test_virtual_zero_copy.run();
+
     oatpp::test::web::FullAsyncTest test_port(8000, 10);
     test_port.run();
 
@@ -25,8 +25,13 @@
 #include "MemoryPoolTest.hpp"
 
 #include "oatpp/core/base/memory/MemoryPool.hpp"
+#include "oatpp/core/base/memory/MemoryPoolTrimmer.hpp"
+#include "oatpp/core/base/memory/SlabAllocator.hpp"
+#include "oatpp/core/base/memory/Allocator.hpp"
 #include "oatpp-test/Checker.hpp"
 
+#include <vector>
+
 namespace oatpp { namespace test { namespace memory {
 
 namespace {
@@ -152,6 +157,243 @@ void testPool(v_int32 objectsNumber, v_int32 garbageNumber, v_int32 chunkSize){
   void doStackAlloc(){
     TestClass a(10);
   }
+
+  void testTrim(){
+
+    base::memory::MemoryPool pool("MemoryPoolTest::Pool4", sizeof(TestClass), 16);
+    std::list<TestClass*> objects;
+
+    for(v_int32 i = 0; i < 160; i++){
+      objects.push_back(new (pool.obtain()) TestClass(i));
+    }
+
+    auto stats = pool.getStats();
+    OATPP_ASSERT(stats.name == "MemoryPoolTest::Pool4");
+    OATPP_ASSERT(stats.chunksCount == 10);
+    OATPP_ASSERT(stats.objectsCount == 160);
+    OATPP_ASSERT(stats.highWaterMark == 160);
+
+    /* keep one object alive in the 5-th chunk */
+    v_int32 index = 0;
+    for(auto it = objects.begin(); it != objects.end();) {
+      if(index ++ != 70) {
+        oatpp::base::memory::MemoryPool::free(*it);
+        it = objects.erase(it);
+      } else {
+        it ++;
+      }
+    }
+
+    OATPP_ASSERT(pool.trim() > 0);
+    stats = pool.getStats();
+    OATPP_ASSERT(stats.chunksCount == 2);
+    OATPP_ASSERT(stats.objectsCount == 1);
+    OATPP_ASSERT(stats.highWaterMark == 160);
+    OATPP_ASSERT(pool.trim() == 0);
+
+    /* free list must contain only entries of the chunks left */
+    for(v_int32 i = 0; i < 31; i++){
+      objects.push_back(new (pool.obtain()) TestClass(i));
+    }
+    OATPP_ASSERT(pool.getStats().chunksCount == 2);
+
+    for(auto obj : objects) {
+      oatpp::base::memory::MemoryPool::free(obj);
+    }
+    objects.clear();
+
+    bool found = false;
+    for(auto& s : base::memory::MemoryPool::getAllPoolsStats()) {
+      if(s.name == "MemoryPoolTest::Pool4") {
+        found = true;
+        OATPP_ASSERT(s.objectsCount == 0);
+      }
+    }
+    OATPP_ASSERT(found);
+
+    {
+      for(v_int32 i = 0; i < 160; i++){
+        objects.push_back(new (pool.obtain()) TestClass(i));
+      }
+      for(auto obj : objects) {
+        oatpp::base::memory::MemoryPool::free(obj);
+      }
+      base::memory::MemoryPoolTrimmer trimmer(std::chrono::milliseconds(10));
+      v_int32 attempts = 0;
+      while(pool.getStats().chunksCount > 1 && attempts ++ < 100) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      }
+      OATPP_ASSERT(pool.getStats().chunksCount == 1);
+    }
+
+  }
+  
+  void testHugePages(){
+
+    typedef base::memory::MemoryPool MemoryPool;
+
+    MemoryPool pool("MemoryPoolTest::HugePagesPool", 4096, 16, true);
+
+    auto stats = pool.getStats();
+    OATPP_ASSERT(stats.chunksCount == 1);
+#ifdef __linux__
+    OATPP_ASSERT(stats.chunkSize > 16);
+    OATPP_ASSERT(stats.bytesAllocated % MemoryPool::HUGE_PAGE_SIZE == 0);
+    OATPP_ASSERT(stats.hugePageChunksCount == 1);
+#endif
+
+    std::list<p_char8> entries;
+    for(v_buff_size i = 0; i < stats.chunkSize * 3; i++) {
+      p_char8 entry = (p_char8) pool.obtain();
+      std::memset(entry, (v_char8) i, 4096);
+      entries.push_back(entry);
+    }
+
+    stats = pool.getStats();
+    OATPP_ASSERT(stats.chunksCount == 3);
+#ifdef __linux__
+    OATPP_ASSERT(stats.hugePageChunksCount == 3);
+#endif
+
+    v_buff_size index = 0;
+    for(auto entry : entries) {
+      OATPP_ASSERT(entry[0] == (v_char8) index && entry[4095] == (v_char8) index);
+      MemoryPool::free(entry);
+      ++ index;
+    }
+
+    OATPP_ASSERT(pool.trim() == 2 * stats.bytesAllocated / 3);
+    OATPP_ASSERT(pool.getStats().chunksCount == 1);
+
+  }
+
+  v_int64 getObjectsCount(const std::string& poolName) {
+    v_int64 result = 0;
+    for(const auto& stats : base::memory::MemoryPool::getAllPoolsStats()) {
+      if(stats.name.compare(0, poolName.size() + 1, poolName + "_") == 0) {
+        result += stats.objectsCount;
+      }
+    }
+    return result;
+  }
+
+  void testMagazines(){
+
+    typedef base::memory::MemoryPool MemoryPool;
+    typedef base::memory::ThreadDistributedMemoryPool ThreadDistributedMemoryPool;
+
+    {
+      ThreadDistributedMemoryPool pool("MemoryPoolTest::SmallEntriesPool", 1024, 16);
+      void* entry = pool.obtain();
+      MemoryPool::free(entry);
+      // freed entry stays in the thread's magazine
+      OATPP_ASSERT(getObjectsCount("MemoryPoolTest::SmallEntriesPool") > 0);
+      pool.trim();
+      OATPP_ASSERT(getObjectsCount("MemoryPoolTest::SmallEntriesPool") == 0);
+    }
+
+    {
+      ThreadDistributedMemoryPool pool("MemoryPoolTest::LargeEntriesPool", 64 * 1024, 4);
+      void* entry = pool.obtain();
+      OATPP_ASSERT(getObjectsCount("MemoryPoolTest::LargeEntriesPool") == 1);
+      MemoryPool::free(entry);
+      // large entries bypass the magazine and go straight back to the shard
+      OATPP_ASSERT(getObjectsCount("MemoryPoolTest::LargeEntriesPool") == 0);
+    }
+
+  }
+
+  struct LargeTestClass {
+    v_char8 data[3000];
+  };
+
+  v_int64 getPoolAllocatorObjectsCount() {
+    v_int64 result = 0;
+    for(const auto& stats : base::memory::MemoryPool::getAllPoolsStats()) {
+      if(stats.name.compare(0, 14, "PoolAllocator_") == 0) {
+        result += stats.objectsCount;
+      }
+    }
+    return result;
+  }
+
+  void testPoolAllocator(){
+
+    typedef base::memory::PooledAllocation PooledAllocation;
+
+    {
+      auto before = getPoolAllocatorObjectsCount();
+
+      std::list<v_int64, base::memory::PoolAllocator<v_int64>> list;
+      for(v_int64 i = 0; i < 1000; i++) {
+        list.push_back(i);
+      }
+      OATPP_ASSERT(getPoolAllocatorObjectsCount() - before >= 1000);
+
+      v_int64 expected = 0;
+      for(auto item : list) {
+        OATPP_ASSERT(item == expected);
+        ++ expected;
+      }
+
+      // multi-element allocations are not pooled
+      std::vector<v_int64, base::memory::PoolAllocator<v_int64>> vector(1000, 7);
+      OATPP_ASSERT(vector[999] == 7);
+    }
+
+    {
+      OATPP_ASSERT(!PooledAllocation::isEnabled());
+      auto before = getPoolAllocatorObjectsCount();
+
+      auto heapObject = PooledAllocation::allocateShared<LargeTestClass>();
+      OATPP_ASSERT(getPoolAllocatorObjectsCount() == before);
+
+      std::shared_ptr<LargeTestClass> pooledObject;
+      {
+        PooledAllocation::Scope scope;
+        PooledAllocation::Scope nestedScope;
+        OATPP_ASSERT(PooledAllocation::isEnabled());
+        pooledObject = PooledAllocation::allocateShared<LargeTestClass>();
+      }
+      OATPP_ASSERT(!PooledAllocation::isEnabled());
+      // size class of LargeTestClass is not used elsewhere - its thread cache is filled from the shards
+      OATPP_ASSERT(getPoolAllocatorObjectsCount() > before);
+      pooledObject->data[0] = heapObject->data[0] = 1;
+    }
+
+  }
+
+  void testSlabAllocator(){
+
+    typedef base::memory::SlabAllocator SlabAllocator;
+
+    OATPP_ASSERT(SlabAllocator::getCapacity(0) == 64);
+    OATPP_ASSERT(SlabAllocator::getCapacity(64) == 64);
+    OATPP_ASSERT(SlabAllocator::getCapacity(65) == 96);
+    OATPP_ASSERT(SlabAllocator::getCapacity(97) == 128);
+    OATPP_ASSERT(SlabAllocator::getCapacity(129) == 192);
+    OATPP_ASSERT(SlabAllocator::getCapacity(4096) == 4096);
+    OATPP_ASSERT(SlabAllocator::getCapacity(4097) == 6144);
+    OATPP_ASSERT(SlabAllocator::getCapacity(SlabAllocator::MAX_CLASS_SIZE) == SlabAllocator::MAX_CLASS_SIZE);
+    OATPP_ASSERT(SlabAllocator::getCapacity(SlabAllocator::MAX_CLASS_SIZE + 1) == SlabAllocator::MAX_CLASS_SIZE + 1);
+
+    std::list<std::pair<p_char8, v_buff_size>> blocks;
+    for(v_buff_size size = 1; size < 2 * SlabAllocator::MAX_CLASS_SIZE; size = size * 5 / 4 + 1) {
+      OATPP_ASSERT(SlabAllocator::getCapacity(size) >= size);
+      OATPP_ASSERT(SlabAllocator::getCapacity(size) <= std::max<v_buff_size>(64, size * 3 / 2));
+      p_char8 block = (p_char8) SlabAllocator::allocate(size);
+      std::memset(block, (v_char8) size, size);
+      blocks.push_back({block, size});
+    }
+
+    for(auto& block : blocks) {
+      for(v_buff_size i = 0; i < block.second; i++) {
+        OATPP_ASSERT(block.first[i] == (v_char8) block.second);
+      }
+      SlabAllocator::deallocate(block.first, block.second);
+    }
+
+  }
   
 }
   
@@ -194,6 +436,15 @@ void MemoryPoolTest::onRun() {
     }
   }
   
+#ifndef OATPP_DISABLE_POOL_ALLOCATIONS
+  testTrim();
+  testHugePages();
+  testMagazines();
+  testPoolAllocator();
+#endif
+
+  testSlabAllocator();
+
 }
 
 }}}
@@ -27,8 +27,16 @@
 #include "oatpp/core/collection/LinkedList.hpp"
 #include "oatpp/core/Types.hpp"
 #include "oatpp/core/concurrency/Thread.hpp"
+#include "oatpp/core/base/memory/MemoryPool.hpp"
+#include "oatpp/core/utils/ConversionUtils.hpp"
 
+#include "oatpp-test/Checker.hpp"
+
+#include <atomic>
+#include <condition_variable>
 #include <list>
+#include <mutex>
+#include <vector>
 
 namespace oatpp { namespace test { namespace memory {
   
@@ -83,6 +91,164 @@ namespace {
     }
   };
   
+  typedef oatpp::base::memory::ThreadDistributedMemoryPool Pool;
+
+  const v_int32 ALLOC_ITERATIONS = 100000;
+  const v_int32 ALLOC_BATCH = 16;
+
+  void allocLocal(Pool* pool) {
+    void* entries[ALLOC_BATCH];
+    for(v_int32 i = 0; i < ALLOC_ITERATIONS; i ++) {
+      for(v_int32 j = 0; j < ALLOC_BATCH; j ++) {
+        entries[j] = (pool != nullptr) ? pool->obtain() : ::operator new(64);
+      }
+      for(v_int32 j = 0; j < ALLOC_BATCH; j ++) {
+        if(pool != nullptr) {
+          oatpp::base::memory::MemoryPool::free(entries[j]);
+        } else {
+          ::operator delete(entries[j]);
+        }
+      }
+    }
+  }
+
+  /*
+   * Entries are obtained by the producer thread and freed by the consumer thread.
+   */
+  class Handoff {
+  private:
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::list<std::vector<void*>> m_batches;
+    bool m_finished = false;
+  public:
+
+    void produce(Pool* pool) {
+      for(v_int32 i = 0; i < ALLOC_ITERATIONS; i ++) {
+        std::vector<void*> batch(ALLOC_BATCH);
+        for(auto& entry : batch) {
+          entry = (pool != nullptr) ? pool->obtain() : ::operator new(64);
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_batches.push_back(std::move(batch));
+        m_condition.notify_one();
+      }
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_finished = true;
+      m_condition.notify_one();
+    }
+
+    void consume(Pool* pool) {
+      while(true) {
+        std::vector<void*> batch;
+        {
+          std::unique_lock<std::mutex> lock(m_mutex);
+          m_condition.wait(lock, [this]{ return !m_batches.empty() || m_finished; });
+          if(m_batches.empty()) {
+            return;
+          }
+          batch = std::move(m_batches.front());
+          m_batches.pop_front();
+        }
+        for(auto entry : batch) {
+          if(pool != nullptr) {
+            oatpp::base::memory::MemoryPool::free(entry);
+          } else {
+            ::operator delete(entry);
+          }
+        }
+      }
+    }
+
+  };
+
+  constexpr v_int32 COUNTABLE_ITERATIONS = 1000000;
+
+  std::atomic<v_int64> globalCounter(0);
+
+  void createCountables() {
+    for(v_int32 i = 0; i < COUNTABLE_ITERATIONS; i ++) {
+      oatpp::base::Countable countable;
+    }
+  }
+
+  void incGlobalCounter() {
+    for(v_int32 i = 0; i < COUNTABLE_ITERATIONS; i ++) {
+      globalCounter ++;
+      globalCounter --;
+    }
+  }
+
+  void runThreads(void (*task)(), v_int32 threadsCount) {
+    std::list<std::thread> threads;
+    for(v_int32 i = 0; i < threadsCount; i ++) {
+      threads.push_back(std::thread(task));
+    }
+    for(auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+  /*
+   * Simulate IO buffers of many concurrent connections:
+   * obtain 4KB entry per connection and touch random connection buffers.
+   */
+  void touchConnectionBuffers(bool hugePages, v_int32 connectionsCount, v_int32 touchesCount) {
+
+    oatpp::base::memory::MemoryPool pool("PerfTest::ConnectionBuffers", 4096, 16, hugePages);
+
+    std::vector<p_char8> buffers(connectionsCount);
+    for(auto& buffer : buffers) {
+      buffer = (p_char8) pool.obtain();
+      std::memset(buffer, 0, 4096);
+    }
+
+    auto tag = std::string("MemoryPool - ") + (hugePages ? "huge pages" : "regular pages") + ", random access to buffers of " +
+               oatpp::utils::conversion::int32ToStdStr(connectionsCount) + " connections";
+
+    v_uint64 sum = 0;
+    {
+      PerformanceChecker checker(tag.c_str());
+      v_uint32 random = 1;
+      for(v_int32 i = 0; i < touchesCount; i++) {
+        random = random * 1103515245 + 12345;
+        p_char8 buffer = buffers[(random >> 8) % connectionsCount];
+        buffer[random % 4096] ++;
+        sum += buffer[(random >> 4) % 4096];
+      }
+    }
+
+    OATPP_LOGD("PerfTest", "%s - chunks=%d, huge page chunks=%d, sum=%llu", tag.c_str(),
+               (v_int32) pool.getStats().chunksCount, (v_int32) pool.getStats().hugePageChunksCount, sum);
+
+    for(auto buffer : buffers) {
+      oatpp::base::memory::MemoryPool::free(buffer);
+    }
+
+  }
+
+  void runAllocLocal(Pool* pool, v_int32 threadsCount) {
+    std::list<std::thread> threads;
+    for(v_int32 i = 0; i < threadsCount; i ++) {
+      threads.push_back(std::thread(allocLocal, pool));
+    }
+    for(auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+  void runAllocHandoff(Pool* pool, v_int32 pairsCount) {
+    std::list<Handoff> handoffs(pairsCount);
+    std::list<std::thread> threads;
+    for(auto& handoff : handoffs) {
+      threads.push_back(std::thread(&Handoff::produce, &handoff, pool));
+      threads.push_back(std::thread(&Handoff::consume, &handoff, pool));
+    }
+    for(auto& thread : threads) {
+      thread.join();
+    }
+  }
+  
 }
   
 void PerfTest::onRun() {
@@ -105,6 +271,60 @@ void PerfTest::onRun() {
     
   }
 
+  {
+    Pool pool("PerfTest::Pool", 64, 1024);
+
+    {
+      PerformanceChecker checker("ThreadDistributedMemoryPool - 4 threads, local obtain/free");
+      runAllocLocal(&pool, 4);
+    }
+
+    {
+      PerformanceChecker checker("new/delete - 4 threads, local obtain/free");
+      runAllocLocal(nullptr, 4);
+    }
+
+    {
+      PerformanceChecker checker("ThreadDistributedMemoryPool - 4 threads, cross-thread free");
+      runAllocHandoff(&pool, 2);
+    }
+
+    {
+      PerformanceChecker checker("new/delete - 4 threads, cross-thread free");
+      runAllocHandoff(nullptr, 2);
+    }
+
+  }
+
+#ifndef OATPP_DISABLE_POOL_ALLOCATIONS
+  touchConnectionBuffers(false, 50000, 20000000);
+  touchConnectionBuffers(true, 50000, 20000000);
+#endif
+
+  for(v_int32 threadsCount = 1; threadsCount <= 8; threadsCount *= 2) {
+
+    auto objectsCount = oatpp::base::Environment::getObjectsCount();
+    auto objectsCreated = oatpp::base::Environment::getObjectsCreated();
+
+    auto threads = oatpp::utils::conversion::int32ToStdStr(threadsCount);
+    auto countableTag = "Countable - " + threads + " threads, create/destroy (sharded counters)";
+    auto atomicTag = "std::atomic - " + threads + " threads, inc/dec (single global counter)";
+
+    {
+      PerformanceChecker checker(countableTag.c_str());
+      runThreads(createCountables, threadsCount);
+    }
+
+    {
+      PerformanceChecker checker(atomicTag.c_str());
+      runThreads(incGlobalCounter, threadsCount);
+    }
+
+    OATPP_ASSERT(oatpp::base::Environment::getObjectsCount() == objectsCount);
+    OATPP_ASSERT(oatpp::base::Environment::getObjectsCreated() - objectsCreated == (v_counter) COUNTABLE_ITERATIONS * threadsCount);
+
+  }
+
 }
   
 }}}
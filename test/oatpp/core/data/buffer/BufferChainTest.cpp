@@ -0,0 +1,306 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "BufferChainTest.hpp"
+
+#include "oatpp/web/protocol/http/outgoing/BufferChainBody.hpp"
+#include "oatpp/core/data/buffer/BufferChain.hpp"
+#include "oatpp/core/data/stream/BufferStream.hpp"
+#include "oatpp/core/async/Executor.hpp"
+
+#include "oatpp-test/Checker.hpp"
+
+namespace oatpp { namespace test { namespace core { namespace data { namespace buffer {
+
+namespace {
+
+typedef oatpp::data::buffer::BufferChain BufferChain;
+
+class FlushCoroutine : public oatpp::async::Coroutine<FlushCoroutine> {
+private:
+  std::shared_ptr<BufferChain> m_chain;
+  std::shared_ptr<oatpp::data::stream::OutputStream> m_stream;
+public:
+
+  FlushCoroutine(const std::shared_ptr<BufferChain>& chain,
+                 const std::shared_ptr<oatpp::data::stream::OutputStream>& stream)
+    : m_chain(chain)
+    , m_stream(stream)
+  {}
+
+  Action act() override {
+    return m_chain->flushToStreamAsync(m_stream).next(finish());
+  }
+
+};
+
+class CountingOutputStream : public oatpp::data::stream::BufferOutputStream {
+public:
+  v_int32 writeCount = 0;
+public:
+
+  v_io_size write(const void *data, v_buff_size count, oatpp::async::Action& action) override {
+    ++ writeCount;
+    return BufferOutputStream::write(data, count, action);
+  }
+
+};
+
+std::shared_ptr<BufferChain> createChain(const std::shared_ptr<oatpp::data::buffer::IOBuffer>& ioBuffer) {
+
+  auto chain = BufferChain::createShared();
+
+  chain->appendStatic("Hello", 5);
+  chain->append(oatpp::String(" "));
+
+  oatpp::String world = "World";
+  chain->append(oatpp::data::share::MemoryLabel(world.getPtr(), world->getData(), world->getSize()));
+
+  std::memcpy(ioBuffer->getData(), "!!!", 3);
+  chain->append(ioBuffer, 3);
+
+  auto chunked = oatpp::data::stream::ChunkedBuffer::createShared();
+  chunked->writeSimple("<chunked>", 9);
+  chain->append(chunked);
+
+  return chain;
+
+}
+
+}
+
+void BufferChainTest::onRun() {
+
+  oatpp::String etalon = "Hello World!!!<chunked>";
+
+  {
+    OATPP_LOGI(TAG, "Slices are adopted without copy...");
+
+    auto ioBuffer = oatpp::data::buffer::IOBuffer::createShared();
+    oatpp::String text = "text";
+
+    BufferChain chain;
+    chain.appendStatic("static", 6);
+    chain.append(text);
+    chain.append(ioBuffer, 100);
+    chain.appendStatic("", 0);
+
+    OATPP_ASSERT(chain.getSlices().size() == 3);
+    OATPP_ASSERT(chain.getSize() == 110);
+    OATPP_ASSERT(chain.getSlices()[1].data == text->getData());
+    OATPP_ASSERT(chain.getSlices()[1].owner.get() == text.get());
+    OATPP_ASSERT(chain.getSlices()[2].data == ioBuffer->getData());
+    OATPP_ASSERT(chain.getSlices()[2].owner == ioBuffer);
+
+    bool thrown = false;
+    try {
+      chain.append(ioBuffer, ioBuffer->getSize() + 1);
+    } catch (const std::runtime_error& e) {
+      thrown = true;
+    }
+    OATPP_ASSERT(thrown);
+
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "Copy and toString...");
+
+    auto chain = createChain(oatpp::data::buffer::IOBuffer::createShared());
+    OATPP_ASSERT(chain->getSlices().size() == 5);
+    OATPP_ASSERT(chain->getSize() == etalon->getSize());
+    OATPP_ASSERT(chain->toString() == etalon);
+
+    for(v_buff_size offset = 0; offset <= etalon->getSize(); offset ++) {
+      for(v_buff_size count = 0; count <= etalon->getSize() - offset; count ++) {
+        v_char8 buffer[64];
+        auto res = chain->copyTo(offset, buffer, count);
+        OATPP_ASSERT(res == count);
+        OATPP_ASSERT(oatpp::String((const char*) buffer, count, true) == oatpp::String((const char*) etalon->getData() + offset, count, true));
+      }
+    }
+
+    BufferChain joined;
+    joined.append(*chain);
+    joined.append(*chain);
+    OATPP_ASSERT(joined.getSize() == 2 * chain->getSize());
+    OATPP_ASSERT(joined.toString() == etalon + etalon);
+
+    joined.clear();
+    OATPP_ASSERT(joined.getSize() == 0);
+    OATPP_ASSERT(joined.getSlices().empty());
+
+    OATPP_LOGI(TAG, "OK");
+  }
+
+#if !defined(WIN32) && !defined(_WIN32)
+  {
+    OATPP_LOGI(TAG, "IOVec...");
+
+    auto chain = createChain(oatpp::data::buffer::IOBuffer::createShared());
+
+    struct iovec vec[8];
+    auto count = chain->getIOVec(7, vec, 8);
+    OATPP_ASSERT(count == 3);
+    OATPP_ASSERT(vec[0].iov_len == 4);
+    OATPP_ASSERT(std::memcmp(vec[0].iov_base, "orld", 4) == 0);
+    OATPP_ASSERT(vec[2].iov_len == 9);
+
+    count = chain->getIOVec(0, vec, 2);
+    OATPP_ASSERT(count == 2);
+    OATPP_ASSERT(vec[0].iov_len == 5);
+    OATPP_ASSERT(vec[1].iov_len == 1);
+
+    OATPP_LOGI(TAG, "OK");
+  }
+#endif
+
+  {
+    OATPP_LOGI(TAG, "Flush to stream...");
+
+    auto chain = createChain(oatpp::data::buffer::IOBuffer::createShared());
+
+    oatpp::data::stream::BufferOutputStream stream;
+    auto res = chain->flushToStream(&stream);
+    OATPP_ASSERT(res == etalon->getSize());
+    OATPP_ASSERT(stream.toString() == etalon);
+
+    auto asyncStream = std::make_shared<oatpp::data::stream::BufferOutputStream>();
+
+    oatpp::async::Executor executor(1, 1, 1);
+    executor.execute<FlushCoroutine>(chain, asyncStream);
+    executor.waitTasksFinished();
+    executor.stop();
+    executor.join();
+
+    OATPP_ASSERT(asyncStream->toString() == etalon);
+
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "Small slices are coalesced...");
+
+    oatpp::String large(BufferChain::COALESCE_SLICE_MAX_SIZE + 1);
+    std::memset(large->getData(), 'L', large->getSize());
+
+    auto chain = BufferChain::createShared();
+    for(v_int32 i = 0; i < 100; i ++) {
+      chain->appendStatic("0123456789", 10);
+    }
+    chain->append(large);
+    chain->appendStatic("tail", 4);
+    for(v_int32 i = 0; i < 1000; i ++) {
+      chain->appendStatic("0123456789", 10);
+    }
+
+    auto expected = chain->toString();
+
+    CountingOutputStream stream;
+    auto res = chain->flushToStream(&stream);
+    OATPP_ASSERT(res == expected->getSize());
+    OATPP_ASSERT(stream.toString() == expected);
+    // 1 write for the first run, 1 for the large slice, 3 for the 4004 + 6000 bytes run split by the 4KB write buffer
+    OATPP_ASSERT(stream.writeCount == 5);
+
+    auto asyncStream = std::make_shared<CountingOutputStream>();
+
+    oatpp::async::Executor executor(1, 1, 1);
+    executor.execute<FlushCoroutine>(chain, asyncStream);
+    executor.waitTasksFinished();
+    executor.stop();
+    executor.join();
+
+    OATPP_ASSERT(asyncStream->toString() == expected);
+    OATPP_ASSERT(asyncStream->writeCount == 5);
+
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "BufferChainBody...");
+
+    auto chain = createChain(oatpp::data::buffer::IOBuffer::createShared());
+    auto body = oatpp::web::protocol::http::outgoing::BufferChainBody::createShared(chain, "text/plain");
+
+    OATPP_ASSERT(body->getKnownSize() == etalon->getSize());
+    OATPP_ASSERT(body->getKnownData() == nullptr);
+    OATPP_ASSERT(body->getKnownChain() == chain.get());
+
+    oatpp::web::protocol::http::Headers headers;
+    body->declareHeaders(headers);
+    OATPP_ASSERT(headers.get("Content-Type") == "text/plain");
+
+    oatpp::data::stream::BufferOutputStream stream;
+    v_char8 buffer[4];
+    oatpp::async::Action action;
+    v_io_size res;
+    while((res = body->read(buffer, 4, action)) > 0) {
+      stream.writeSimple(buffer, res);
+    }
+    OATPP_ASSERT(res == 0);
+    OATPP_ASSERT(stream.toString() == etalon);
+
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+
+    const v_int32 iterations = 10000;
+    oatpp::String part(8192);
+    std::memset(part->getData(), 'x', part->getSize());
+
+    v_buff_size size1 = 0;
+    v_buff_size size2 = 0;
+
+    {
+      oatpp::test::PerformanceChecker checker("Assemble 16 x 8KB parts - BufferOutputStream copy");
+      for(v_int32 i = 0; i < iterations; i ++) {
+        oatpp::data::stream::BufferOutputStream stream(16 * 8192);
+        for(v_int32 j = 0; j < 16; j ++) {
+          stream.writeSimple(part->getData(), part->getSize());
+        }
+        auto result = stream.toString();
+        size1 += result->getSize();
+      }
+    }
+
+    {
+      oatpp::test::PerformanceChecker checker("Assemble 16 x 8KB parts - BufferChain");
+      for(v_int32 i = 0; i < iterations; i ++) {
+        BufferChain chain;
+        for(v_int32 j = 0; j < 16; j ++) {
+          chain.append(part);
+        }
+        size2 += chain.getSize();
+      }
+    }
+
+    OATPP_ASSERT(size1 == size2);
+
+  }
+
+}
+
+}}}}}
@@ -0,0 +1,184 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "IOBufferTest.hpp"
+
+#include "oatpp/core/data/buffer/IOBuffer.hpp"
+#include "oatpp/core/data/stream/BufferStream.hpp"
+#include "oatpp/core/async/Executor.hpp"
+
+#include "oatpp-test/Checker.hpp"
+
+#include <cstring>
+
+namespace oatpp { namespace test { namespace core { namespace data { namespace buffer {
+
+namespace {
+
+typedef oatpp::data::buffer::IOBuffer IOBuffer;
+
+class TestInputStream : public oatpp::data::stream::BufferInputStream {
+public:
+
+  v_int64 readCalls = 0;
+
+  TestInputStream(const oatpp::String& data)
+    : BufferInputStream(data)
+  {}
+
+  v_io_size read(void *data, v_buff_size count, async::Action& action) override {
+    readCalls ++;
+    return BufferInputStream::read(data, count, action);
+  }
+
+};
+
+class TransferCoroutine : public oatpp::async::Coroutine<TransferCoroutine> {
+private:
+  std::shared_ptr<TestInputStream> m_inStream;
+  std::shared_ptr<oatpp::data::stream::BufferOutputStream> m_outStream;
+  std::shared_ptr<IOBuffer> m_buffer;
+  v_int64* m_finishTime;
+public:
+
+  TransferCoroutine(const std::shared_ptr<TestInputStream>& inStream,
+                    const std::shared_ptr<oatpp::data::stream::BufferOutputStream>& outStream,
+                    const std::shared_ptr<IOBuffer>& buffer,
+                    v_int64* finishTime)
+    : m_inStream(inStream)
+    , m_outStream(outStream)
+    , m_buffer(buffer)
+    , m_finishTime(finishTime)
+  {}
+
+  Action act() override {
+    return oatpp::data::stream::transferAsync(m_inStream, m_outStream, 0, m_buffer).next(yieldTo(&TransferCoroutine::onTransferred));
+  }
+
+  Action onTransferred() {
+    *m_finishTime = oatpp::base::Environment::getMicroTickCount();
+    return finish();
+  }
+
+};
+
+void runAsyncTransfer(const oatpp::String& data, v_buff_size bufferSize, const char* tag) {
+
+  auto inStream = std::make_shared<TestInputStream>(data);
+  auto outStream = std::make_shared<oatpp::data::stream::BufferOutputStream>(data->getSize(), 1);
+  auto buffer = IOBuffer::createShared(bufferSize);
+
+  oatpp::async::Executor executor(1, 1, 1);
+
+  v_int64 finishTime = 0;
+  v_int64 startTime = oatpp::base::Environment::getMicroTickCount();
+  executor.execute<TransferCoroutine>(inStream, outStream, buffer, &finishTime);
+  executor.waitTasksFinished();
+  executor.stop();
+  executor.join();
+
+  OATPP_ASSERT(outStream->getCurrentPosition() == data->getSize());
+  OATPP_ASSERT(std::memcmp(outStream->getData(), data->getData(), data->getSize()) == 0);
+
+  OATPP_LOGD(tag, "buffer=%d, reads=%d, %d(micro)", buffer->getSize(), inStream->readCalls, finishTime - startTime);
+
+}
+
+}
+
+void IOBufferTest::onRun() {
+
+  {
+    OATPP_LOGI(TAG, "Size classes...");
+
+    OATPP_ASSERT(IOBuffer().getSize() == 4096);
+    OATPP_ASSERT(IOBuffer(1).getSize() == 4096);
+    OATPP_ASSERT(IOBuffer(4096).getSize() == 4096);
+    OATPP_ASSERT(IOBuffer(4097).getSize() == 16 * 1024);
+    OATPP_ASSERT(IOBuffer(64 * 1024).getSize() == 64 * 1024);
+    OATPP_ASSERT(IOBuffer(256 * 1024).getSize() == 256 * 1024);
+    OATPP_ASSERT(IOBuffer(1024 * 1024).getSize() == 256 * 1024);
+
+    auto buffer = IOBuffer::createShared(100 * 1024);
+    OATPP_ASSERT(buffer->getSize() == 256 * 1024);
+    std::memset(buffer->getData(), 'x', buffer->getSize());
+
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "Select size...");
+
+    OATPP_ASSERT(IOBuffer::selectSize(-1, 5) == 4096);
+    OATPP_ASSERT(IOBuffer::selectSize(-1, 32767) == 16 * 1024);
+    OATPP_ASSERT(IOBuffer::selectSize(-1, 1024 * 1024) == IOBuffer::STREAMING_BUFFER_SIZE);
+    OATPP_ASSERT(IOBuffer::selectSize(100, 32767) == 4096);
+    OATPP_ASSERT(IOBuffer::selectSize(10000, 32767) == 16 * 1024);
+    OATPP_ASSERT(IOBuffer::selectSize(10 * 1024 * 1024, 32767) == 64 * 1024);
+    OATPP_ASSERT(IOBuffer::selectSize(10 * 1024 * 1024, 1024 * 1024) == 256 * 1024);
+    OATPP_ASSERT(IOBuffer::selectSize(0, 32767) == 4096);
+
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+
+    OATPP_LOGI(TAG, "Transfer 16MB body:");
+
+    oatpp::String data(16 * 1024 * 1024);
+    for(v_buff_size i = 0; i < data->getSize(); i ++) {
+      data->getData()[i] = (v_char8)('a' + i % 26);
+    }
+
+    auto selectedSize = IOBuffer::selectSize(data->getSize(), oatpp::data::stream::StatelessDataTransferProcessor::INSTANCE.suggestInputStreamReadSize());
+
+    {
+      oatpp::test::PerformanceChecker checker("transfer - 4KB IOBuffer");
+      TestInputStream inStream(data);
+      oatpp::data::stream::BufferOutputStream outStream(data->getSize(), 1);
+      IOBuffer buffer;
+      auto res = oatpp::data::stream::transfer(&inStream, &outStream, 0, buffer.getData(), buffer.getSize());
+      OATPP_ASSERT(res == data->getSize());
+      OATPP_LOGD(TAG, "reads=%d", inStream.readCalls);
+    }
+
+    {
+      oatpp::test::PerformanceChecker checker("transfer - selected IOBuffer");
+      TestInputStream inStream(data);
+      oatpp::data::stream::BufferOutputStream outStream(data->getSize(), 1);
+      IOBuffer buffer(selectedSize);
+      auto res = oatpp::data::stream::transfer(&inStream, &outStream, 0, buffer.getData(), buffer.getSize());
+      OATPP_ASSERT(res == data->getSize());
+      OATPP_ASSERT(std::memcmp(outStream.getData(), data->getData(), data->getSize()) == 0);
+      OATPP_LOGD(TAG, "reads=%d", inStream.readCalls);
+    }
+
+    runAsyncTransfer(data, IOBuffer::BUFFER_SIZE, "transferAsync - 4KB IOBuffer");
+    runAsyncTransfer(data, selectedSize, "transferAsync - selected IOBuffer");
+
+  }
+
+}
+
+}}}}}
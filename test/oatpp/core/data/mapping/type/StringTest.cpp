@@ -25,6 +25,7 @@
 #include "StringTest.hpp"
 
 #include "oatpp/core/Types.hpp"
+#include "oatpp/core/data/share/MemoryLabel.hpp"
 
 #include <functional>
 
@@ -134,6 +135,24 @@ void StringTest::onRun() {
     OATPP_LOGI(TAG, "OK");
   }
 
+  {
+    OATPP_LOGI(TAG, "test strings of all pool size classes");
+    std::string text;
+    for(v_int32 i = 0; i < 300; i ++) {
+      oatpp::String s(text.data(), text.size(), true);
+      OATPP_ASSERT(s->getSize() == (v_buff_size) text.size());
+      OATPP_ASSERT(s->c_str()[text.size()] == 0);
+      OATPP_ASSERT(s == text.c_str());
+
+      oatpp::data::share::StringKeyLabel label(s.getPtr(), s->getData(), s->getSize());
+      s = nullptr;
+      OATPP_ASSERT(label == text.c_str());
+
+      text.push_back((char)('a' + i % 26));
+    }
+    OATPP_LOGI(TAG, "OK");
+  }
+
 }
 
 }}}}}}
@@ -147,6 +147,29 @@ void BufferStreamTest::onRun() {
 
   }
 
+  {
+
+    BufferOutputStream stream(1024, 1024);
+
+    stream << "Hello World!";
+    OATPP_ASSERT(stream.toString() == "Hello World!");
+
+    stream.releaseBuffer();
+    OATPP_ASSERT(stream.getData() == nullptr);
+    OATPP_ASSERT(stream.getCapacity() == 0);
+    OATPP_ASSERT(stream.getCurrentPosition() == 0);
+    OATPP_ASSERT(stream.toString() == "");
+
+    stream << "oat++";
+    OATPP_ASSERT(stream.getCapacity() == 1024);
+    OATPP_ASSERT(stream.toString() == "oat++");
+
+    stream.releaseBuffer();
+    stream.reserveBytesUpfront(4000);
+    OATPP_ASSERT(stream.getCapacity() == 4096);
+
+  }
+
 }
 
 }}}}}
\ No newline at end of file
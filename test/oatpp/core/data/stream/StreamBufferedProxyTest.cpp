@@ -0,0 +1,266 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "StreamBufferedProxyTest.hpp"
+
+#include "oatpp/core/data/stream/StreamBufferedProxy.hpp"
+#include "oatpp/core/data/stream/BufferStream.hpp"
+
+#include "oatpp-test/Checker.hpp"
+
+namespace oatpp { namespace test { namespace core { namespace data { namespace stream {
+
+namespace {
+
+typedef oatpp::data::stream::InputStreamBufferedProxy InputStreamBufferedProxy;
+
+class TestInputStream : public oatpp::data::stream::BufferInputStream {
+public:
+
+  v_int64 readCalls = 0;
+  v_buff_size maxReadSize = 0;
+  bool stalled = false;
+
+  TestInputStream(const oatpp::String& data)
+    : BufferInputStream(data)
+  {}
+
+  v_io_size read(void *data, v_buff_size count, async::Action& action) override {
+    readCalls ++;
+    if(stalled) {
+      return oatpp::IOError::RETRY_READ;
+    }
+    if(maxReadSize > 0 && count > maxReadSize) {
+      count = maxReadSize;
+    }
+    return BufferInputStream::read(data, count, action);
+  }
+
+};
+
+oatpp::String generateData(v_buff_size size) {
+  oatpp::String data(size);
+  for(v_buff_size i = 0; i < size; i ++) {
+    data->getData()[i] = (v_char8)('a' + i % 26);
+  }
+  return data;
+}
+
+bool readAll(InputStreamBufferedProxy* proxy, const oatpp::String& expected, v_buff_size readSize) {
+  std::unique_ptr<v_char8[]> buffer(new v_char8[readSize]);
+  oatpp::async::Action action;
+  v_buff_size position = 0;
+  while(position < expected->getSize()) {
+    auto size = expected->getSize() - position;
+    auto res = proxy->read(buffer.get(), size < readSize ? size : readSize, action);
+    if(res <= 0 || std::memcmp(buffer.get(), &expected->getData()[position], res) != 0) {
+      return false;
+    }
+    position += res;
+  }
+  return true;
+}
+
+}
+
+void StreamBufferedProxyTest::onRun() {
+
+  {
+    OATPP_LOGI(TAG, "Fixed buffer...");
+    auto data = generateData(1024 * 1024);
+    auto stream = std::make_shared<TestInputStream>(data);
+    auto proxy = InputStreamBufferedProxy::createShared(stream, base::StrBuffer::createShared(4096));
+    OATPP_ASSERT(readAll(proxy.get(), data, 100));
+    OATPP_ASSERT(proxy->getHeldBufferSize() == 4096);
+    OATPP_ASSERT(proxy->getNextBufferSize() == 0);
+    OATPP_ASSERT(stream->readCalls == 256);
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "Adaptive buffer grows and is returned when drained...");
+    auto data = generateData(1024 * 1024);
+    auto stream = std::make_shared<TestInputStream>(data);
+    auto proxy = InputStreamBufferedProxy::createShared(stream, 1024, 64 * 1024);
+    OATPP_ASSERT(proxy->getHeldBufferSize() == 0);
+    OATPP_ASSERT(proxy->getNextBufferSize() == 1024);
+
+    oatpp::async::Action action;
+    v_char8 buffer[100];
+    auto res = proxy->read(buffer, 100, action);
+    OATPP_ASSERT(res == 100);
+    OATPP_ASSERT(proxy->getHeldBufferSize() == 1024);
+    OATPP_ASSERT(proxy->getNextBufferSize() == 2048);
+
+    OATPP_ASSERT(readAll(proxy.get(), oatpp::String((const char*)&data->getData()[100], 512 * 1024 - 100, true), 100));
+    OATPP_ASSERT(proxy->getNextBufferSize() == 64 * 1024);
+
+    OATPP_ASSERT(readAll(proxy.get(), oatpp::String((const char*)&data->getData()[512 * 1024], 512 * 1024, true), 100));
+    OATPP_ASSERT(proxy->getHeldBufferSize() == 0);
+    OATPP_LOGI(TAG, "OK readCalls=%d", stream->readCalls);
+    OATPP_ASSERT(stream->readCalls < 256);
+  }
+
+  {
+    OATPP_LOGI(TAG, "Adaptive buffer shrinks on small reads...");
+    auto data = generateData(1024 * 1024);
+    auto stream = std::make_shared<TestInputStream>(data);
+    auto proxy = InputStreamBufferedProxy::createShared(stream, 1024, 64 * 1024);
+    OATPP_ASSERT(readAll(proxy.get(), oatpp::String((const char*)data->getData(), 512 * 1024, true), 100));
+    OATPP_ASSERT(proxy->getNextBufferSize() == 64 * 1024);
+    stream->maxReadSize = 100;
+    OATPP_ASSERT(readAll(proxy.get(), oatpp::String((const char*)&data->getData()[512 * 1024], 512 * 1024, true), 100));
+    OATPP_ASSERT(proxy->getNextBufferSize() == 1024);
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "Adaptive buffer is bypassed by big reads...");
+    auto data = generateData(64 * 1024);
+    auto stream = std::make_shared<TestInputStream>(data);
+    auto proxy = InputStreamBufferedProxy::createShared(stream, 1024, 64 * 1024);
+    OATPP_ASSERT(readAll(proxy.get(), data, 4096));
+    OATPP_ASSERT(proxy->getHeldBufferSize() == 0);
+    OATPP_ASSERT(stream->readCalls == 16);
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "Adaptive buffer peek/commit...");
+    auto stream = std::make_shared<TestInputStream>("GET / HTTP/1.1\r\n\r\n");
+    auto proxy = InputStreamBufferedProxy::createShared(stream, 1024, 64 * 1024);
+
+    oatpp::async::Action action;
+    v_char8 buffer[100];
+    auto res = proxy->peek(buffer, 100, action);
+    OATPP_ASSERT(res == 18);
+    OATPP_ASSERT(proxy->getHeldBufferSize() == 1024);
+
+    proxy->commitReadOffset(10);
+    OATPP_ASSERT(proxy->getHeldBufferSize() == 1024);
+
+    proxy->commitReadOffset(8);
+    OATPP_ASSERT(proxy->getHeldBufferSize() == 0);
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "Adaptive buffer is not held while stream has no data...");
+    auto stream = std::make_shared<TestInputStream>("hello");
+    stream->stalled = true;
+    auto proxy = InputStreamBufferedProxy::createShared(stream, 1024, 64 * 1024);
+
+    oatpp::async::Action action;
+    v_char8 buffer[100];
+    OATPP_ASSERT(proxy->peek(buffer, 100, action) == oatpp::IOError::RETRY_READ);
+    OATPP_ASSERT(proxy->getHeldBufferSize() == 0);
+
+    stream->stalled = false;
+    OATPP_ASSERT(proxy->read(buffer, 100, action) == 5);
+    OATPP_ASSERT(proxy->getHeldBufferSize() == 0);
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+
+    v_int32 readSizes[] = {64, 256, 8192};
+    auto data = generateData(16 * 1024 * 1024);
+    std::unique_ptr<v_char8[]> buffer(new v_char8[8192]);
+
+    for(v_int32 readSize : readSizes) {
+
+      OATPP_LOGI(TAG, "Read 16MB in %d-byte reads:", readSize);
+
+      v_int64 fixedCalls;
+      v_int64 adaptiveCalls;
+
+      {
+        oatpp::test::PerformanceChecker checker("Fixed 4KB buffer");
+        auto stream = std::make_shared<TestInputStream>(data);
+        auto proxy = InputStreamBufferedProxy::createShared(stream, base::StrBuffer::createShared(4096));
+        oatpp::async::Action action;
+        while(proxy->read(buffer.get(), readSize, action) > 0) {}
+        fixedCalls = stream->readCalls;
+      }
+
+      {
+        oatpp::test::PerformanceChecker checker("Adaptive 2KB..64KB buffer");
+        auto stream = std::make_shared<TestInputStream>(data);
+        auto proxy = InputStreamBufferedProxy::createShared(stream, 2048, 64 * 1024);
+        oatpp::async::Action action;
+        while(proxy->read(buffer.get(), readSize, action) > 0) {}
+        adaptiveCalls = stream->readCalls;
+      }
+
+      OATPP_LOGI(TAG, "Underlying stream reads: fixed=%d, adaptive=%d", fixedCalls, adaptiveCalls);
+      OATPP_ASSERT(adaptiveCalls <= fixedCalls);
+
+    }
+
+  }
+
+  {
+
+    const v_int32 connectionsCount = 10000;
+    OATPP_LOGI(TAG, "Buffers held by %d idle keep-alive connections:", connectionsCount);
+
+    std::vector<std::shared_ptr<InputStreamBufferedProxy>> fixed;
+    std::vector<std::shared_ptr<InputStreamBufferedProxy>> adaptive;
+    fixed.reserve(connectionsCount);
+    adaptive.reserve(connectionsCount);
+
+    oatpp::String request = "GET / HTTP/1.1\r\n\r\n";
+    v_buff_size fixedHeld = 0;
+    v_buff_size adaptiveHeld = 0;
+
+    for(v_int32 i = 0; i < connectionsCount; i ++) {
+
+      oatpp::async::Action action;
+      v_char8 buffer[100];
+
+      auto fixedStream = std::make_shared<TestInputStream>(request);
+      fixed.push_back(InputStreamBufferedProxy::createShared(fixedStream, base::StrBuffer::createShared(4096)));
+      fixed.back()->read(buffer, 100, action);
+      fixedStream->stalled = true;
+      fixed.back()->read(buffer, 100, action);
+      fixedHeld += fixed.back()->getHeldBufferSize();
+
+      auto adaptiveStream = std::make_shared<TestInputStream>(request);
+      adaptive.push_back(InputStreamBufferedProxy::createShared(adaptiveStream, 2048, 64 * 1024));
+      adaptive.back()->read(buffer, 100, action);
+      adaptiveStream->stalled = true;
+      adaptive.back()->read(buffer, 100, action);
+      adaptiveHeld += adaptive.back()->getHeldBufferSize();
+
+    }
+
+    OATPP_LOGI(TAG, "fixed=%d bytes, adaptive=%d bytes", fixedHeld, adaptiveHeld);
+    OATPP_ASSERT(fixedHeld == 4096 * connectionsCount);
+    OATPP_ASSERT(adaptiveHeld == 0);
+
+  }
+
+}
+
+}}}}}
@@ -0,0 +1,404 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "ConversionUtilsTest.hpp"
+
+#include "oatpp/core/utils/ConversionUtils.hpp"
+#include "oatpp-test/Checker.hpp"
+
+#include <cstring>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace oatpp { namespace test { namespace core { namespace utils {
+
+namespace {
+
+typedef oatpp::String String;
+namespace conversion = oatpp::utils::conversion;
+
+template<typename F, typename B>
+B floatToBits(F value) {
+  B bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+template<typename F, typename B>
+F bitsToFloat(B bits) {
+  F value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+bool checkFloat64RoundTrip(v_float64 value) {
+  v_char8 buff[32];
+  auto size = conversion::float64ToCharSequence(value, buff, 32);
+  if(size <= 0) {
+    return false;
+  }
+  v_float64 parsed;
+  auto parsedSize = conversion::charSequenceToFloat64((const char*) buff, size, parsed);
+  return parsedSize == size && floatToBits<v_float64, v_uint64>(parsed) == floatToBits<v_float64, v_uint64>(value);
+}
+
+bool checkFloat32RoundTrip(v_float32 value) {
+  v_char8 buff[32];
+  auto size = conversion::float32ToCharSequence(value, buff, 32);
+  if(size <= 0) {
+    return false;
+  }
+  v_float32 parsed;
+  auto parsedSize = conversion::charSequenceToFloat32((const char*) buff, size, parsed);
+  return parsedSize == size && floatToBits<v_float32, v_uint32>(parsed) == floatToBits<v_float32, v_uint32>(value);
+}
+
+bool checkParseFloat64(const char* text) {
+  v_float64 parsed;
+  auto size = conversion::charSequenceToFloat64(text, std::strlen(text), parsed);
+  v_float64 expected = std::strtod(text, nullptr);
+  return size == (v_buff_size) std::strlen(text) &&
+         floatToBits<v_float64, v_uint64>(parsed) == floatToBits<v_float64, v_uint64>(expected);
+}
+
+bool checkParseFloat32(const char* text) {
+  v_float32 parsed;
+  auto size = conversion::charSequenceToFloat32(text, std::strlen(text), parsed);
+  v_float32 expected = std::strtof(text, nullptr);
+  return size == (v_buff_size) std::strlen(text) &&
+         floatToBits<v_float32, v_uint32>(parsed) == floatToBits<v_float32, v_uint32>(expected);
+}
+
+}
+
+void ConversionUtilsTest::onRun() {
+
+  {
+    OATPP_LOGI(TAG, "integers to string...");
+    OATPP_ASSERT(conversion::int32ToStr(0) == "0");
+    OATPP_ASSERT(conversion::int32ToStr(-7) == "-7");
+    OATPP_ASSERT(conversion::int32ToStr(2147483647) == "2147483647");
+    OATPP_ASSERT(conversion::int32ToStr(-2147483647 - 1) == "-2147483648");
+    OATPP_ASSERT(conversion::uint32ToStr(4294967295) == "4294967295");
+    OATPP_ASSERT(conversion::int64ToStr(std::numeric_limits<v_int64>::max()) == "9223372036854775807");
+    OATPP_ASSERT(conversion::int64ToStr(std::numeric_limits<v_int64>::min()) == "-9223372036854775808");
+    OATPP_ASSERT(conversion::uint64ToStr(std::numeric_limits<v_uint64>::max()) == "18446744073709551615");
+
+    v_char8 buff[32];
+    OATPP_ASSERT(conversion::int64ToCharSequence(-100, buff, 3) == 0); // buffer too small
+
+    std::mt19937_64 random(27);
+    char expected[32];
+    for(v_int32 i = 0; i < 100000; i ++) {
+      v_uint64 value = random() >> (random() % 64);
+      auto size = conversion::uint64ToCharSequence(value, buff, 32);
+      OATPP_ASSERT(size == snprintf(expected, 32, "%llu", (unsigned long long) value));
+      OATPP_ASSERT(std::memcmp(buff, expected, size) == 0);
+      size = conversion::int64ToCharSequence(-(v_int64) (value >> 1), buff, 32);
+      OATPP_ASSERT(size == snprintf(expected, 32, "%lld", -(long long) (value >> 1)));
+      OATPP_ASSERT(std::memcmp(buff, expected, size) == 0);
+      size = conversion::int32ToCharSequence((v_int32) value, buff, 32);
+      OATPP_ASSERT(size == snprintf(expected, 32, "%d", (v_int32) value));
+      OATPP_ASSERT(std::memcmp(buff, expected, size) == 0);
+    }
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "parse integers...");
+    bool success;
+    OATPP_ASSERT(conversion::strToInt64(String("-9223372036854775808"), success) == std::numeric_limits<v_int64>::min() && success);
+    OATPP_ASSERT(conversion::strToInt64(String("9223372036854775807"), success) == std::numeric_limits<v_int64>::max() && success);
+    OATPP_ASSERT(conversion::strToInt64(String("9223372036854775808"), success) == std::numeric_limits<v_int64>::max() && success);
+    OATPP_ASSERT(conversion::strToInt64(String("-99999999999999999999999"), success) == std::numeric_limits<v_int64>::min() && success);
+    OATPP_ASSERT(conversion::strToUInt64(String("18446744073709551615"), success) == std::numeric_limits<v_uint64>::max() && success);
+    OATPP_ASSERT(conversion::strToUInt64(String("18446744073709551616"), success) == std::numeric_limits<v_uint64>::max() && success);
+    OATPP_ASSERT(conversion::strToInt32(String("+42"), success) == 42 && success);
+    OATPP_ASSERT(conversion::strToUInt32(String("-1"), success) == (v_uint32) std::strtoul("-1", nullptr, 10) && success);
+    conversion::strToInt32(String("42a"), success);
+    OATPP_ASSERT(!success);
+    conversion::strToInt32(String(""), success);
+    OATPP_ASSERT(!success);
+    OATPP_ASSERT(conversion::strToInt64(" \t-15") == -15);
+
+    v_int64 value;
+    OATPP_ASSERT(conversion::charSequenceToInt64("-", 1, value) == 0);
+    OATPP_ASSERT(conversion::charSequenceToInt64("12345", 2, value) == 2 && value == 12); // bounded by size
+    OATPP_ASSERT(conversion::charSequenceToInt64("200 OK", 6, value) == 3 && value == 200);
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+    const v_int32 numIterations = 1000000;
+    std::vector<v_int64> values;
+    values.reserve(numIterations);
+    std::mt19937_64 random(1);
+    for(v_int32 i = 0; i < numIterations; i ++) {
+      values.push_back((v_int64) (random() >> (random() % 64)));
+    }
+
+    std::vector<std::string> texts;
+    texts.reserve(numIterations);
+    v_char8 buff[32];
+    v_buff_size totalSize = 0;
+
+    {
+      PerformanceChecker checker("int64 format - snprintf(\"%lld\")");
+      for(v_int32 i = 0; i < numIterations; i ++) {
+        totalSize += snprintf((char*) buff, 32, "%lld", (long long) values[i]);
+      }
+    }
+
+    {
+      PerformanceChecker checker("int64 format - int64ToCharSequence");
+      for(v_int32 i = 0; i < numIterations; i ++) {
+        totalSize += conversion::int64ToCharSequence(values[i], buff, 32);
+      }
+    }
+
+    for(v_int32 i = 0; i < numIterations; i ++) {
+      auto size = conversion::int64ToCharSequence(values[i], buff, 32);
+      texts.push_back(std::string((const char*) buff, size));
+    }
+
+    v_int64 sum = 0;
+
+    {
+      PerformanceChecker checker("int64 parse - strtoll");
+      for(v_int32 i = 0; i < numIterations; i ++) {
+        sum += std::strtoll(texts[i].c_str(), nullptr, 10);
+      }
+    }
+
+    {
+      PerformanceChecker checker("int64 parse - charSequenceToInt64");
+      for(v_int32 i = 0; i < numIterations; i ++) {
+        v_int64 value;
+        conversion::charSequenceToInt64(texts[i].data(), texts[i].size(), value);
+        sum += value;
+      }
+    }
+
+    OATPP_LOGV(TAG, "total size=%d, sum=%lld", (v_int32) totalSize, (long long) sum);
+  }
+
+  {
+    OATPP_LOGI(TAG, "float64 to string...");
+    OATPP_ASSERT(conversion::float64ToStr(0) == "0");
+    OATPP_ASSERT(conversion::float64ToStr(-0.0) == "-0");
+    OATPP_ASSERT(conversion::float64ToStr(1) == "1");
+    OATPP_ASSERT(conversion::float64ToStr(-2.5) == "-2.5");
+    OATPP_ASSERT(conversion::float64ToStr(0.1) == "0.1");
+    OATPP_ASSERT(conversion::float64ToStr(0.1 + 0.2) == "0.30000000000000004");
+    OATPP_ASSERT(conversion::float64ToStr(101.1) == "101.1");
+    OATPP_ASSERT(conversion::float64ToStr(1e100) == "1e+100");
+    OATPP_ASSERT(conversion::float64ToStr(1.5e-7) == "1.5e-07");
+    OATPP_ASSERT(conversion::float64ToStr(0.0001) == "0.0001");
+    OATPP_ASSERT(conversion::float64ToStr(123456789012345680000.0) == "1.2345678901234568e+20");
+    OATPP_ASSERT(conversion::float64ToStr(5e-324) == "5e-324");
+    OATPP_ASSERT(conversion::float64ToStr(1.7976931348623157e308) == "1.7976931348623157e+308");
+    OATPP_ASSERT(conversion::float64ToStr(std::numeric_limits<v_float64>::infinity()) == "inf");
+    OATPP_ASSERT(conversion::float64ToStr(-std::numeric_limits<v_float64>::infinity()) == "-inf");
+    OATPP_ASSERT(conversion::float64ToStr(0.64, "%.2f") == "0.64");
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "float32 to string...");
+    OATPP_ASSERT(conversion::float32ToStr(0.32f) == "0.32");
+    OATPP_ASSERT(conversion::float32ToStr(101.1f) == "101.1");
+    OATPP_ASSERT(conversion::float32ToStr(16777216.0f) == "16777216");
+    OATPP_ASSERT(conversion::float32ToStr(3.4028235e38f) == "3.4028235e+38");
+    OATPP_ASSERT(conversion::float32ToStr(1e-45f) == "1e-45");
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "parse float64...");
+    OATPP_ASSERT(checkParseFloat64("0"));
+    OATPP_ASSERT(checkParseFloat64("-0"));
+    OATPP_ASSERT(checkParseFloat64("1.32e1"));
+    OATPP_ASSERT(checkParseFloat64("-1.32E-1"));
+    OATPP_ASSERT(checkParseFloat64("+.5"));
+    OATPP_ASSERT(checkParseFloat64("5."));
+    OATPP_ASSERT(checkParseFloat64("9007199254740993"));
+    OATPP_ASSERT(checkParseFloat64("2.2250738585072011e-308"));
+    OATPP_ASSERT(checkParseFloat64("2.2250738585072012e-308"));
+    OATPP_ASSERT(checkParseFloat64("4.9406564584124654e-324"));
+    OATPP_ASSERT(checkParseFloat64("2.4703282292062327e-324"));
+    OATPP_ASSERT(checkParseFloat64("2.4703282292062328e-324"));
+    OATPP_ASSERT(checkParseFloat64("1.7976931348623157e308"));
+    OATPP_ASSERT(checkParseFloat64("1.7976931348623159e308"));
+    OATPP_ASSERT(checkParseFloat64("1e309"));
+    OATPP_ASSERT(checkParseFloat64("1e-400"));
+    OATPP_ASSERT(checkParseFloat64("0.1000000000000000055511151231257827021181583404541015625"));
+    OATPP_ASSERT(checkParseFloat64("0.1000000000000000055511151231257827021181583404541015626"));
+    OATPP_ASSERT(checkParseFloat64("9007199254740992.000000000000000000000000000001"));
+    OATPP_ASSERT(checkParseFloat64("9007199254740993.000000000000000000000000000001"));
+    OATPP_ASSERT(checkParseFloat64("00000000000000000000000000000000000000001.5"));
+    OATPP_ASSERT(checkParseFloat64("123456789012345678901234567890e-10"));
+    OATPP_ASSERT(checkParseFloat64("Infinity"));
+    OATPP_ASSERT(checkParseFloat64("-inf"));
+
+    v_float64 value;
+    OATPP_ASSERT(conversion::charSequenceToFloat64("nan", 3, value) == 3 && value != value);
+    OATPP_ASSERT(conversion::charSequenceToFloat64("", 0, value) == 0);
+    OATPP_ASSERT(conversion::charSequenceToFloat64("-", 1, value) == 0);
+    OATPP_ASSERT(conversion::charSequenceToFloat64(".e1", 3, value) == 0);
+    OATPP_ASSERT(conversion::charSequenceToFloat64("1e", 2, value) == 1 && value == 1);
+    OATPP_ASSERT(conversion::charSequenceToFloat64("2.5}", 4, value) == 3 && value == 2.5);
+    OATPP_ASSERT(conversion::charSequenceToFloat64("12345", 3, value) == 3 && value == 123); // bounded by size
+
+    bool success;
+    OATPP_ASSERT(conversion::strToFloat64(String("0.64"), success) == 0.64 && success);
+    conversion::strToFloat64(String("0.64a"), success);
+    OATPP_ASSERT(!success);
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "parse float32...");
+    OATPP_ASSERT(checkParseFloat32("0.32"));
+    OATPP_ASSERT(checkParseFloat32("-1.32E-1"));
+    OATPP_ASSERT(checkParseFloat32("16777217"));
+    OATPP_ASSERT(checkParseFloat32("3.4028235e38"));
+    OATPP_ASSERT(checkParseFloat32("3.4028236e38"));
+    OATPP_ASSERT(checkParseFloat32("1e39"));
+    OATPP_ASSERT(checkParseFloat32("1.4e-45"));
+    OATPP_ASSERT(checkParseFloat32("7e-46"));
+    OATPP_ASSERT(checkParseFloat32("1.00000005960464477539062500000000000001"));
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "float64 random bits round-trip...");
+    std::mt19937_64 random(64);
+    for(v_int32 i = 0; i < 1000000; i ++) {
+      v_float64 value = bitsToFloat<v_float64, v_uint64>(random());
+      if(value == value) {
+        OATPP_ASSERT(checkFloat64RoundTrip(value));
+      }
+    }
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "float32 all binades round-trip...");
+    for(v_uint64 bits = 0; bits < 0x7F800000; bits += 1021) {
+      v_float32 value = bitsToFloat<v_float32, v_uint32>((v_uint32) bits);
+      OATPP_ASSERT(checkFloat32RoundTrip(value));
+      OATPP_ASSERT(checkFloat32RoundTrip(-value));
+    }
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "float32 exhaustive [1, 2) round-trip...");
+    for(v_uint32 bits = 0x3F800000; bits < 0x40000000; bits ++) {
+      OATPP_ASSERT(checkFloat32RoundTrip(bitsToFloat<v_float32, v_uint32>(bits)));
+    }
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "parse random decimals against strtod...");
+    std::mt19937_64 random(10);
+    char text[64];
+    for(v_int32 i = 0; i < 300000; i ++) {
+      v_int32 digits = 1 + (v_int32) (random() % 25);
+      v_int32 pos = 0;
+      for(v_int32 d = 0; d < digits; d ++) {
+        if(d == 1) {
+          text[pos ++] = '.';
+        }
+        text[pos ++] = (char) ('0' + random() % 10);
+      }
+      pos += snprintf(&text[pos], 16, "e%d", (v_int32) (random() % 700) - 350);
+      text[pos] = 0;
+      OATPP_ASSERT(checkParseFloat64(text));
+      OATPP_ASSERT(checkParseFloat32(text));
+    }
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+    const v_int32 numIterations = 1000000;
+    std::vector<v_float64> values;
+    values.reserve(numIterations);
+    std::mt19937_64 random(1);
+    std::uniform_real_distribution<v_float64> distribution(-1000, 1000);
+    for(v_int32 i = 0; i < numIterations; i ++) {
+      values.push_back(distribution(random));
+    }
+
+    std::vector<std::string> texts;
+    texts.reserve(numIterations);
+    v_char8 buff[32];
+    v_buff_size totalSize = 0;
+
+    {
+      PerformanceChecker checker("float64 format - snprintf(\"%.17g\")");
+      for(v_int32 i = 0; i < numIterations; i ++) {
+        totalSize += conversion::float64ToCharSequence(values[i], buff, 32, "%.17g");
+      }
+    }
+
+    {
+      PerformanceChecker checker("float64 format - shortest");
+      for(v_int32 i = 0; i < numIterations; i ++) {
+        totalSize += conversion::float64ToCharSequence(values[i], buff, 32);
+      }
+    }
+
+    for(v_int32 i = 0; i < numIterations; i ++) {
+      auto size = conversion::float64ToCharSequence(values[i], buff, 32);
+      texts.push_back(std::string((const char*) buff, size));
+    }
+
+    v_float64 sum = 0;
+
+    {
+      PerformanceChecker checker("float64 parse - strtod");
+      for(v_int32 i = 0; i < numIterations; i ++) {
+        sum += std::strtod(texts[i].c_str(), nullptr);
+      }
+    }
+
+    {
+      PerformanceChecker checker("float64 parse - charSequenceToFloat64");
+      for(v_int32 i = 0; i < numIterations; i ++) {
+        v_float64 value;
+        conversion::charSequenceToFloat64(texts[i].data(), texts[i].size(), value);
+        sum += value;
+      }
+    }
+
+    OATPP_LOGV(TAG, "total size=%d, sum=%f", (v_int32) totalSize, sum);
+  }
+
+}
+
+}}}}
@@ -27,9 +27,11 @@
 #include "oatpp/network/virtual_/Pipe.hpp"
 
 #include "oatpp/core/data/stream/ChunkedBuffer.hpp"
+#include "oatpp/core/async/Executor.hpp"
 
 #include "oatpp-test/Checker.hpp"
 
+#include <chrono>
 #include <iostream>
 #include <thread>
 
@@ -131,6 +133,263 @@ namespace {
     
   }
   
+
+  v_int64 getMicroTickCount() {
+    return std::chrono::duration_cast<std::chrono::microseconds>
+      (std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
+  void logThroughput(const char* tag, v_int64 bytes, v_int64 micro) {
+    OATPP_LOGD("throughput", "%s: %d MB in %d(micro) - %d MB/s",
+               tag, (v_int32)(bytes >> 20), (v_int32) micro, (v_int32)((bytes >> 20) * 1000000 / (micro > 0 ? micro : 1)));
+  }
+
+  void runThroughput(v_int64 bytesToTransfer, v_buff_size blockSize, bool zeroCopy) {
+
+    auto pipe = Pipe::createShared(zeroCopy);
+
+    v_int64 start = getMicroTickCount();
+
+    std::thread writerThread([pipe, bytesToTransfer, blockSize]{
+      std::unique_ptr<v_char8[]> block(new v_char8[blockSize]);
+      std::memset(block.get(), 'x', blockSize);
+      v_int64 transferred = 0;
+      while(transferred < bytesToTransfer) {
+        v_buff_size size = blockSize;
+        if(size > bytesToTransfer - transferred) {
+          size = (v_buff_size)(bytesToTransfer - transferred);
+        }
+        OATPP_ASSERT(pipe->getWriter()->writeExactSizeDataSimple(block.get(), size) == size);
+        transferred += size;
+      }
+    });
+
+    std::thread readerThread([pipe, bytesToTransfer, blockSize]{
+      std::unique_ptr<v_char8[]> block(new v_char8[blockSize]);
+      v_int64 transferred = 0;
+      while(transferred < bytesToTransfer) {
+        auto res = pipe->getReader()->readSimple(block.get(), blockSize);
+        OATPP_ASSERT(res > 0);
+        OATPP_ASSERT(block[0] == 'x' && block[res - 1] == 'x');
+        transferred += res;
+      }
+    });
+
+    writerThread.join();
+    readerThread.join();
+
+    logThroughput(zeroCopy ? "blocking, zero-copy pipe" : "blocking", bytesToTransfer, getMicroTickCount() - start);
+
+  }
+
+  void runSliceThroughput(v_int64 bytesToTransfer, v_buff_size blockSize) {
+
+    auto pipe = Pipe::createShared(true);
+
+    v_int64 start = getMicroTickCount();
+
+    std::thread writerThread([pipe, bytesToTransfer, blockSize]{
+      oatpp::String block(blockSize);
+      std::memset(block->getData(), 'x', blockSize);
+      v_int64 transferred = 0;
+      while(transferred < bytesToTransfer) {
+        v_buff_size size = blockSize;
+        if(size > bytesToTransfer - transferred) {
+          size = (v_buff_size)(bytesToTransfer - transferred);
+        }
+        oatpp::async::Action action;
+        OATPP_ASSERT(pipe->getWriter()->writeSlice({block.getPtr(), block->getData(), size}, action) == size);
+        transferred += size;
+      }
+    });
+
+    std::thread readerThread([pipe, bytesToTransfer, blockSize]{
+      v_int64 transferred = 0;
+      while(transferred < bytesToTransfer) {
+        oatpp::data::buffer::BufferChain::Slice slice;
+        oatpp::async::Action action;
+        auto res = pipe->getReader()->readSlice(slice, blockSize, action);
+        OATPP_ASSERT(res > 0 && res == slice.size);
+        OATPP_ASSERT(slice.data[0] == 'x' && slice.data[res - 1] == 'x');
+        transferred += res;
+      }
+    });
+
+    writerThread.join();
+    readerThread.join();
+
+    logThroughput("blocking, slice handoff", bytesToTransfer, getMicroTickCount() - start);
+
+  }
+
+  void testSliceHandoff() {
+
+    oatpp::String data1 = "Hello";
+    oatpp::String data2 = "World";
+
+    {
+      auto pipe = Pipe::createShared(true);
+      OATPP_ASSERT(pipe->isZeroCopy());
+
+      oatpp::async::Action action;
+      OATPP_ASSERT(pipe->getWriter()->writeSlice({data1.getPtr(), data1->getData(), data1->getSize()}, action) == 5);
+      OATPP_ASSERT(pipe->getWriter()->write(" ", 1, action) == 1);
+      OATPP_ASSERT(pipe->getWriter()->writeSlice({data2.getPtr(), data2->getData(), data2->getSize()}, action) == 5);
+
+      oatpp::data::buffer::BufferChain::Slice slice;
+
+      /* Slice is passed by reference */
+      OATPP_ASSERT(pipe->getReader()->readSlice(slice, 3, action) == 3);
+      OATPP_ASSERT(slice.data == data1->getData() && slice.owner.get() == data1.get());
+      OATPP_ASSERT(pipe->getReader()->readSlice(slice, 100, action) == 2);
+      OATPP_ASSERT(slice.data == data1->getData() + 3);
+
+      /* Regular read crosses slices */
+      v_char8 buffer[16];
+      OATPP_ASSERT(pipe->getReader()->read(buffer, 16, action) == 6);
+      OATPP_ASSERT(std::memcmp(buffer, " World", 6) == 0);
+
+      /* Data written before close is still readable */
+      OATPP_ASSERT(pipe->getWriter()->writeSlice({data2.getPtr(), data2->getData(), data2->getSize()}, action) == 5);
+      pipe->close();
+      OATPP_ASSERT(pipe->getReader()->readSlice(slice, 100, action) == 5);
+      OATPP_ASSERT(slice.data == data2->getData());
+      OATPP_ASSERT(pipe->getReader()->readSlice(slice, 100, action) == oatpp::IOError::BROKEN_PIPE);
+    }
+
+    {
+      auto pipe = Pipe::createShared();
+      OATPP_ASSERT(!pipe->isZeroCopy());
+
+      /* Regular pipe copies slice data */
+      oatpp::async::Action action;
+      OATPP_ASSERT(pipe->getWriter()->writeSlice({data1.getPtr(), data1->getData(), data1->getSize()}, action) == 5);
+      oatpp::data::buffer::BufferChain::Slice slice;
+      OATPP_ASSERT(pipe->getReader()->readSlice(slice, 100, action) == 5);
+      OATPP_ASSERT(slice.data != data1->getData());
+      OATPP_ASSERT(std::memcmp(slice.data, "Hello", 5) == 0);
+    }
+
+  }
+
+  void runLatency(v_int32 roundTrips) {
+
+    auto pipeIn = Pipe::createShared();
+    auto pipeOut = Pipe::createShared();
+
+    std::thread echoThread([pipeIn, pipeOut, roundTrips]{
+      v_char8 byte;
+      for(v_int32 i = 0; i < roundTrips; i ++) {
+        OATPP_ASSERT(pipeIn->getReader()->readSimple(&byte, 1) == 1);
+        OATPP_ASSERT(pipeOut->getWriter()->writeSimple(&byte, 1) == 1);
+      }
+    });
+
+    v_int64 start = getMicroTickCount();
+
+    for(v_int32 i = 0; i < roundTrips; i ++) {
+      v_char8 byte = (v_char8) i;
+      OATPP_ASSERT(pipeIn->getWriter()->writeSimple(&byte, 1) == 1);
+      OATPP_ASSERT(pipeOut->getReader()->readSimple(&byte, 1) == 1);
+      OATPP_ASSERT(byte == (v_char8) i);
+    }
+
+    v_int64 micro = getMicroTickCount() - start;
+    echoThread.join();
+
+    OATPP_LOGD("latency", "%d round trips in %d(micro) - %d(nano) per round trip",
+               roundTrips, (v_int32) micro, (v_int32)(micro * 1000 / roundTrips));
+
+  }
+
+  class AsyncWriterCoroutine : public oatpp::async::Coroutine<AsyncWriterCoroutine> {
+  private:
+    std::shared_ptr<Pipe> m_pipe;
+    v_int64 m_bytesLeft;
+    v_char8 m_block[4096];
+  public:
+
+    AsyncWriterCoroutine(const std::shared_ptr<Pipe>& pipe, v_int64 bytesToTransfer)
+      : m_pipe(pipe)
+      , m_bytesLeft(bytesToTransfer)
+    {
+      std::memset(m_block, 'x', sizeof(m_block));
+    }
+
+    Action act() override {
+      if(m_bytesLeft == 0) {
+        return finish();
+      }
+      v_buff_size size = sizeof(m_block);
+      if(size > m_bytesLeft) {
+        size = (v_buff_size) m_bytesLeft;
+      }
+      async::Action action;
+      auto res = m_pipe->getWriter()->write(m_block, size, action);
+      if(!action.isNone()) {
+        return action;
+      }
+      OATPP_ASSERT(res > 0);
+      m_bytesLeft -= res;
+      return repeat();
+    }
+
+  };
+
+  class AsyncReaderCoroutine : public oatpp::async::Coroutine<AsyncReaderCoroutine> {
+  private:
+    std::shared_ptr<Pipe> m_pipe;
+    v_int64 m_bytesLeft;
+    std::atomic<v_int64>* m_finishTime;
+    v_char8 m_block[4096];
+  public:
+
+    AsyncReaderCoroutine(const std::shared_ptr<Pipe>& pipe, v_int64 bytesToTransfer, std::atomic<v_int64>* finishTime)
+      : m_pipe(pipe)
+      , m_bytesLeft(bytesToTransfer)
+      , m_finishTime(finishTime)
+    {}
+
+    Action act() override {
+      if(m_bytesLeft == 0) {
+        m_finishTime->store(getMicroTickCount());
+        return finish();
+      }
+      async::Action action;
+      auto res = m_pipe->getReader()->read(m_block, sizeof(m_block), action);
+      if(!action.isNone()) {
+        return action;
+      }
+      OATPP_ASSERT(res > 0);
+      OATPP_ASSERT(m_block[0] == 'x' && m_block[res - 1] == 'x');
+      m_bytesLeft -= res;
+      return repeat();
+    }
+
+  };
+
+  void runAsyncThroughput(v_int64 bytesToTransfer) {
+
+    auto pipe = Pipe::createShared();
+    pipe->getWriter()->setOutputStreamIOMode(oatpp::data::stream::IOMode::ASYNCHRONOUS);
+    pipe->getReader()->setInputStreamIOMode(oatpp::data::stream::IOMode::ASYNCHRONOUS);
+
+    oatpp::async::Executor executor(2, 1, 1);
+
+    std::atomic<v_int64> finishTime(0);
+    v_int64 start = getMicroTickCount();
+
+    executor.execute<AsyncReaderCoroutine>(pipe, bytesToTransfer, &finishTime);
+    executor.execute<AsyncWriterCoroutine>(pipe, bytesToTransfer);
+    executor.waitTasksFinished();
+
+    logThroughput("async", bytesToTransfer, finishTime.load() - start);
+
+    executor.stop();
+    executor.join();
+
+  }
+
 }
   
 void PipeTest::onRun() {
@@ -144,6 +403,19 @@ void PipeTest::onRun() {
   runTransfer(pipe, chunkCount, false, true);
   runTransfer(pipe, chunkCount, true, true);
 
+  auto zeroCopyPipe = Pipe::createShared(true);
+
+  runTransfer(zeroCopyPipe, chunkCount, false, false);
+  runTransfer(zeroCopyPipe, chunkCount, true, true);
+
+  testSliceHandoff();
+
+  runThroughput(64 * 1024 * 1024, 16 * 1024, false);
+  runThroughput(64 * 1024 * 1024, 16 * 1024, true);
+  runSliceThroughput(64 * 1024 * 1024, 16 * 1024);
+  runLatency(10000);
+  runAsyncThroughput(64 * 1024 * 1024);
+
 }
   
 }}}}
@@ -0,0 +1,259 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "ObjectMapperTest.hpp"
+
+#include "oatpp/parser/cbor/mapping/ObjectMapper.hpp"
+#include "oatpp/parser/json/mapping/ObjectMapper.hpp"
+#include "oatpp/core/macro/codegen.hpp"
+
+#include <limits>
+
+namespace oatpp { namespace test { namespace parser { namespace cbor { namespace mapping {
+
+namespace {
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+ENUM(Enum1, v_int32,
+  VALUE(V1, 10, "enum1-v1"),
+  VALUE(V2, 20, "enum1-v2")
+);
+
+class Child : public oatpp::Object {
+
+  DTO_INIT(Child, Object)
+
+  DTO_FIELD(String, name);
+  DTO_FIELD(Int64, value);
+
+};
+
+class Root : public oatpp::Object {
+
+  DTO_INIT(Root, Object)
+
+  DTO_FIELD(String, field_string, "string-field");
+  DTO_FIELD(Int8, field_int8);
+  DTO_FIELD(UInt8, field_uint8);
+  DTO_FIELD(Int16, field_int16);
+  DTO_FIELD(UInt16, field_uint16);
+  DTO_FIELD(Int32, field_int32);
+  DTO_FIELD(UInt32, field_uint32);
+  DTO_FIELD(Int64, field_int64);
+  DTO_FIELD(UInt64, field_uint64);
+  DTO_FIELD(Float32, field_float32);
+  DTO_FIELD(Float64, field_float64);
+  DTO_FIELD(Boolean, field_boolean);
+  DTO_FIELD(Enum<Enum1>::AsString, field_enum_string);
+  DTO_FIELD(Enum<Enum1>::AsNumber, field_enum_number);
+  DTO_FIELD(Vector<List<String>>, field_vector);
+  DTO_FIELD(List<Child>, field_list);
+  DTO_FIELD(UnorderedSet<String>, field_set);
+  DTO_FIELD(Fields<Child>, field_fields);
+  DTO_FIELD(UnorderedFields<Float64>, field_unordered_fields);
+  DTO_FIELD(Child, child);
+  DTO_FIELD(Child, child_null);
+  DTO_FIELD(Any, field_any);
+
+};
+
+class Strict : public oatpp::Object {
+
+  DTO_INIT(Strict, Object)
+
+  DTO_FIELD(Int8, value);
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+oatpp::String fromHex(const char* hex) {
+  v_buff_size size = std::strlen(hex) / 2;
+  oatpp::String result(size);
+  for(v_buff_size i = 0; i < size; i ++) {
+    result->getData()[i] = (v_char8) std::stoi(std::string(hex + i * 2, 2), nullptr, 16);
+  }
+  return result;
+}
+
+}
+
+void ObjectMapperTest::onRun() {
+
+  oatpp::parser::cbor::mapping::ObjectMapper mapper;
+  oatpp::parser::json::mapping::ObjectMapper jsonMapper;
+
+  {
+    OATPP_LOGI(TAG, "Encoding...");
+
+    OATPP_ASSERT(mapper.writeToString(oatpp::Int32(0)) == fromHex("00"));
+    OATPP_ASSERT(mapper.writeToString(oatpp::Int32(23)) == fromHex("17"));
+    OATPP_ASSERT(mapper.writeToString(oatpp::Int32(24)) == fromHex("1818"));
+    OATPP_ASSERT(mapper.writeToString(oatpp::Int32(1000)) == fromHex("1903e8"));
+    OATPP_ASSERT(mapper.writeToString(oatpp::Int32(1000000)) == fromHex("1a000f4240"));
+    OATPP_ASSERT(mapper.writeToString(oatpp::UInt64(18446744073709551615ULL)) == fromHex("1bffffffffffffffff"));
+    OATPP_ASSERT(mapper.writeToString(oatpp::Int64(-1)) == fromHex("20"));
+    OATPP_ASSERT(mapper.writeToString(oatpp::Int64(-1000)) == fromHex("3903e7"));
+    OATPP_ASSERT(mapper.writeToString(oatpp::Float64(1.1)) == fromHex("fb3ff199999999999a"));
+    OATPP_ASSERT(mapper.writeToString(oatpp::Float32(100000.0f)) == fromHex("fa47c35000"));
+    OATPP_ASSERT(mapper.writeToString(oatpp::Boolean(false)) == fromHex("f4"));
+    OATPP_ASSERT(mapper.writeToString(oatpp::Boolean(true)) == fromHex("f5"));
+    OATPP_ASSERT(mapper.writeToString(oatpp::String(nullptr)) == fromHex("f6"));
+    OATPP_ASSERT(mapper.writeToString(oatpp::String("IETF")) == fromHex("6449455446"));
+    OATPP_ASSERT(mapper.writeToString(oatpp::List<oatpp::Int32>({1, 2, 3})) == fromHex("83010203"));
+    OATPP_ASSERT(mapper.writeToString(oatpp::Fields<oatpp::Int32>({{"a", 1}, {"b", 2}})) == fromHex("a26161016162" "02"));
+
+    OATPP_LOGI(TAG, "Encoding - OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "Round trip...");
+
+    auto root = Root::createShared();
+    root->field_string = "hello \xD1\x84";
+    root->field_int8 = std::numeric_limits<v_int8>::min();
+    root->field_uint8 = std::numeric_limits<v_uint8>::max();
+    root->field_int16 = std::numeric_limits<v_int16>::min();
+    root->field_uint16 = std::numeric_limits<v_uint16>::max();
+    root->field_int32 = std::numeric_limits<v_int32>::min();
+    root->field_uint32 = std::numeric_limits<v_uint32>::max();
+    root->field_int64 = std::numeric_limits<v_int64>::min();
+    root->field_uint64 = std::numeric_limits<v_uint64>::max();
+    root->field_float32 = 0.1f;
+    root->field_float64 = -0.1;
+    root->field_boolean = false;
+    root->field_enum_string = Enum1::V2;
+    root->field_enum_number = Enum1::V1;
+    root->field_vector = {{"a", "b"}, oatpp::List<oatpp::String>::createShared(), nullptr, {"c"}};
+    root->field_list = {Child::createShared(), nullptr};
+    root->field_list[0]->name = "c1";
+    root->field_list[0]->value = -1;
+    root->field_set = {"x"};
+    root->field_fields = {{"k1", Child::createShared()}, {"k2", nullptr}};
+    root->field_unordered_fields = {{"f", 0.5}};
+    root->child = Child::createShared();
+    root->child->name = "child";
+    root->child->value = 9007199254740993LL;
+    auto anyList = oatpp::List<oatpp::Any>({oatpp::Int64(1), oatpp::String("2"), oatpp::Boolean(false)});
+    anyList->push_back(nullptr);
+    root->field_any = oatpp::Fields<oatpp::Any>({{"list", anyList}, {"number", oatpp::Float64(3.5)}});
+
+    auto data = mapper.writeToString(root);
+    auto result = mapper.readFromString<Root>(data);
+
+    OATPP_LOGD(TAG, "cbor size=%d, json size=%d", data->getSize(), jsonMapper.writeToString(root)->getSize());
+
+    OATPP_ASSERT(result->field_string == root->field_string);
+    OATPP_ASSERT(result->field_int8 == root->field_int8);
+    OATPP_ASSERT(result->field_uint8 == root->field_uint8);
+    OATPP_ASSERT(result->field_int16 == root->field_int16);
+    OATPP_ASSERT(result->field_uint16 == root->field_uint16);
+    OATPP_ASSERT(result->field_int32 == root->field_int32);
+    OATPP_ASSERT(result->field_uint32 == root->field_uint32);
+    OATPP_ASSERT(result->field_int64 == root->field_int64);
+    OATPP_ASSERT(result->field_uint64 == root->field_uint64);
+    OATPP_ASSERT(result->field_float32 == root->field_float32);
+    OATPP_ASSERT(result->field_float64 == root->field_float64);
+    OATPP_ASSERT(result->field_boolean.get() != nullptr && result->field_boolean == false);
+    OATPP_ASSERT(result->field_enum_string == Enum1::V2);
+    OATPP_ASSERT(result->field_enum_number == Enum1::V1);
+    OATPP_ASSERT(result->field_vector[2] == nullptr);
+    OATPP_ASSERT(result->field_list[1] == nullptr);
+    OATPP_ASSERT(result->field_set->size() == 1);
+    OATPP_ASSERT(result->field_fields["k2"] == nullptr);
+    OATPP_ASSERT(result->field_unordered_fields["f"] == 0.5);
+    OATPP_ASSERT(result->child->value == 9007199254740993LL);
+    OATPP_ASSERT(result->child_null == nullptr);
+
+    OATPP_ASSERT(result->field_any.getStoredType() == oatpp::Fields<oatpp::Any>::Class::getType());
+    OATPP_ASSERT(result->field_any.retrieve<oatpp::Fields<oatpp::Any>>()->size() == 2);
+
+    OATPP_ASSERT(jsonMapper.writeToString(result) == jsonMapper.writeToString(root));
+
+    auto config = oatpp::parser::cbor::mapping::Serializer::Config::createShared();
+    config->includeNullFields = false;
+    oatpp::parser::cbor::mapping::ObjectMapper noNullsMapper(config, oatpp::parser::cbor::mapping::Deserializer::Config::createShared());
+    auto noNullsData = noNullsMapper.writeToString(root);
+    OATPP_ASSERT(noNullsData->getSize() < data->getSize());
+    result = mapper.readFromString<Root>(noNullsData);
+    OATPP_ASSERT(result->child_null == nullptr);
+    OATPP_ASSERT(result->field_vector->size() == 3);
+
+    OATPP_LOGI(TAG, "Round trip - OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "Decoding...");
+
+    // indefinite length map, array, and text string; tag; half float; unknown field
+    auto data = fromHex("bf" "6c737472696e672d6669656c64" "7f" "626869" "62216f" "ff"
+                        "6a6669656c645f6c697374" "9f" "a1646e616d65626331" "f6" "ff"
+                        "67756e6b6e6f776e" "9f01a1616102ff"
+                        "6d6669656c645f666c6f61743634" "c1f93e00"
+                        "ff");
+    auto result = mapper.readFromString<Root>(data);
+    OATPP_ASSERT(result->field_string == "hi!o");
+    OATPP_ASSERT(result->field_list->size() == 2);
+    OATPP_ASSERT(result->field_list[0]->name == "c1");
+    OATPP_ASSERT(result->field_list[1] == nullptr);
+    OATPP_ASSERT(result->field_float64 == 1.5);
+
+    OATPP_LOGI(TAG, "Decoding - OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "Errors...");
+
+    auto checkError = [](oatpp::parser::cbor::mapping::ObjectMapper& m, const char* hex, v_int64 code) {
+      bool error = false;
+      try {
+        m.readFromString<Strict>(fromHex(hex));
+      } catch (const oatpp::parser::ParsingError& e) {
+        OATPP_LOGD("ObjectMapperTest", "error - %s", e.what());
+        OATPP_ASSERT(e.getCode() == code);
+        error = true;
+      }
+      OATPP_ASSERT(error);
+    };
+
+    checkError(mapper, "a16576616c7565", oatpp::parser::cbor::Utils::ERROR_CODE_UNEXPECTED_END);
+    checkError(mapper, "a16576616c75", oatpp::parser::cbor::Utils::ERROR_CODE_UNEXPECTED_END);
+    checkError(mapper, "a16576616c75651a", oatpp::parser::cbor::Utils::ERROR_CODE_UNEXPECTED_END);
+    checkError(mapper, "a16576616c75651c", oatpp::parser::cbor::Utils::ERROR_CODE_INVALID_HEAD);
+    checkError(mapper, "a16576616c7565190100", oatpp::parser::cbor::mapping::Deserializer::ERROR_CODE_VALUE_OUT_OF_RANGE);
+    checkError(mapper, "a16576616c75656131", oatpp::parser::cbor::mapping::Deserializer::ERROR_CODE_UNEXPECTED_TYPE);
+    checkError(mapper, "8101", oatpp::parser::cbor::mapping::Deserializer::ERROR_CODE_UNEXPECTED_TYPE);
+
+    auto config = oatpp::parser::cbor::mapping::Deserializer::Config::createShared();
+    config->allowUnknownFields = false;
+    oatpp::parser::cbor::mapping::ObjectMapper strictMapper(oatpp::parser::cbor::mapping::Serializer::Config::createShared(), config);
+    checkError(strictMapper, "a1617801", oatpp::parser::cbor::mapping::Deserializer::ERROR_CODE_OBJECT_SCOPE_UNKNOWN_FIELD);
+
+    OATPP_LOGI(TAG, "Errors - OK");
+  }
+
+}
+
+}}}}}
@@ -27,8 +27,10 @@
 #include "oatpp/parser/json/mapping/ObjectMapper.hpp"
 #include "oatpp/parser/json/mapping/Serializer.hpp"
 #include "oatpp/parser/json/mapping/Deserializer.hpp"
+#include "oatpp/parser/cbor/mapping/ObjectMapper.hpp"
 
 #include "oatpp/core/data/stream/BufferStream.hpp"
+#include "oatpp/core/utils/ConversionUtils.hpp"
 
 #include "oatpp/core/macro/basic.hpp"
 #include "oatpp/core/macro/codegen.hpp"
@@ -96,6 +98,198 @@ void DTOMapperPerfTest::onRun() {
     }
   }
 
+  {
+    auto list = oatpp::List<Test1>::createShared();
+    for(v_int32 i = 0; i < 10000; i ++) {
+      list->push_back(Test1::createTestInstance());
+    }
+    PerformanceChecker checker("Serializer - list of 10k objects x 100");
+    for(v_int32 i = 0; i < 100; i ++) {
+      mapper->writeToString(list);
+    }
+  }
+
+  auto staticMapper = oatpp::parser::json::mapping::ObjectMapper::createShared();
+  staticMapper->registerStaticMapping<Test1>();
+
+  OATPP_ASSERT(staticMapper->writeToString(test1) == test1_Text);
+
+  {
+    PerformanceChecker checker("Static Serializer");
+    for(v_int32 i = 0; i < numIterations; i ++) {
+      staticMapper->writeToString(test1);
+    }
+  }
+
+  {
+    PerformanceChecker checker("Static Deserializer");
+    oatpp::parser::Caret caret(test1_Text);
+    for(v_int32 i = 0; i < numIterations; i ++) {
+      caret.setPosition(0);
+      staticMapper->readFromCaret<Test1>(caret);
+    }
+  }
+
+  {
+    /* large document where only a few fields are known to the DTO */
+    oatpp::data::stream::BufferOutputStream stream;
+    stream << "{\"unknown_head\":\"" << oatpp::String(std::string(1000, 'x').c_str()) << "\",";
+    for(v_int32 i = 0; i < 250; i ++) {
+      stream << "\"unknown_" << i << "\":{\"id\":" << i << ",\"name\":\"item \\\"" << i << "\\\" {[\",";
+      stream << "\"tags\":[\"a\",\"b\",\"c\\\\\"],\"nested\":{\"list\":[1,2,3,[4,5,{\"x\":\"}]\"}]],";
+      stream << "\"text\":\"Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt\"}},";
+      if(i == 125) {
+        stream << "\"field_string\":\"String Field\",";
+      }
+    }
+    stream << "\"field_int32\":5,\"field_list\":[1,2,3]}";
+    auto document = stream.toString();
+
+    auto obj = mapper->readFromString<Test1>(document);
+    OATPP_ASSERT(obj->field_string == "String Field");
+    OATPP_ASSERT(obj->field_int32 == 5);
+    OATPP_ASSERT(obj->field_list->size() == 3);
+
+    OATPP_LOGD(TAG, "Document size=%d", document->getSize());
+    PerformanceChecker checker("Deserializer - 3 known fields of large document x 10000");
+    oatpp::parser::Caret caret(document);
+    for(v_int32 i = 0; i < 10000; i ++) {
+      caret.setPosition(0);
+      mapper->readFromCaret<Test1>(caret);
+    }
+  }
+
+  {
+    /* arrays and maps of 100k elements */
+    v_int32 numElements = 100000;
+
+    auto list = oatpp::List<oatpp::Int32>::createShared();
+    auto map = oatpp::UnorderedFields<oatpp::Int32>::createShared();
+    for(v_int32 i = 0; i < numElements; i ++) {
+      list->push_back(i);
+      map[oatpp::utils::conversion::int32ToStr(i)] = i;
+    }
+    auto listJson = mapper->writeToString(list);
+    auto mapJson = mapper->writeToString(map);
+
+    {
+      PerformanceChecker checker("Deserializer - List of 100k x 10");
+      for(v_int32 i = 0; i < 10; i ++) {
+        auto result = mapper->readFromString<oatpp::List<oatpp::Int32>>(listJson);
+        OATPP_ASSERT((v_int32) result->size() == numElements);
+      }
+    }
+
+    {
+      PerformanceChecker checker("Deserializer - Vector of 100k x 10");
+      for(v_int32 i = 0; i < 10; i ++) {
+        auto result = mapper->readFromString<oatpp::Vector<oatpp::Int32>>(listJson);
+        OATPP_ASSERT((v_int32) result->size() == numElements);
+      }
+    }
+
+    {
+      PerformanceChecker checker("Deserializer - UnorderedFields of 100k x 10");
+      for(v_int32 i = 0; i < 10; i ++) {
+        auto result = mapper->readFromString<oatpp::UnorderedFields<oatpp::Int32>>(mapJson);
+        OATPP_ASSERT((v_int32) result->size() == numElements);
+      }
+    }
+
+    {
+      PerformanceChecker checker("List of 100k - create, iterate, destroy x 10");
+      for(v_int32 i = 0; i < 10; i ++) {
+        auto result = oatpp::List<oatpp::Int32>::createShared();
+        for(v_int32 j = 0; j < numElements; j ++) {
+          result->push_back(j);
+        }
+        v_int64 sum = 0;
+        for(auto& item : *result) {
+          sum += item;
+        }
+        OATPP_ASSERT(sum == (v_int64) numElements * (numElements - 1) / 2);
+      }
+    }
+
+  }
+
+  {
+    /* list of 10k objects - heap vs pooled allocation */
+    auto deserializerConfig = Deserializer::Config::createShared();
+    deserializerConfig->usePooledAllocation = true;
+    auto pooledMapper = oatpp::parser::json::mapping::ObjectMapper::createShared(Serializer::Config::createShared(), deserializerConfig);
+
+    auto list = oatpp::List<Test1>::createShared();
+    for(v_int32 i = 0; i < 10000; i ++) {
+      list->push_back(Test1::createTestInstance());
+    }
+    auto listJson = mapper->writeToString(list);
+
+    auto pooledList = pooledMapper->readFromString<oatpp::List<Test1>>(listJson);
+    OATPP_ASSERT(pooledMapper->writeToString(pooledList) == listJson);
+    OATPP_ASSERT(!oatpp::base::memory::PooledAllocation::isEnabled());
+
+    {
+      PerformanceChecker checker("Deserializer - list of 10k objects x 100");
+      for(v_int32 i = 0; i < 100; i ++) {
+        mapper->readFromString<oatpp::List<Test1>>(listJson);
+      }
+    }
+
+    {
+      PerformanceChecker checker("Deserializer (pooled) - list of 10k objects x 100");
+      for(v_int32 i = 0; i < 100; i ++) {
+        pooledMapper->readFromString<oatpp::List<Test1>>(listJson);
+      }
+    }
+
+    auto pooledStaticMapper = oatpp::parser::json::mapping::ObjectMapper::createShared(Serializer::Config::createShared(), deserializerConfig);
+    pooledStaticMapper->registerStaticMapping<Test1>();
+
+    auto pooledStaticList = pooledStaticMapper->readFromString<oatpp::List<Test1>>(listJson);
+    OATPP_ASSERT(pooledStaticMapper->writeToString(pooledStaticList) == listJson);
+    OATPP_ASSERT(!oatpp::base::memory::PooledAllocation::isEnabled());
+
+    {
+      PerformanceChecker checker("Static Deserializer (pooled) - list of 10k objects x 100");
+      for(v_int32 i = 0; i < 100; i ++) {
+        pooledStaticMapper->readFromString<oatpp::List<Test1>>(listJson);
+      }
+    }
+
+  }
+
+  auto cborMapper = oatpp::parser::cbor::mapping::ObjectMapper::createShared();
+  auto test1_Cbor = cborMapper->writeToString(test1);
+
+  {
+    auto list = oatpp::List<Test1>::createShared();
+    for(v_int32 i = 0; i < 10000; i ++) {
+      list->push_back(Test1::createTestInstance());
+    }
+    auto jsonSize = mapper->writeToString(list)->getSize();
+    auto cborSize = cborMapper->writeToString(list)->getSize();
+    OATPP_LOGD(TAG, "Size: object json=%d, cbor=%d. List of 10k objects json=%d, cbor=%d",
+               test1_Text->getSize(), test1_Cbor->getSize(), jsonSize, cborSize);
+    OATPP_ASSERT(cborSize < jsonSize);
+  }
+
+  {
+    PerformanceChecker checker("CBOR Serializer");
+    for(v_int32 i = 0; i < numIterations; i ++) {
+      cborMapper->writeToString(test1);
+    }
+  }
+
+  {
+    PerformanceChecker checker("CBOR Deserializer");
+    oatpp::parser::Caret caret(test1_Cbor);
+    for(v_int32 i = 0; i < numIterations; i ++) {
+      caret.setPosition(0);
+      cborMapper->readFromCaret<Test1>(caret);
+    }
+  }
+
 }
   
 }}}}}
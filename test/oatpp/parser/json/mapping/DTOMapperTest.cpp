@@ -268,6 +268,31 @@ void DTOMapperTest::onRun(){
   
   OATPP_LOGV(TAG, "json='%s'", (const char*) result->getData());
 
+  {
+
+    OATPP_LOGI(TAG, "Static mapping...");
+
+    auto staticMapper = oatpp::parser::json::mapping::ObjectMapper::createShared();
+    staticMapper->getSerializer()->getConfig()->useBeautifier = true;
+    staticMapper->registerStaticMapping<Test>();
+
+    OATPP_ASSERT(staticMapper->writeToString(obj) == result);
+
+    auto staticObj = staticMapper->readFromString<Test>(result);
+    OATPP_ASSERT(staticObj);
+    OATPP_ASSERT(staticObj->field_string == test1->field_string);
+    OATPP_ASSERT(staticObj->field_int32 == test1->field_int32);
+    OATPP_ASSERT(staticObj->field_float64 == test1->field_float64);
+    OATPP_ASSERT(staticObj->obj1);
+    OATPP_ASSERT(staticObj->obj1->field_list_object->size() == test1->obj1->field_list_object->size());
+    OATPP_ASSERT(staticObj->field_unordered_fields["key2"] == "map_item2");
+
+    OATPP_ASSERT(staticMapper->writeToString(staticObj) == mapper->writeToString(staticObj));
+
+    OATPP_LOGI(TAG, "Static mapping - OK");
+
+  }
+
   {
 
     TestAny::ObjectWrapper::__Wrapper objOW1;
@@ -25,8 +25,12 @@
 #include "DeserializerTest.hpp"
 
 #include "oatpp/parser/json/mapping/ObjectMapper.hpp"
+#include "oatpp/parser/json/StructuralIndex.hpp"
+#include "oatpp/core/utils/ConversionUtils.hpp"
 #include "oatpp/core/macro/codegen.hpp"
 
+#include <cstring>
+
 namespace oatpp { namespace test { namespace parser { namespace json { namespace mapping {
 
 namespace {
@@ -176,6 +180,74 @@ void DeserializerTest::onRun(){
   OATPP_ASSERT(obj4->list->size() == 0);
   OATPP_ASSERT(obj4->map->size() == 0);
 
+  // Skip unknown fields
+
+  const char* const unknownValues[] = {
+    "{\"a\":\"}\\\"{\",\"b\":[1,{\"c\":\"\\\\\"}],\"d\":\"\\\\\\\"}\"}",
+    "[\"]\",\"\\\\\",[[]],{\"x\":\"[\"},[\"\\\\\\\\\\\"]\"]]",
+    "\"string with \\\" escaped quote, {braces} and [brackets] \\\\\"",
+    "\"\\\\\\\\\\\\\\\\\\\\\\\\\\\\\"",
+    "{\"k\":{\"k\":{\"k\":{\"k\":\"}}}}\"}}}}",
+    "-12.5e3",
+    "null"
+  };
+
+  for(auto value : unknownValues) {
+    for(v_int32 padding = 0; padding < 140; padding ++) {
+      oatpp::String json = oatpp::String("{\"pad\":\"") + oatpp::String(std::string(padding, 'p').c_str()) +
+                           "\",\"unknown\":" + value + ",\"strF\":\"value1\"}";
+      auto obj = mapper->readFromString<Test1>(json);
+      OATPP_ASSERT(obj);
+      OATPP_ASSERT(obj->strF == "value1");
+    }
+  }
+
+  // Items pre-count
+
+  typedef oatpp::parser::json::StructuralIndex StructuralIndex;
+  auto countItems = [](const char* text) {
+    return StructuralIndex::countItems((const v_char8*) text, std::strlen(text));
+  };
+
+  OATPP_ASSERT(countItems("[1]") == 1);
+  OATPP_ASSERT(countItems("[1, 2 ,3]") == 3);
+  OATPP_ASSERT(countItems("[\"a,b\", [1, 2], {\"x\": 1, \"y\": \"]\"}, \"\\\",\"]") == 4);
+  OATPP_ASSERT(countItems("{\"a\": 1, \"b,c\": [1, 2]}") == 2);
+  OATPP_ASSERT(countItems("[1, 2") == -1);
+  OATPP_ASSERT(countItems("[\"]\"") == -1);
+
+  oatpp::String longArray = "[";
+  for(v_int32 i = 0; i < 1000; i ++) {
+    if(i > 0) longArray = longArray + ",";
+    longArray = longArray + (i % 3 == 0 ? "\"s,\\\"]\"" : "[0,{\"k\":0}]");
+  }
+  longArray = longArray + "]";
+  OATPP_ASSERT(StructuralIndex::countItems(longArray->getData(), longArray->getSize()) == 1000);
+  OATPP_ASSERT(StructuralIndex::countItems(longArray->getData(), longArray->getSize() - 1) == -1);
+
+  // Containers are reserved from the pre-count
+
+  oatpp::String numbers = "[";
+  for(v_int32 i = 0; i < 100; i ++) {
+    if(i > 0) numbers = numbers + ",";
+    numbers = numbers + oatpp::utils::conversion::int32ToStr(i);
+  }
+  numbers = numbers + "]";
+
+  auto vector = mapper->readFromString<oatpp::Vector<oatpp::Int32>>(numbers);
+  OATPP_ASSERT(vector->size() == 100);
+  OATPP_ASSERT(vector->capacity() == 100);
+  OATPP_ASSERT(vector[99] == 99);
+
+  auto numbersList = mapper->readFromString<oatpp::List<oatpp::Int32>>(numbers);
+  OATPP_ASSERT(numbersList->size() == 100);
+  std::list<oatpp::Int32>& stdList = *numbersList;
+  OATPP_ASSERT(stdList.back() == 99);
+
+  auto fields = mapper->readFromString<oatpp::UnorderedFields<oatpp::Int32>>("{\"a\": 1, \"b\": 2, \"c\": 3}");
+  OATPP_ASSERT(fields->size() == 3);
+  OATPP_ASSERT(fields["c"] == 3);
+
 }
   
 }}}}}
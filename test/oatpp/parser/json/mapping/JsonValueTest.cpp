@@ -0,0 +1,219 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "JsonValueTest.hpp"
+
+#include "oatpp/parser/json/mapping/ObjectMapper.hpp"
+#include "oatpp/parser/json/JsonValue.hpp"
+
+#include "oatpp/core/data/stream/BufferStream.hpp"
+#include "oatpp/core/macro/codegen.hpp"
+
+#include "oatpp-test/Checker.hpp"
+
+namespace oatpp { namespace test { namespace parser { namespace json { namespace mapping {
+
+namespace {
+
+typedef oatpp::parser::json::Tape Tape;
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+class Envelope : public oatpp::Object {
+
+  DTO_INIT(Envelope, Object)
+
+  DTO_FIELD(String, id);
+  DTO_FIELD(JsonValue, payload);
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+oatpp::String createLargeDocument(v_int32 itemsCount) {
+  oatpp::data::stream::BufferOutputStream stream;
+  stream << "{\"id\":\"doc\",\"payload\":[";
+  for(v_int32 i = 0; i < itemsCount; i ++) {
+    if(i > 0) stream << ",";
+    stream << "{\"id\":" << i << ",\"name\":\"item " << i << "\",\"price\":" << i << ".25,";
+    stream << "\"tags\":[\"a\",\"b\",\"c\"],\"active\":true,\"parent\":null}";
+  }
+  stream << "]}";
+  return stream.toString();
+}
+
+}
+
+void JsonValueTest::onRun() {
+
+  oatpp::parser::json::mapping::ObjectMapper mapper;
+
+  {
+    OATPP_LOGI(TAG, "Access values...");
+
+    auto value = oatpp::JsonValue::parse(
+      " {\"int\": -42, \"uint\": 18446744073709551615, \"float\": 1.5e2, \"str\": \"a\\\"b\\u0430\","
+      " \"list\": [1, [2, 3], {}, null, true, false], \"empty\": [], \"obj\": {\"key\": \"value\"}} "
+    );
+
+    OATPP_ASSERT(value.getKind() == Tape::KIND_OBJECT);
+    OATPP_ASSERT(value.getSize() == 7);
+
+    OATPP_ASSERT(value.getField("int").getKind() == Tape::KIND_INT64);
+    OATPP_ASSERT(value.getField("int").getInt64() == -42);
+    OATPP_ASSERT(value.getField("uint").getKind() == Tape::KIND_UINT64);
+    OATPP_ASSERT(value.getField("uint").getUInt64() == 18446744073709551615ULL);
+    OATPP_ASSERT(value.getField("float").getKind() == Tape::KIND_FLOAT64);
+    OATPP_ASSERT(value.getField("float").getFloat64() == 150.0);
+    OATPP_ASSERT(value.getField("str").getString() == "a\"b\xD0\xB0");
+    OATPP_ASSERT(value.getField("str").getStringLabel() == "a\\\"b\\u0430");
+
+    auto list = value.getField("list");
+    OATPP_ASSERT(list.getSize() == 6);
+    OATPP_ASSERT(list.getItem(0).getInt64() == 1);
+    OATPP_ASSERT(list.getItem(1).getSize() == 2);
+    OATPP_ASSERT(list.getItem(1).getItem(1).getInt64() == 3);
+    OATPP_ASSERT(list.getItem(2).getSize() == 0);
+    OATPP_ASSERT(list.getItem(3).isNull());
+    OATPP_ASSERT(list.getItem(4).getBoolean() == true);
+    OATPP_ASSERT(list.getItem(5).getBoolean() == false);
+
+    OATPP_ASSERT(value.getField("empty").getSize() == 0);
+    OATPP_ASSERT(value.getKey(6) == "obj");
+    OATPP_ASSERT(value.getValue(6).getField("key").getString() == "value");
+    OATPP_ASSERT(value.getField("missing") == nullptr);
+    OATPP_ASSERT(value.getField("list").getItem(1).getRaw().toString() == "[2, 3]");
+
+    bool error = false;
+    try {
+      list.getItem(6);
+    } catch (const std::runtime_error& e) {
+      error = true;
+    }
+    OATPP_ASSERT(error);
+
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "Pass through...");
+
+    oatpp::String json = "{\"id\":\"1\",\"payload\":{\"b\": [1, 2.50, \"\\u0430\"], \"a\": {\"x\": null}}}";
+    auto envelope = mapper.readFromString<Envelope>(json);
+    OATPP_ASSERT(envelope->id == "1");
+    OATPP_ASSERT(envelope->payload.getField("b").getItem(1).getFloat64() == 2.5);
+
+    auto result = mapper.writeToString(envelope);
+    OATPP_LOGD(TAG, "json='%s'", result->c_str());
+    OATPP_ASSERT(result == json);
+
+    envelope = mapper.readFromString<Envelope>("{\"id\":\"2\",\"payload\":null}");
+    OATPP_ASSERT(envelope->payload == nullptr);
+    OATPP_ASSERT(mapper.writeToString(envelope) == "{\"id\":\"2\",\"payload\":null}");
+
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "Materialize...");
+
+    oatpp::String json = "{\"a\":[1,-2,3.5,\"s\",true,null],\"b\":{\"c\":{}}}";
+    auto value = mapper.readFromString<oatpp::JsonValue>(json);
+    auto any = value.toAny();
+
+    OATPP_ASSERT(any.getStoredType() == oatpp::Fields<oatpp::Any>::Class::getType());
+    auto fields = any.retrieve<oatpp::Fields<oatpp::Any>>();
+    auto list = fields["a"].retrieve<oatpp::List<oatpp::Any>>();
+    OATPP_ASSERT(list[0].retrieve<oatpp::Int64>() == 1);
+    OATPP_ASSERT(list[1].retrieve<oatpp::Int64>() == -2);
+    OATPP_ASSERT(list[2].retrieve<oatpp::Float64>() == 3.5);
+    OATPP_ASSERT(mapper.writeToString(any) == json);
+
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "Errors...");
+
+    const char* const invalid[] = {
+      "", "{", "[1,", "{\"a\"}", "{\"a\":}", "{a:1}", "[1 2]", "\"abc", "[-]", "[1.2.3]", "[tru]", "{\"a\":1]"
+    };
+
+    for(auto text : invalid) {
+      bool error = false;
+      try {
+        mapper.readFromString<oatpp::JsonValue>(text);
+      } catch (const oatpp::parser::ParsingError& e) {
+        error = true;
+      }
+      OATPP_ASSERT(error);
+    }
+
+    const char* const invalidStrings[] = {
+      "\"\\q\"", "[\"a\\u12\"]", "{\"k\\x\":1}", "\"a\x01" "b\"", "[\"tab\there\"]", "\"\\ud800\"", "\"abc\\\""
+    };
+
+    for(auto text : invalidStrings) {
+      v_int64 code = 0;
+      try {
+        mapper.readFromString<oatpp::JsonValue>(text);
+      } catch (const oatpp::parser::ParsingError& e) {
+        code = e.getCode();
+      }
+      OATPP_ASSERT(code == oatpp::parser::json::Tape::ERROR_CODE_INVALID_STRING || code == oatpp::parser::json::Tape::ERROR_CODE_STRING_NOT_CLOSED);
+    }
+
+    auto valid = oatpp::JsonValue::parse("[\"\\\"\\\\\\/\\b\\f\\n\\r\\t\\u0444\\ud83d\\ude00\"]");
+    OATPP_ASSERT(valid.getItem(0).getString() == "\"\\/\b\f\n\r\t\xD1\x84\xF0\x9F\x98\x80");
+
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+    auto document = createLargeDocument(500);
+    OATPP_LOGD(TAG, "Document size=%d", document->getSize());
+
+    v_int32 numIterations = 100;
+
+    {
+      PerformanceChecker checker("Any - parse + serialize");
+      for(v_int32 i = 0; i < numIterations; i ++) {
+        auto value = mapper.readFromString<oatpp::Fields<oatpp::Any>>(document);
+        mapper.writeToString(value);
+      }
+    }
+
+    {
+      PerformanceChecker checker("JsonValue - parse + serialize");
+      for(v_int32 i = 0; i < numIterations; i ++) {
+        auto value = mapper.readFromString<Envelope>(document);
+        OATPP_ASSERT(mapper.writeToString(value) == document);
+      }
+    }
+
+  }
+
+}
+
+}}}}}
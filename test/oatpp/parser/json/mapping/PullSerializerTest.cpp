@@ -0,0 +1,215 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "PullSerializerTest.hpp"
+
+#include "oatpp/parser/json/mapping/ObjectMapper.hpp"
+#include "oatpp/core/data/stream/ChunkedBuffer.hpp"
+#include "oatpp/core/macro/codegen.hpp"
+
+#include "oatpp-test/Checker.hpp"
+
+namespace oatpp { namespace test { namespace parser { namespace json { namespace mapping {
+
+namespace {
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+ENUM(Enum1, v_int32,
+  VALUE(V1, 10, "enum1-v1"),
+  VALUE(V2, 20, "enum1-v2")
+);
+
+class Child : public oatpp::Object {
+
+  DTO_INIT(Child, Object)
+
+  DTO_FIELD(String, name);
+  DTO_FIELD(Int64, value);
+
+};
+
+class Root : public oatpp::Object {
+
+  DTO_INIT(Root, Object)
+
+  DTO_FIELD(String, field_string, "string \"field\"");
+  DTO_FIELD(Int32, field_int32);
+  DTO_FIELD(Float64, field_float64);
+  DTO_FIELD(Boolean, field_boolean);
+  DTO_FIELD(Enum<Enum1>::AsString, field_enum);
+  DTO_FIELD(List<Int32>, field_list);
+  DTO_FIELD(List<Int32>, field_empty_list);
+  DTO_FIELD(Vector<List<String>>, field_vector);
+  DTO_FIELD(Fields<Child>, field_fields);
+  DTO_FIELD(Fields<Child>, field_empty_fields);
+  DTO_FIELD(List<Child>, field_children);
+  DTO_FIELD(Child, child);
+  DTO_FIELD(Child, child_null);
+  DTO_FIELD(Any, field_any);
+
+};
+
+class EnumDto : public oatpp::Object {
+
+  DTO_INIT(EnumDto, Object)
+
+  DTO_FIELD(Enum<Enum1>::AsString::NotNull, field_enum);
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+const char* const JSON =
+  "{"
+  "\"string \\\"field\\\"\": \"hello \\\"world\\\" \\u0444 {[,]}\","
+  "\"field_int32\": -32,"
+  "\"field_float64\": 6.25e-2,"
+  "\"field_boolean\": false,"
+  "\"field_enum\": \"enum1-v2\","
+  "\"field_list\": [1, 2, 3],"
+  "\"field_empty_list\": [],"
+  "\"field_vector\": [[\"a\", \"b\"], [], null, [\"c\"]],"
+  "\"field_fields\": {\"k1\": {\"name\": \"n1\", \"value\": 1}, \"k2\": null, \"k\\\"3\": {}},"
+  "\"field_empty_fields\": {},"
+  "\"field_children\": [{\"name\": \"c1\", \"value\": -1}, {\"name\": null, \"value\": 2}],"
+  "\"child\": {\"name\": \"child\", \"value\": 9007199254740993},"
+  "\"child_null\": null,"
+  "\"field_any\": {\"a\": [1, \"2\", false, null, {\"b\": 3.5}]}"
+  "}";
+
+oatpp::String pullInChunks(const std::shared_ptr<oatpp::data::stream::ReadCallback>& writer, v_buff_size chunkSize) {
+  oatpp::data::stream::ChunkedBuffer stream;
+  std::unique_ptr<v_char8[]> buffer(new v_char8[chunkSize]);
+  while(true) {
+    auto res = writer->readSimple(buffer.get(), chunkSize);
+    OATPP_ASSERT(res >= 0 && res <= chunkSize);
+    if(res == 0) {
+      break;
+    }
+    stream.writeSimple(buffer.get(), res);
+  }
+  return stream.toString();
+}
+
+void checkSameOutput(oatpp::parser::json::mapping::ObjectMapper& mapper, const oatpp::Void& object) {
+  auto expected = mapper.writeToString(object);
+  for(v_buff_size chunkSize : {1, 2, 3, 5, 7, 16, 64, 4096}) {
+    auto result = pullInChunks(mapper.createWriter(object), chunkSize);
+    OATPP_ASSERT(result == expected);
+  }
+}
+
+}
+
+void PullSerializerTest::onRun() {
+
+  oatpp::parser::json::mapping::ObjectMapper mapper;
+
+  auto object = mapper.readFromString<Root>(JSON);
+  OATPP_ASSERT(object->field_fields->size() == 3);
+
+  {
+    OATPP_LOGI(TAG, "Chunk sizes...");
+    checkSameOutput(mapper, object);
+    OATPP_LOGI(TAG, "Chunk sizes - OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "Config...");
+
+    auto config = oatpp::parser::json::mapping::Serializer::Config::createShared();
+    config->includeNullFields = false;
+    oatpp::parser::json::mapping::ObjectMapper noNullsMapper(config, oatpp::parser::json::mapping::Deserializer::Config::createShared());
+    checkSameOutput(noNullsMapper, object);
+
+    config = oatpp::parser::json::mapping::Serializer::Config::createShared();
+    config->useBeautifier = true;
+    oatpp::parser::json::mapping::ObjectMapper beautifyingMapper(config, oatpp::parser::json::mapping::Deserializer::Config::createShared());
+    checkSameOutput(beautifyingMapper, object);
+
+    OATPP_LOGI(TAG, "Config - OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "Scalars and collections at root...");
+
+    checkSameOutput(mapper, oatpp::List<oatpp::Int32>({1, 2, 3}));
+    checkSameOutput(mapper, oatpp::Int64(-1234567));
+    checkSameOutput(mapper, oatpp::String("a\nb"));
+    checkSameOutput(mapper, oatpp::Any(oatpp::String("any")));
+    checkSameOutput(mapper, oatpp::UnorderedSet<oatpp::String>({"x"}));
+    checkSameOutput(mapper, oatpp::UnorderedFields<oatpp::Float32>({{"f", 0.5f}}));
+    checkSameOutput(mapper, Root::ObjectWrapper(nullptr));
+    checkSameOutput(mapper, Root::createShared());
+
+    OATPP_LOGI(TAG, "Scalars and collections at root - OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "Errors...");
+
+    auto dto = EnumDto::createShared();
+    auto writer = mapper.createWriter(dto);
+
+    bool error = false;
+    try {
+      pullInChunks(writer, 16);
+    } catch (const std::runtime_error& e) {
+      OATPP_LOGD(TAG, "error - %s", e.what());
+      error = true;
+    }
+    OATPP_ASSERT(error);
+
+    OATPP_LOGI(TAG, "Errors - OK");
+  }
+
+  {
+    v_int32 numElements = 100000;
+
+    auto list = oatpp::List<Child>::createShared();
+    for(v_int32 i = 0; i < numElements; i ++) {
+      auto child = Child::createShared();
+      child->name = "child";
+      child->value = i;
+      list->push_back(child);
+    }
+
+    oatpp::String expected;
+
+    {
+      PerformanceChecker checker("Buffered - 100k objects");
+      expected = mapper.writeToString(list);
+    }
+
+    {
+      PerformanceChecker checker("Pull - 100k objects in 4K chunks");
+      auto result = pullInChunks(mapper.createWriter(list), 4096);
+      OATPP_ASSERT(result == expected);
+    }
+  }
+
+}
+
+}}}}}
@@ -0,0 +1,304 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "PushDeserializerTest.hpp"
+
+#include "oatpp/parser/json/mapping/ObjectMapper.hpp"
+#include "oatpp/core/data/stream/ChunkedBuffer.hpp"
+#include "oatpp/core/macro/codegen.hpp"
+
+#include "oatpp-test/Checker.hpp"
+
+namespace oatpp { namespace test { namespace parser { namespace json { namespace mapping {
+
+namespace {
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+ENUM(Enum1, v_int32,
+  VALUE(V1, 10, "enum1-v1"),
+  VALUE(V2, 20, "enum1-v2")
+);
+
+class Child : public oatpp::Object {
+
+  DTO_INIT(Child, Object)
+
+  DTO_FIELD(String, name);
+  DTO_FIELD(Int64, value);
+
+};
+
+class Root : public oatpp::Object {
+
+  DTO_INIT(Root, Object)
+
+  DTO_FIELD(String, field_string, "string \"field\"");
+  DTO_FIELD(Int32, field_int32);
+  DTO_FIELD(UInt64, field_uint64);
+  DTO_FIELD(Float64, field_float64);
+  DTO_FIELD(Boolean, field_boolean);
+  DTO_FIELD(Enum<Enum1>::AsString, field_enum);
+  DTO_FIELD(List<Int32>, field_list);
+  DTO_FIELD(Vector<List<String>>, field_vector);
+  DTO_FIELD(UnorderedSet<String>, field_set);
+  DTO_FIELD(Fields<Child>, field_fields);
+  DTO_FIELD(UnorderedFields<Float32>, field_unordered_fields);
+  DTO_FIELD(List<Child>, field_children);
+  DTO_FIELD(Child, child);
+  DTO_FIELD(Any, field_any);
+  DTO_FIELD(Any, field_any_list);
+  DTO_FIELD(Any, field_any_string);
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+const char* const JSON =
+  "{\n"
+  "  \"string \\\"field\\\"\": \"hello \\\"world\\\" \\u0444 {[,]}\",\n"
+  "  \"field_int32\" : -32 ,\n"
+  "  \"field_uint64\": 18446744073709551615,\n"
+  "  \"unknown_1\": {\"a\": [1, 2, {\"b\": \"}]\"}], \"c\": null},\n"
+  "  \"field_float64\": 6.25e-2,\n"
+  "  \"field_boolean\": true,\n"
+  "  \"field_enum\": \"enum1-v2\",\n"
+  "  \"field_list\": [1,2 , 3],\n"
+  "  \"unknown_2\": \"skip \\\" me\",\n"
+  "  \"field_vector\": [[\"a\", \"b\"], [], null, [\"c\"]],\n"
+  "  \"field_set\": [\"x\", \"y\"],\n"
+  "  \"field_fields\": {\"k1\": {\"name\": \"n1\", \"value\": 1}, \"k2\": null},\n"
+  "  \"field_unordered_fields\": {\"f\": 0.5},\n"
+  "  \"unknown_3\": 12345,\n"
+  "  \"field_children\": [{\"name\": \"c1\", \"value\": -1}, {\"value\": 2, \"name\": \"c2\", \"extra\": [[]]}],\n"
+  "  \"child\": {\"name\": \"child\", \"value\": 9007199254740993},\n"
+  "  \"field_any\": {\"a\": [1, \"2\", false, null, {\"b\": 3.5}]},\n"
+  "  \"field_any_list\": [1, [2, [3]]],\n"
+  "  \"field_any_string\": \"any\"\n"
+  "}";
+
+oatpp::Void pushInChunks(oatpp::parser::json::mapping::ObjectMapper& mapper,
+                         const oatpp::data::mapping::type::Type* type,
+                         const oatpp::String& text,
+                         v_buff_size chunkSize,
+                         std::shared_ptr<oatpp::data::mapping::ObjectMapper::Reader>& reader)
+{
+  reader = mapper.createReader(type);
+  for(v_buff_size pos = 0; pos < text->getSize(); pos += chunkSize) {
+    v_buff_size size = chunkSize;
+    if(pos + size > text->getSize()) {
+      size = text->getSize() - pos;
+    }
+    OATPP_ASSERT(reader->writeSimple(text->getData() + pos, size) == size);
+  }
+  return reader->finish();
+}
+
+/*
+ * Number of entries in use by pools of oatpp::base::memory::PoolAllocator.
+ */
+v_int64 getPoolAllocatorObjectsCount() {
+  v_int64 result = 0;
+  for(const auto& stats : oatpp::base::memory::MemoryPool::getAllPoolsStats()) {
+    if(stats.name.compare(0, 14, "PoolAllocator_") == 0) {
+      result += stats.objectsCount;
+    }
+  }
+  return result;
+}
+
+bool sameJson(oatpp::parser::json::mapping::ObjectMapper& mapper, const oatpp::Void& a, const oatpp::Void& b) {
+  return mapper.writeToString(a) == mapper.writeToString(b);
+}
+
+}
+
+void PushDeserializerTest::onRun() {
+
+  oatpp::parser::json::mapping::ObjectMapper mapper;
+  std::shared_ptr<oatpp::data::mapping::ObjectMapper::Reader> reader;
+
+  auto expected = mapper.readFromString<Root>(JSON);
+
+  OATPP_ASSERT(expected->field_string == "hello \"world\" \xD1\x84 {[,]}");
+  OATPP_ASSERT(expected->field_fields->size() == 2);
+
+  {
+    OATPP_LOGI(TAG, "Chunk sizes...");
+    oatpp::String text = JSON;
+    for(v_buff_size chunkSize : {1, 2, 3, 5, 7, 16, 64, 4096}) {
+      auto result = pushInChunks(mapper, Root::ObjectWrapper::Class::getType(), text, chunkSize, reader);
+      OATPP_ASSERT(!reader->hasError());
+      OATPP_ASSERT(result);
+      OATPP_ASSERT(result.valueType == Root::ObjectWrapper::Class::getType());
+
+      auto root = result.staticCast<Root::ObjectWrapper>();
+      OATPP_ASSERT(root->field_string == expected->field_string);
+      OATPP_ASSERT(root->field_int32 == -32);
+      OATPP_ASSERT(root->field_uint64 == 18446744073709551615ULL);
+      OATPP_ASSERT(root->field_float64 == 0.0625);
+      OATPP_ASSERT(root->field_enum == Enum1::V2);
+      OATPP_ASSERT(root->field_list->size() == 3);
+      OATPP_ASSERT(root->field_vector->size() == 4);
+      OATPP_ASSERT(root->field_vector[2] == nullptr);
+      OATPP_ASSERT(root->field_children[1]->name == "c2");
+      OATPP_ASSERT(root->child->value == 9007199254740993LL);
+      OATPP_ASSERT(root->field_any.getStoredType() == oatpp::Fields<oatpp::Any>::Class::getType());
+      OATPP_ASSERT(root->field_any_string.retrieve<oatpp::String>() == "any");
+
+      OATPP_ASSERT(sameJson(mapper, result, expected));
+    }
+    OATPP_LOGI(TAG, "Chunk sizes - OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "Scalars and collections at root...");
+
+    auto list = pushInChunks(mapper, oatpp::List<oatpp::Int32>::Class::getType(), " [1, 2,3] ", 1, reader);
+    OATPP_ASSERT(list.staticCast<oatpp::List<oatpp::Int32>>()->size() == 3);
+
+    auto number = pushInChunks(mapper, oatpp::Int64::Class::getType(), "-1234567", 3, reader);
+    OATPP_ASSERT(number.staticCast<oatpp::Int64>() == -1234567);
+
+    auto str = pushInChunks(mapper, oatpp::String::Class::getType(), "\"a\\nb\"", 1, reader);
+    OATPP_ASSERT(str.staticCast<oatpp::String>() == "a\nb");
+
+    auto nullObject = pushInChunks(mapper, Root::ObjectWrapper::Class::getType(), "null", 1, reader);
+    OATPP_ASSERT(!reader->hasError());
+    OATPP_ASSERT(!nullObject);
+
+    OATPP_LOGI(TAG, "Scalars and collections at root - OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "Errors...");
+
+    auto type = Root::ObjectWrapper::Class::getType();
+
+    pushInChunks(mapper, type, "{\"field_int32\": 1", 1, reader);
+    OATPP_ASSERT(reader->hasError());
+    OATPP_ASSERT(reader->getErrorCode() == oatpp::parser::json::mapping::Deserializer::ERROR_CODE_OBJECT_SCOPE_CLOSE);
+
+    pushInChunks(mapper, type, "{\"field_list\": [1, 2}", 2, reader);
+    OATPP_ASSERT(reader->hasError());
+    OATPP_ASSERT(reader->getErrorCode() == oatpp::parser::json::mapping::Deserializer::ERROR_CODE_ARRAY_SCOPE_CLOSE);
+
+    pushInChunks(mapper, type, "{\"field_int32\" 1}", 3, reader);
+    OATPP_ASSERT(reader->hasError());
+    OATPP_ASSERT(reader->getErrorCode() == oatpp::parser::json::mapping::Deserializer::ERROR_CODE_OBJECT_SCOPE_COLON_MISSING);
+    OATPP_ASSERT(reader->getErrorPosition() == 15);
+
+    pushInChunks(mapper, type, "{\"field_boolean\": maybe}", 1, reader);
+    OATPP_ASSERT(reader->hasError());
+    OATPP_ASSERT(reader->getErrorCode() == oatpp::parser::json::mapping::Deserializer::ERROR_CODE_VALUE_BOOLEAN);
+
+    pushInChunks(mapper, type, "[]", 1, reader);
+    OATPP_ASSERT(reader->hasError());
+    OATPP_ASSERT(reader->getErrorCode() == oatpp::parser::json::mapping::Deserializer::ERROR_CODE_OBJECT_SCOPE_OPEN);
+
+    pushInChunks(mapper, type, "", 1, reader);
+    OATPP_ASSERT(reader->hasError());
+    OATPP_ASSERT(reader->getErrorCode() == oatpp::parser::json::mapping::Deserializer::ERROR_CODE_OBJECT_SCOPE_OPEN);
+
+    auto config = oatpp::parser::json::mapping::Deserializer::Config::createShared();
+    config->allowUnknownFields = false;
+    oatpp::parser::json::mapping::ObjectMapper strictMapper(oatpp::parser::json::mapping::Serializer::Config::createShared(), config);
+    pushInChunks(strictMapper, type, "{\"field_int32\": 1, \"unknown\": 2}", 4, reader);
+    OATPP_ASSERT(reader->hasError());
+    OATPP_ASSERT(reader->getErrorCode() == oatpp::parser::json::mapping::Deserializer::ERROR_CODE_OBJECT_SCOPE_UNKNOWN_FIELD);
+
+    OATPP_LOGI(TAG, "Errors - OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "Pooled allocation...");
+
+    v_int64 numElements = 1000;
+
+    oatpp::data::stream::ChunkedBuffer stream;
+    stream.writeSimple("[", 1);
+    for(v_int64 i = 0; i < numElements; i ++) {
+      if(i > 0) stream.writeSimple(",", 1);
+      stream.writeSimple("{\"name\":\"child\",\"value\":");
+      stream.writeAsString(i);
+      stream.writeSimple("}", 1);
+    }
+    stream.writeSimple("]", 1);
+    auto text = stream.toString();
+
+    auto type = oatpp::List<Child>::Class::getType();
+
+    auto before = getPoolAllocatorObjectsCount();
+    auto list = pushInChunks(mapper, type, text, 64, reader).staticCast<oatpp::List<Child>>();
+    OATPP_ASSERT((v_int64) list->size() == numElements);
+    OATPP_ASSERT(getPoolAllocatorObjectsCount() == before);
+
+    auto config = oatpp::parser::json::mapping::Deserializer::Config::createShared();
+    config->usePooledAllocation = true;
+    oatpp::parser::json::mapping::ObjectMapper pooledMapper(oatpp::parser::json::mapping::Serializer::Config::createShared(), config);
+
+    auto pooledList = pushInChunks(pooledMapper, type, text, 64, reader).staticCast<oatpp::List<Child>>();
+    OATPP_ASSERT(!reader->hasError());
+    OATPP_ASSERT(!oatpp::base::memory::PooledAllocation::isEnabled());
+    OATPP_ASSERT((v_int64) pooledList->size() == numElements);
+    OATPP_ASSERT(pooledList[numElements - 1]->value == numElements - 1);
+    // child objects and their Int64 fields come from the pools
+    OATPP_ASSERT(getPoolAllocatorObjectsCount() - before >= 2 * numElements);
+    OATPP_ASSERT(sameJson(mapper, pooledList, list));
+
+    OATPP_LOGI(TAG, "Pooled allocation - OK");
+  }
+
+  {
+    v_int32 numElements = 100000;
+
+    oatpp::data::stream::ChunkedBuffer stream;
+    stream.writeSimple("[", 1);
+    for(v_int32 i = 0; i < numElements; i ++) {
+      if(i > 0) stream.writeSimple(",", 1);
+      stream.writeSimple("{\"name\":\"child\",\"value\":");
+      stream.writeAsString(i);
+      stream.writeSimple("}", 1);
+    }
+    stream.writeSimple("]", 1);
+    auto text = stream.toString();
+
+    auto type = oatpp::List<Child>::Class::getType();
+
+    {
+      PerformanceChecker checker("Buffered - 100k objects");
+      auto list = mapper.readFromString<oatpp::List<Child>>(text);
+      OATPP_ASSERT((v_int32) list->size() == numElements);
+    }
+
+    {
+      PerformanceChecker checker("Push - 100k objects in 4K chunks");
+      auto list = pushInChunks(mapper, type, text, 4096, reader).staticCast<oatpp::List<Child>>();
+      OATPP_ASSERT((v_int32) list->size() == numElements);
+    }
+  }
+
+}
+
+}}}}}
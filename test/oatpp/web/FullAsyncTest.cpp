@@ -57,18 +57,22 @@ typedef oatpp::web::protocol::http::outgoing::MultipartBody MultipartBody;
 class TestComponent {
 private:
   v_int32 m_port;
+  bool m_zeroCopy;
 public:
 
-  TestComponent(v_int32 port)
+  TestComponent(v_int32 port, bool zeroCopy)
     : m_port(port)
+    , m_zeroCopy(zeroCopy)
   {}
 
   OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::async::Executor>, executor)([] {
     return std::make_shared<oatpp::async::Executor>(1, 1, 1);
   }());
 
-  OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::network::virtual_::Interface>, virtualInterface)([] {
-    return oatpp::network::virtual_::Interface::obtainShared("virtualhost");
+  OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::network::virtual_::Interface>, virtualInterface)([this] {
+    auto interface = oatpp::network::virtual_::Interface::obtainShared("virtualhost");
+    interface->setZeroCopy(m_zeroCopy);
+    return interface;
   }());
 
   OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::network::ServerConnectionProvider>, serverConnectionProvider)([this] {
@@ -139,7 +143,7 @@ std::shared_ptr<Multipart> createMultipart(const std::unordered_map<oatpp::Strin
   
 void FullAsyncTest::onRun() {
 
-  TestComponent component(m_port);
+  TestComponent component(m_port, m_zeroCopy);
 
   oatpp::test::web::ClientServerTestRunner runner;
 
@@ -179,6 +183,14 @@ void FullAsyncTest::onRun() {
         OATPP_ASSERT(dto);
         OATPP_ASSERT(dto->testValue == "my_test_param-Async");
       }
+
+      { // test GET with path parameter and streaming response body
+        auto response = client->getWithParamsStreaming("my_test_param-Async", connection);
+        OATPP_ASSERT(response->getStatusCode() == 200);
+        auto dto = response->readBodyToDto<app::TestDto>(objectMapper.get());
+        OATPP_ASSERT(dto);
+        OATPP_ASSERT(dto->testValue == "my_test_param-Async");
+      }
       
       { // test GET with header parameter
         auto response = client->getWithHeaders("my_test_header-Async", connection);
@@ -226,6 +238,22 @@ void FullAsyncTest::onRun() {
         OATPP_ASSERT(returnedData == data);
       }
 
+      { // test BufferChain body
+        oatpp::String sample = "__abcdefghijklmnopqrstuvwxyz-0123456789";
+        for(v_int32 numIterations : {10, 1000}) {
+          oatpp::data::stream::ChunkedBuffer stream;
+          for(v_int32 i = 0; i < numIterations; i++) {
+            stream.writeSimple(sample->getData(), sample->getSize());
+          }
+          auto data = stream.toString();
+          auto response = client->getChain(sample, numIterations, connection);
+          OATPP_ASSERT(response->getStatusCode() == 200);
+          auto returnedData = response->readBodyToString();
+          OATPP_ASSERT(returnedData);
+          OATPP_ASSERT(returnedData == data);
+        }
+      }
+
       { // Multipart body
 
         std::unordered_map<oatpp::String, oatpp::String> map;
@@ -59,14 +59,18 @@ typedef oatpp::web::protocol::http::outgoing::MultipartBody MultipartBody;
 class TestComponent {
 private:
   v_int32 m_port;
+  bool m_zeroCopy;
 public:
 
-  TestComponent(v_int32 port)
+  TestComponent(v_int32 port, bool zeroCopy)
     : m_port(port)
+    , m_zeroCopy(zeroCopy)
   {}
 
-  OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::network::virtual_::Interface>, virtualInterface)([] {
-    return oatpp::network::virtual_::Interface::obtainShared("virtualhost");
+  OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::network::virtual_::Interface>, virtualInterface)([this] {
+    auto interface = oatpp::network::virtual_::Interface::obtainShared("virtualhost");
+    interface->setZeroCopy(m_zeroCopy);
+    return interface;
   }());
 
   OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::network::ServerConnectionProvider>, serverConnectionProvider)([this] {
@@ -136,7 +140,7 @@ std::shared_ptr<Multipart> createMultipart(const std::unordered_map<oatpp::Strin
   
 void FullTest::onRun() {
 
-  TestComponent component(m_port);
+  TestComponent component(m_port, m_zeroCopy);
 
   oatpp::test::web::ClientServerTestRunner runner;
 
@@ -256,6 +260,14 @@ void FullTest::onRun() {
         OATPP_ASSERT(dto->testValue == "my_test_param");
       }
 
+      { // test GET with path parameter and streaming response body
+        auto response = client->getWithParamsStreaming("my_test_param", connection);
+        OATPP_ASSERT(response->getStatusCode() == 200);
+        auto dto = response->readBodyToDto<app::TestDto>(objectMapper.get());
+        OATPP_ASSERT(dto);
+        OATPP_ASSERT(dto->testValue == "my_test_param");
+      }
+
       { // test GET with query parameters
         auto response = client->getWithQueries("oatpp", 1, connection);
         OATPP_ASSERT(response->getStatusCode() == 200);
@@ -426,6 +438,22 @@ void FullTest::onRun() {
         OATPP_ASSERT(returnedData == data);
       }
 
+      { // test BufferChain body
+        oatpp::String sample = "__abcdefghijklmnopqrstuvwxyz-0123456789";
+        for(v_int32 numIterations : {10, 1000}) {
+          oatpp::data::stream::ChunkedBuffer stream;
+          for(v_int32 i = 0; i < numIterations; i++) {
+            stream.writeSimple(sample->getData(), sample->getSize());
+          }
+          auto data = stream.toString();
+          auto response = client->getChain(sample, numIterations, connection);
+          OATPP_ASSERT(response->getStatusCode() == 200);
+          auto returnedData = response->readBodyToString();
+          OATPP_ASSERT(returnedData);
+          OATPP_ASSERT(returnedData == data);
+        }
+      }
+
       { // Multipart body
 
         std::unordered_map<oatpp::String, oatpp::String> map;
@@ -33,12 +33,14 @@ class FullTest : public UnitTest {
 private:
   v_int32 m_port;
   v_int32 m_iterationsPerStep;
+  bool m_zeroCopy;
 public:
   
-  FullTest(v_int32 port, v_int32 iterationsPerStep)
+  FullTest(v_int32 port, v_int32 iterationsPerStep, bool zeroCopy = false)
     : UnitTest("TEST[web::FullTest]")
     , m_port(port)
     , m_iterationsPerStep(iterationsPerStep)
+    , m_zeroCopy(zeroCopy)
   {}
 
   void onRun() override;
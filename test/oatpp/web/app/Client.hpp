@@ -51,6 +51,7 @@ public:
   API_CALL("GET", "/cors-origin-methods", getCorsOriginMethods)
   API_CALL("GET", "/cors-origin-methods-headers", getCorsOriginMethodsHeader)
   API_CALL("GET", "params/{param}", getWithParams, PATH(String, param))
+  API_CALL("GET", "params/{param}/streaming", getWithParamsStreaming, PATH(String, param))
   API_CALL("GET", "queries", getWithQueries, QUERY(String, name), QUERY(Int32, age))
   API_CALL("GET", "queries/map", getWithQueriesMap, QUERY(String, key1), QUERY(Int32, key2), QUERY(Float32, key3))
   API_CALL("GET", "headers", getWithHeaders, HEADER(String, param, "X-TEST-HEADER"))
@@ -71,6 +72,7 @@ public:
   API_CALL("GET", "bearer-authorization", bearerAuthorization, AUTHORIZATION(String, authString, "Bearer"))
 
   API_CALL("GET", "chunked/{text-value}/{num-iterations}", getChunked, PATH(String, text, "text-value"), PATH(Int32, numIterations, "num-iterations"))
+  API_CALL("GET", "chain/{text-value}/{num-iterations}", getChain, PATH(String, text, "text-value"), PATH(Int32, numIterations, "num-iterations"))
   API_CALL("POST", "test/multipart/{chunk-size}", multipartTest, PATH(Int32, chunkSize, "chunk-size"), BODY(std::shared_ptr<MultipartBody>, body))
 
   API_CALL("GET", "test/interceptors", getInterceptors)
@@ -31,6 +31,7 @@
 #include "oatpp/web/mime/multipart/InMemoryPartReader.hpp"
 #include "oatpp/web/mime/multipart/Reader.hpp"
 
+#include "oatpp/web/protocol/http/outgoing/BufferChainBody.hpp"
 #include "oatpp/web/protocol/http/outgoing/MultipartBody.hpp"
 #include "oatpp/web/protocol/http/outgoing/StreamingBody.hpp"
 
@@ -105,6 +106,13 @@ public:
     dto->testValue = param;
     return createDtoResponse(Status::CODE_200, dto);
   }
+
+  ENDPOINT("GET", "params/{param}/streaming", getWithParamsStreaming,
+           PATH(String, param)) {
+    auto dto = TestDto::createShared();
+    dto->testValue = param;
+    return createDtoStreamingResponse(Status::CODE_200, dto);
+  }
   
   ENDPOINT("GET", "queries", getWithQueries,
            QUERY(String, name), QUERY(Int32, age)) {
@@ -220,6 +228,18 @@ public:
     return OutgoingResponse::createShared(Status::CODE_200, body);
   }
 
+  ENDPOINT("GET", "chain/{text-value}/{num-iterations}", chain,
+           PATH(String, text, "text-value"),
+           PATH(Int32, numIterations, "num-iterations"))
+  {
+    auto chain = oatpp::data::buffer::BufferChain::createShared();
+    for(v_int32 i = 0; i < *numIterations; i++) {
+      chain->append(text);
+    }
+    auto body = oatpp::web::protocol::http::outgoing::BufferChainBody::createShared(chain);
+    return OutgoingResponse::createShared(Status::CODE_200, body);
+  }
+
   ENDPOINT("POST", "test/multipart/{chunk-size}", multipartTest,
            PATH(Int32, chunkSize, "chunk-size"),
            REQUEST(std::shared_ptr<IncomingRequest>, request))
@@ -31,6 +31,7 @@
 #include "oatpp/web/mime/multipart/InMemoryPartReader.hpp"
 #include "oatpp/web/mime/multipart/Reader.hpp"
 
+#include "oatpp/web/protocol/http/outgoing/BufferChainBody.hpp"
 #include "oatpp/web/protocol/http/outgoing/MultipartBody.hpp"
 
 #include "oatpp/web/protocol/http/outgoing/StreamingBody.hpp"
@@ -86,6 +87,19 @@ public:
 
   };
 
+  ENDPOINT_ASYNC("GET", "params/{param}/streaming", GetWithParamsStreaming) {
+
+    ENDPOINT_ASYNC_INIT(GetWithParamsStreaming)
+
+    Action act() {
+      auto param = request->getPathVariable("param");
+      auto dto = TestDto::createShared();
+      dto->testValue = param;
+      return _return(controller->createDtoStreamingResponse(Status::CODE_200, dto));
+    }
+
+  };
+
   ENDPOINT_ASYNC("GET", "headers", GetWithHeaders) {
 
     ENDPOINT_ASYNC_INIT(GetWithHeaders)
@@ -197,6 +211,23 @@ public:
 
   };
 
+  ENDPOINT_ASYNC("GET", "chain/{text-value}/{num-iterations}", Chain) {
+
+    ENDPOINT_ASYNC_INIT(Chain)
+
+    Action act() {
+      oatpp::String text = request->getPathVariable("text-value");
+      auto numIterations = oatpp::utils::conversion::strToInt32(request->getPathVariable("num-iterations")->c_str());
+      auto chain = oatpp::data::buffer::BufferChain::createShared();
+      for(v_int32 i = 0; i < numIterations; i++) {
+        chain->append(text);
+      }
+      auto body = oatpp::web::protocol::http::outgoing::BufferChainBody::createShared(chain);
+      return _return(OutgoingResponse::createShared(Status::CODE_200, body));
+    }
+
+  };
+
   ENDPOINT_ASYNC("POST", "test/multipart/{chunk-size}", MultipartTest) {
 
     ENDPOINT_ASYNC_INIT(MultipartTest)
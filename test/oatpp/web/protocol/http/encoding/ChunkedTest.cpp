@@ -27,8 +27,63 @@
 #include "oatpp/web/protocol/http/encoding/Chunked.hpp"
 #include "oatpp/core/data/stream/BufferStream.hpp"
 
+#include "oatpp-test/Checker.hpp"
+
+#include <vector>
+
 namespace oatpp { namespace test { namespace web { namespace protocol { namespace http { namespace encoding {
 
+namespace {
+
+  oatpp::String encode(const oatpp::String& data, v_buff_size bufferSize) {
+    oatpp::data::stream::BufferInputStream inStream(data);
+    oatpp::data::stream::BufferOutputStream outStream(data->getSize() + data->getSize() / 4 + 64);
+    oatpp::web::protocol::http::encoding::EncoderChunked encoder;
+    std::vector<v_char8> buffer(bufferSize);
+    auto count = oatpp::data::stream::transfer(&inStream, &outStream, 0, buffer.data(), bufferSize, &encoder);
+    OATPP_ASSERT(count == data->getSize());
+    return outStream.toString();
+  }
+
+  oatpp::String decode(const oatpp::String& data, v_buff_size bufferSize) {
+    oatpp::data::stream::BufferInputStream inStream(data);
+    oatpp::data::stream::BufferOutputStream outStream(data->getSize());
+    oatpp::web::protocol::http::encoding::DecoderChunked decoder;
+    std::vector<v_char8> buffer(bufferSize);
+    auto count = oatpp::data::stream::transfer(&inStream, &outStream, 0, buffer.data(), bufferSize, &decoder);
+    OATPP_ASSERT(count == data->getSize());
+    return outStream.toString();
+  }
+
+  /*
+   * Feed the whole input to the decoder at once.
+   */
+  v_int32 decodeInline(oatpp::data::buffer::Processor& decoder, const oatpp::String& data, oatpp::String& result) {
+    oatpp::data::stream::BufferOutputStream outStream;
+    oatpp::data::buffer::InlineReadData dataIn(data->getData(), data->getSize());
+    oatpp::data::buffer::InlineReadData dataOut;
+    while(true) {
+      v_int32 res = decoder.iterate(dataIn, dataOut);
+      if(res == oatpp::data::buffer::Processor::Error::FLUSH_DATA_OUT) {
+        outStream.writeSimple(dataOut.currBufferPtr, dataOut.bytesLeft);
+        dataOut.setEof();
+      } else if(res != oatpp::data::buffer::Processor::Error::OK) {
+        result = outStream.toString();
+        return res;
+      }
+    }
+  }
+
+  oatpp::String generateData(v_buff_size size) {
+    oatpp::String data(size);
+    for(v_buff_size i = 0; i < size; i++) {
+      data->getData()[i] = (v_char8) ('a' + i % 26);
+    }
+    return data;
+  }
+
+}
+
 void ChunkedTest::onRun() {
 
   oatpp::String data = "Hello World!!!";
@@ -119,6 +174,139 @@ void ChunkedTest::onRun() {
     OATPP_ASSERT(result == data);
   }
 
+  { // Large chunks and small chunks mixed
+    typedef oatpp::web::protocol::http::encoding::EncoderChunked EncoderChunked;
+
+    auto largeData = generateData(EncoderChunked::SMALL_CHUNK_MAX_SIZE * 2 + 100);
+    auto largeEncoded = encode(largeData, EncoderChunked::SMALL_CHUNK_MAX_SIZE * 2);
+    auto expected = "800\r\n" + oatpp::String((const char*) largeData->getData(), 0x800, false) + "\r\n" +
+                    "64\r\n" + oatpp::String((const char*) largeData->getData() + 0x800, 100, false) + "\r\n" +
+                    "0\r\n\r\n";
+    OATPP_ASSERT(largeEncoded == expected);
+    OATPP_ASSERT(decode(largeEncoded, 7) == largeData);
+
+    for(v_buff_size bufferSize : {1, 15, 16, 255, 1024, 1025, 4096, 32767}) {
+      auto encoded = encode(largeData, bufferSize);
+      OATPP_ASSERT(decode(encoded, 4096) == largeData);
+    }
+  }
+
+  { // Whole input at once, chunk extensions and trailer fields
+    typedef oatpp::web::protocol::http::encoding::DecoderChunked DecoderChunked;
+    DecoderChunked decoder;
+    oatpp::String result;
+    auto res = decodeInline(decoder, "5;name=value\r\nHello\r\n9\r\n World!!!\r\n0\r\nX-Trailer: 1\r\n\r\nNEXT", result);
+    OATPP_ASSERT(res == oatpp::data::buffer::Processor::Error::FINISHED);
+    OATPP_ASSERT(result == "Hello World!!!");
+    OATPP_ASSERT(decoder.getBodySize() == 14);
+  }
+
+  { // Data following the body is not consumed
+    oatpp::String input = encode(data, 5) + "NEXT";
+    oatpp::data::stream::BufferInputStream inStream(input);
+    oatpp::data::stream::BufferOutputStream outStream;
+    oatpp::web::protocol::http::encoding::DecoderChunked decoder;
+    v_char8 buffer[4096];
+    oatpp::data::stream::transfer(&inStream, &outStream, 0, buffer, 4096, &decoder);
+    OATPP_ASSERT(outStream.toString() == data);
+    OATPP_ASSERT(input->getSize() - inStream.getCurrentPosition() == 4);
+  }
+
+  { // Errors and limits
+    typedef oatpp::web::protocol::http::encoding::DecoderChunked DecoderChunked;
+    oatpp::String result;
+
+    {
+      DecoderChunked decoder(16);
+      OATPP_ASSERT(decodeInline(decoder, "5;long-extension\r\nHello\r\n0\r\n\r\n", result) == DecoderChunked::ERROR_CHUNK_HEADER_TOO_LONG);
+    }
+
+    {
+      DecoderChunked decoder;
+      OATPP_ASSERT(decodeInline(decoder, "X\r\nHello\r\n0\r\n\r\n", result) == DecoderChunked::ERROR_INVALID_CHUNK_HEADER);
+    }
+
+    {
+      DecoderChunked decoder;
+      OATPP_ASSERT(decodeInline(decoder, "FFFFFFFFFFFFFFFFFF\r\n", result) == DecoderChunked::ERROR_INVALID_CHUNK_HEADER);
+    }
+
+    {
+      DecoderChunked decoder;
+      OATPP_ASSERT(decodeInline(decoder, "5\r\nHelloX\r\n0\r\n\r\n", result) == DecoderChunked::ERROR_INVALID_CHUNK_HEADER);
+      OATPP_ASSERT(result == "Hello");
+    }
+
+    {
+      DecoderChunked decoder(DecoderChunked::DEFAULT_MAX_LINE_SIZE, 10);
+      OATPP_ASSERT(decodeInline(decoder, "5\r\nHello\r\n6\r\n World\r\n0\r\n\r\n", result) == DecoderChunked::ERROR_BODY_TOO_LARGE);
+      OATPP_ASSERT(result == "Hello");
+    }
+
+    {
+      DecoderChunked decoder(DecoderChunked::DEFAULT_MAX_LINE_SIZE, 11);
+      OATPP_ASSERT(decodeInline(decoder, "5\r\nHello\r\n6\r\n World\r\n0\r\n\r\n", result) == oatpp::data::buffer::Processor::Error::FINISHED);
+      OATPP_ASSERT(result == "Hello World");
+    }
+
+    {
+      DecoderChunked decoder;
+      OATPP_ASSERT(decodeInline(decoder, "7FFFFFFFFFFFFFFF\r\nabc", result) == oatpp::data::buffer::Processor::Error::PROVIDE_DATA_IN);
+      OATPP_ASSERT(result == "abc");
+      OATPP_ASSERT(decoder.suggestInputStreamReadSize() > 0);
+      oatpp::data::buffer::InlineReadData dataIn;
+      oatpp::data::buffer::InlineReadData dataOut;
+      OATPP_ASSERT(decoder.iterate(dataIn, dataOut) == DecoderChunked::ERROR_UNEXPECTED_END);
+    }
+
+    {
+      oatpp::String trailer = "0\r\n";
+      for(v_int32 i = 0; i < DecoderChunked::MAX_TRAILER_FIELDS; i ++) {
+        trailer = trailer + "X-Trailer: 1\r\n";
+      }
+      DecoderChunked decoder;
+      OATPP_ASSERT(decodeInline(decoder, trailer + "\r\n", result) == oatpp::data::buffer::Processor::Error::FINISHED);
+      DecoderChunked decoder2;
+      OATPP_ASSERT(decodeInline(decoder2, trailer + "X-Trailer: 1\r\n\r\n", result) == DecoderChunked::ERROR_TOO_MANY_TRAILER_FIELDS);
+    }
+
+    {
+      oatpp::web::protocol::http::encoding::ChunkedDecoderProvider provider(DecoderChunked::DEFAULT_MAX_LINE_SIZE, 10);
+      auto decoder = provider.getProcessor();
+      OATPP_ASSERT(decodeInline(*decoder, "5\r\nHello\r\n6\r\n World\r\n0\r\n\r\n", result) == DecoderChunked::ERROR_BODY_TOO_LARGE);
+      OATPP_ASSERT(result == "Hello");
+    }
+  }
+
+  {
+    auto streamData = generateData(32 * 1024 * 1024);
+    oatpp::String encoded;
+    oatpp::String decoded;
+    {
+      PerformanceChecker checker("EncoderChunked - streaming 32MB, 32767 bytes chunks");
+      encoded = encode(streamData, 32767);
+    }
+    {
+      PerformanceChecker checker("DecoderChunked - streaming 32MB, 32767 bytes chunks");
+      decoded = decode(encoded, 4096);
+    }
+    OATPP_ASSERT(decoded == streamData);
+  }
+
+  {
+    auto sseData = generateData(200000 * 64);
+    oatpp::String encoded;
+    oatpp::String decoded;
+    {
+      PerformanceChecker checker("EncoderChunked - SSE-style, 200000 events of 64 bytes");
+      encoded = encode(sseData, 64);
+    }
+    {
+      PerformanceChecker checker("DecoderChunked - SSE-style, 200000 events of 64 bytes");
+      decoded = decode(encoded, 4096);
+    }
+    OATPP_ASSERT(decoded == sseData);
+  }
 
 }
 